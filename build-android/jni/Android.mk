@@ -28,8 +28,11 @@ include $(CLEAR_VARS)
 LOCAL_MODULE := layer_utils
 LOCAL_SRC_FILES += $(SRC_DIR)/layers/vk_layer_config.cpp
 LOCAL_SRC_FILES += $(SRC_DIR)/layers/utils/vk_layer_extension_utils.cpp
+LOCAL_SRC_FILES += $(SRC_DIR)/layers/error_message/binary_log.cpp
 LOCAL_SRC_FILES += $(SRC_DIR)/layers/error_message/logging.cpp
 LOCAL_SRC_FILES += $(SRC_DIR)/layers/utils/vk_layer_utils.cpp
+LOCAL_SRC_FILES += $(SRC_DIR)/layers/utils/validation_cache.cpp
+LOCAL_SRC_FILES += $(SRC_DIR)/layers/sync/sync_utils_threading.cpp
 LOCAL_SRC_FILES += $(SRC_DIR)/layers/vulkan/generated/vk_format_utils.cpp
 LOCAL_SRC_FILES += $(SRC_DIR)/layers/external/xxhash.cpp
 LOCAL_C_INCLUDES += $(LOCAL_PATH)/$(SRC_DIR)/layers/vulkan \
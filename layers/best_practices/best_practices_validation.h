@@ -253,6 +253,8 @@ class DeviceMemory : public DEVICE_MEMORY_STATE {
                               physical_device_count) {}
 
     std::optional<float> dynamic_priority;  // VK_EXT_pageable_device_local_memory priority
+    // Last BestPractices::index_write_generation_ at which the host may have changed the contents, see ValidateIndexBufferArm
+    std::atomic<uint64_t> write_generation{0};
 };
 
 struct AttachmentInfo {
@@ -435,6 +437,13 @@ class BestPractices : public ValidationStateTracker {
     bool PreCallValidateBindImageMemory2KHR(VkDevice device, uint32_t bindInfoCount,
                                             const VkBindImageMemoryInfo* pBindInfos) const override;
     void PreCallRecordSetDeviceMemoryPriorityEXT(VkDevice device, VkDeviceMemory memory, float priority) override;
+    void PreCallRecordMapMemory(VkDevice device, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size,
+                                VkMemoryMapFlags flags, void** ppData) override;
+    void PreCallRecordMapMemory2KHR(VkDevice device, const VkMemoryMapInfoKHR* pMemoryMapInfo, void** ppData) override;
+    void PreCallRecordFlushMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount,
+                                              const VkMappedMemoryRange* pMemoryRanges) override;
+    void PreCallRecordInvalidateMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount,
+                                                   const VkMappedMemoryRange* pMemoryRanges) override;
     bool PreCallValidateGetVideoSessionMemoryRequirementsKHR(
         VkDevice device, VkVideoSessionKHR videoSession, uint32_t* pMemoryRequirementsCount,
         VkVideoSessionMemoryRequirementsKHR* pMemoryRequirements) const override;
@@ -874,6 +883,9 @@ class BestPractices : public ValidationStateTracker {
                                     VkFence* pFence) const override;
 
     void PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence) override;
+    void PreCallRecordQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR* pSubmits,
+                                      VkFence fence) override;
+    void PreCallRecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence) override;
 
     void PreCallRecordCmdClearAttachments(VkCommandBuffer commandBuffer, uint32_t attachmentCount,
                                           const VkClearAttachment* pClearAttachments, uint32_t rectCount,
@@ -965,8 +977,11 @@ class BestPractices : public ValidationStateTracker {
                                                                  const VkMemoryHeap& memory_heap,
                                                                  std::optional<DedicatedBinding>&& dedicated_binding,
                                                                  uint32_t physical_device_count) final {
-        return std::static_pointer_cast<DEVICE_MEMORY_STATE>(std::make_shared<bp_state::DeviceMemory>(
-            mem, p_alloc_info, fake_address, memory_type, memory_heap, std::move(dedicated_binding), physical_device_count));
+        auto mem_state = std::make_shared<bp_state::DeviceMemory>(mem, p_alloc_info, fake_address, memory_type, memory_heap,
+                                                                  std::move(dedicated_binding), physical_device_count);
+        // A new allocation may reuse the handle of a freed one with cached index scans
+        mem_state->write_generation = NextIndexWriteGeneration();
+        return std::static_pointer_cast<DEVICE_MEMORY_STATE>(mem_state);
     }
 
     std::shared_ptr<PIPELINE_STATE> CreateGraphicsPipelineState(const VkGraphicsPipelineCreateInfo* pCreateInfo,
@@ -996,6 +1011,43 @@ class BestPractices : public ValidationStateTracker {
         uint32_t iteration = 0;
     };
 
+    // Results of scanning an index buffer for ValidateIndexBufferArm. Draws commonly re-use the same index data, so the results
+    // are cached by the mapped memory range that was read. A result is only used while no map, flush, invalidate or queue
+    // submit happened since the scan, host writes to coherent memory with no API call in between aren't seen.
+    struct IndexBufferScanResult {
+        uint32_t min_index = ~0u;
+        uint32_t max_index = 0u;
+        uint32_t vertex_shade_count = 0;
+        // only counted when the index range is smaller than the index count, otherwise 0
+        uint32_t vertex_reference_count = 0;
+        // index_write_generation_ when the scan started
+        uint64_t generation = 0;
+    };
+
+    struct IndexBufferScanKey {
+        VkDeviceMemory memory;
+        VkDeviceSize offset;
+        uint32_t index_count;
+        VkIndexType index_type;
+        bool primitive_restart_enable;
+
+        bool operator==(const IndexBufferScanKey& rhs) const {
+            return memory == rhs.memory && offset == rhs.offset && index_count == rhs.index_count &&
+                   index_type == rhs.index_type && primitive_restart_enable == rhs.primitive_restart_enable;
+        }
+        size_t hash() const {
+            hash_util::HashCombiner hc;
+            hc << memory << offset << index_count << index_type << primitive_restart_enable;
+            return hc.Value();
+        }
+    };
+
+    uint64_t NextIndexWriteGeneration() { return index_write_generation_.fetch_add(1, std::memory_order_relaxed) + 1; }
+    void RecordIndexMemoryWrite(VkDeviceMemory memory);
+
+    template <typename IndexType>
+    static IndexBufferScanResult ScanIndexBufferArm(const IndexType* indices, uint32_t index_count, bool primitive_restart_enable);
+
     // Check that vendor-specific checks are enabled for at least one of the vendors
     bool VendorCheckEnabled(BPVendorFlags vendors) const;
     const char* VendorSpecificTag(BPVendorFlags vendors) const;
@@ -1087,4 +1139,16 @@ class BestPractices : public ValidationStateTracker {
 
     vvl::unordered_set<VkPipeline> pipelines_used_in_frame_;
     mutable std::shared_mutex pipeline_lock_;
+
+    // Arm tracked
+    // Bound the cache, streaming index data would otherwise grow it without limit.  The oldest range is evicted first.
+    static constexpr size_t kMaxIndexBufferScans = 4096;
+    mutable vvl::unordered_map<IndexBufferScanKey, IndexBufferScanResult, hash_util::HasHashMember<IndexBufferScanKey>>
+        index_buffer_scans_;
+    mutable std::deque<IndexBufferScanKey> index_buffer_scan_order_;
+    mutable std::shared_mutex index_buffer_scans_lock_;
+    // Bumped by anything that may change mapped index data, memory objects record the value of their last change
+    std::atomic<uint64_t> index_write_generation_{0};
+    // Queue submits may write any memory
+    std::atomic<uint64_t> submit_write_generation_{0};
 };
@@ -295,6 +295,38 @@ void BestPractices::PreCallRecordSetDeviceMemoryPriorityEXT(VkDevice device, VkD
     mem_info->dynamic_priority.emplace(priority);
 }
 
+void BestPractices::RecordIndexMemoryWrite(VkDeviceMemory memory) {
+    // Only the Arm index buffer checks read mapped memory
+    if (!VendorCheckEnabled(kBPVendorArm)) return;
+    auto mem_info = std::static_pointer_cast<bp_state::DeviceMemory>(Get<DEVICE_MEMORY_STATE>(memory));
+    if (mem_info) {
+        mem_info->write_generation = NextIndexWriteGeneration();
+    }
+}
+
+void BestPractices::PreCallRecordMapMemory(VkDevice device, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size,
+                                           VkMemoryMapFlags flags, void** ppData) {
+    RecordIndexMemoryWrite(memory);
+}
+
+void BestPractices::PreCallRecordMapMemory2KHR(VkDevice device, const VkMemoryMapInfoKHR* pMemoryMapInfo, void** ppData) {
+    RecordIndexMemoryWrite(pMemoryMapInfo->memory);
+}
+
+void BestPractices::PreCallRecordFlushMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount,
+                                                         const VkMappedMemoryRange* pMemoryRanges) {
+    for (uint32_t i = 0; i < memoryRangeCount; ++i) {
+        RecordIndexMemoryWrite(pMemoryRanges[i].memory);
+    }
+}
+
+void BestPractices::PreCallRecordInvalidateMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount,
+                                                              const VkMappedMemoryRange* pMemoryRanges) {
+    for (uint32_t i = 0; i < memoryRangeCount; ++i) {
+        RecordIndexMemoryWrite(pMemoryRanges[i].memory);
+    }
+}
+
 bool BestPractices::ValidateBindMemory(VkDevice device, VkDeviceMemory memory) const {
     bool skip = false;
 
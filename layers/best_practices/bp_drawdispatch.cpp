@@ -19,8 +19,9 @@
 
 #include "best_practices/best_practices_validation.h"
 #include "best_practices/best_practices_error_enums.h"
+#include "best_practices/bp_index_scan.h"
 
-#include <bitset>
+#include <limits>
 
 // Generic function to handle validation for all CmdDraw* type functions
 bool BestPractices::ValidateCmdDrawType(VkCommandBuffer cmd_buffer, const char* caller) const {
@@ -182,6 +183,45 @@ bool BestPractices::PostTransformLRUCacheModel::query_cache(uint32_t value) {
     return false;
 }
 
+template <typename IndexType>
+BestPractices::IndexBufferScanResult BestPractices::ScanIndexBufferArm(const IndexType* indices, uint32_t index_count,
+                                                                       bool primitive_restart_enable) {
+    IndexBufferScanResult result;
+    constexpr uint32_t primitive_restart_value = std::numeric_limits<IndexType>::max();
+
+    // Min and max are important to track for some Mali architectures. In older Mali devices without IDVS, all
+    // vertices corresponding to indices between the minimum and maximum may be loaded, and possibly shaded,
+    // irrespective of whether or not they're part of the draw call.
+    const bp_index_scan::MinMax min_max = bp_index_scan::IndexMinMax(indices, index_count);
+    result.min_index = min_max.min;
+    result.max_index = min_max.max;
+
+    // simulate a model LRU post-transform cache, estimating the number of vertices shaded for the given index buffer
+    PostTransformLRUCacheModel post_transform_cache;
+
+    // The size of the cache being modelled positively correlates with how much behaviour it can capture about
+    // arbitrary ground-truth hardware/architecture cache behaviour. I.e. it's a good solution when we don't know the
+    // target architecture.
+    // However, modelling a post-transform cache with more than 32 elements gives diminishing returns in practice.
+    // http://eelpi.gotdns.org/papers/fast_vert_cache_opt.html
+    post_transform_cache.resize(32);
+
+    for (uint32_t i = 0; i < index_count; ++i) {
+        const uint32_t scan_index = indices[i];
+        if (!primitive_restart_enable || scan_index != primitive_restart_value) {
+            const bool in_cache = post_transform_cache.query_cache(scan_index);
+            // if the shaded vertex corresponding to the index is not in the PT-cache, we need to shade again
+            if (!in_cache) result.vertex_shade_count++;
+        }
+    }
+
+    // Sparse index buffers are reported from the min/max alone, the set of referenced vertices is only needed otherwise
+    if (min_max.min < min_max.max && (min_max.max - min_max.min) < index_count) {
+        result.vertex_reference_count = bp_index_scan::CountDistinctIndices(indices, index_count, min_max);
+    }
+    return result;
+}
+
 bool BestPractices::ValidateIndexBufferArm(const bp_state::CommandBuffer& cmd_state, uint32_t indexCount, uint32_t instanceCount,
                                            uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance) const {
     bool skip = false;
@@ -210,54 +250,50 @@ bool BestPractices::ValidateIndexBufferArm(const bp_state::CommandBuffer& cmd_st
     if (ib_mem && last_bound.IsUsing()) {
         const uint32_t scan_stride = GetIndexAlignment(ib_type);
         const uint8_t* scan_begin = static_cast<const uint8_t*>(ib_mem) + ib_mem_offset + firstIndex * scan_stride;
-        const uint8_t* scan_end = scan_begin + indexCount * scan_stride;
-
-        // Min and max are important to track for some Mali architectures. In older Mali devices without IDVS, all
-        // vertices corresponding to indices between the minimum and maximum may be loaded, and possibly shaded,
-        // irrespective of whether or not they're part of the draw call.
 
-        // start with minimum as 0xFFFFFFFF and adjust to indices in the buffer
-        uint32_t min_index = ~0u;
-        // start with maximum as 0 and adjust to indices in the buffer
-        uint32_t max_index = 0u;
-
-        // first scan-through, we're looking to simulate a model LRU post-transform cache, estimating the number of vertices shaded
-        // for the given index buffer
-        uint32_t vertex_shade_count = 0;
-
-        PostTransformLRUCacheModel post_transform_cache;
-
-        // The size of the cache being modelled positively correlates with how much behaviour it can capture about
-        // arbitrary ground-truth hardware/architecture cache behaviour. I.e. it's a good solution when we don't know the
-        // target architecture.
-        // However, modelling a post-transform cache with more than 32 elements gives diminishing returns in practice.
-        // http://eelpi.gotdns.org/papers/fast_vert_cache_opt.html
-        post_transform_cache.resize(32);
-
-        for (const uint8_t* scan_ptr = scan_begin; scan_ptr < scan_end; scan_ptr += scan_stride) {
-            uint32_t scan_index;
-            uint32_t primitive_restart_value;
+        const IndexBufferScanKey key{ib_mem_state.mem(), ib_mem_offset + static_cast<VkDeviceSize>(firstIndex) * scan_stride,
+                                     indexCount, ib_type, primitive_restart_enable};
+        // A scan is stale once anything that may change the memory happened after it started
+        const uint64_t last_write = std::max(static_cast<const bp_state::DeviceMemory&>(ib_mem_state).write_generation.load(),
+                                             submit_write_generation_.load());
+        IndexBufferScanResult scan;
+        bool cached = false;
+        {
+            ReadLockGuard guard(index_buffer_scans_lock_);
+            const auto it = index_buffer_scans_.find(key);
+            if (it != index_buffer_scans_.end() && it->second.generation >= last_write) {
+                scan = it->second;
+                cached = true;
+            }
+        }
+        if (!cached) {
+            const uint64_t scan_generation = index_write_generation_.load();
             if (ib_type == VK_INDEX_TYPE_UINT8_EXT) {
-                scan_index = *reinterpret_cast<const uint8_t*>(scan_ptr);
-                primitive_restart_value = 0xFF;
+                scan = ScanIndexBufferArm(reinterpret_cast<const uint8_t*>(scan_begin), indexCount, primitive_restart_enable);
             } else if (ib_type == VK_INDEX_TYPE_UINT16) {
-                scan_index = *reinterpret_cast<const uint16_t*>(scan_ptr);
-                primitive_restart_value = 0xFFFF;
+                scan = ScanIndexBufferArm(reinterpret_cast<const uint16_t*>(scan_begin), indexCount, primitive_restart_enable);
             } else {
-                scan_index = *reinterpret_cast<const uint32_t*>(scan_ptr);
-                primitive_restart_value = 0xFFFFFFFF;
+                scan = ScanIndexBufferArm(reinterpret_cast<const uint32_t*>(scan_begin), indexCount, primitive_restart_enable);
             }
-
-            max_index = std::max(max_index, scan_index);
-            min_index = std::min(min_index, scan_index);
-
-            if (!primitive_restart_enable || scan_index != primitive_restart_value) {
-                const bool in_cache = post_transform_cache.query_cache(scan_index);
-                // if the shaded vertex corresponding to the index is not in the PT-cache, we need to shade again
-                if (!in_cache) vertex_shade_count++;
+            scan.generation = scan_generation;
+
+            WriteLockGuard guard(index_buffer_scans_lock_);
+            auto insert = index_buffer_scans_.emplace(key, scan);
+            if (insert.second) {
+                index_buffer_scan_order_.push_back(key);
+                if (index_buffer_scan_order_.size() > kMaxIndexBufferScans) {
+                    index_buffer_scans_.erase(index_buffer_scan_order_.front());
+                    index_buffer_scan_order_.pop_front();
+                }
+            } else if (insert.first->second.generation < scan_generation) {
+                // Replaced in place, the range keeps its place in the eviction order
+                insert.first->second = scan;
             }
         }
 
+        const uint32_t min_index = scan.min_index;
+        const uint32_t max_index = scan.max_index;
+
         // if the max and min values were not set, then we either have no indices, or all primitive restarts, exit...
         // if the max and min are the same, then it implies all the indices are the same, then we don't need to do anything
         if (max_index < min_index || max_index == min_index) return skip;
@@ -274,40 +310,8 @@ bool BestPractices::ValidateIndexBufferArm(const bp_state::CommandBuffer& cmd_st
             return skip;
         }
 
-        // use a dynamic vector of bitsets as a memory-compact representation of which indices are included in the draw call
-        // each bit of the n-th bucket contains the inclusion information for indices (n*n_buckets) to ((n+1)*n_buckets)
-        const size_t refs_per_bucket = 64;
-        std::vector<std::bitset<refs_per_bucket>> vertex_reference_buckets;
-
-        const uint32_t n_indices = max_index - min_index + 1;
-        const uint32_t n_buckets = (n_indices / static_cast<uint32_t>(refs_per_bucket)) +
-                                   ((n_indices % static_cast<uint32_t>(refs_per_bucket)) != 0 ? 1 : 0);
-
-        // there needs to be at least one bitset to store a set of indices smaller than n_buckets
-        vertex_reference_buckets.resize(std::max(1u, n_buckets));
-
-        // To avoid using too much memory, we run over the indices again.
-        // Knowing the size from the last scan allows us to record index usage with bitsets
-        for (const uint8_t* scan_ptr = scan_begin; scan_ptr < scan_end; scan_ptr += scan_stride) {
-            uint32_t scan_index;
-            if (ib_type == VK_INDEX_TYPE_UINT8_EXT) {
-                scan_index = *reinterpret_cast<const uint8_t*>(scan_ptr);
-            } else if (ib_type == VK_INDEX_TYPE_UINT16) {
-                scan_index = *reinterpret_cast<const uint16_t*>(scan_ptr);
-            } else {
-                scan_index = *reinterpret_cast<const uint32_t*>(scan_ptr);
-            }
-            // keep track of the set of all indices used to reference vertices in the draw call
-            size_t index_offset = scan_index - min_index;
-            size_t bitset_bucket_index = index_offset / refs_per_bucket;
-            uint64_t used_indices = 1ull << ((index_offset % refs_per_bucket) & 0xFFFFFFFFu);
-            vertex_reference_buckets[bitset_bucket_index] |= used_indices;
-        }
-
-        uint32_t vertex_reference_count = 0;
-        for (const auto& bitset : vertex_reference_buckets) {
-            vertex_reference_count += static_cast<uint32_t>(bitset.count());
-        }
+        const uint32_t vertex_reference_count = scan.vertex_reference_count;
+        const uint32_t vertex_shade_count = scan.vertex_shade_count;
 
         // low index buffer utilization implies that: of the vertices available to the draw call, not all are utilized
         float utilization = static_cast<float>(vertex_reference_count) / static_cast<float>(max_index - min_index + 1);
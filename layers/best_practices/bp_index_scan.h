@@ -0,0 +1,307 @@
+/* Copyright (c) 2023 The Khronos Group Inc.
+ * Copyright (c) 2023 Valve Corporation
+ * Copyright (c) 2023 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Index buffer scanning kernels for the Arm index buffer checks.
+//
+// The kernels are instantiated per index type, so the inner loops don't branch on the type.  The min/max reductions use the
+// widest vector extension the layer is compiled for (AVX2, SSE4.1 or SSE2 on x86, NEON on AArch64), there is no runtime
+// dispatch.  Every kernel has a scalar tail and a scalar fallback that produce identical results.
+#if defined(__AVX2__)
+#define BP_INDEX_SCAN_AVX2 1
+#endif
+#if defined(__SSE4_1__) || defined(__AVX__)
+#define BP_INDEX_SCAN_SSE41 1
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BP_INDEX_SCAN_SSE2 1
+#include <immintrin.h>
+#endif
+#if (defined(__aarch64__) && defined(__ARM_NEON)) || defined(_M_ARM64)
+#define BP_INDEX_SCAN_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace bp_index_scan {
+
+struct MinMax {
+    uint32_t min = ~0u;  // min > max when no indices were scanned
+    uint32_t max = 0u;
+
+    void Add(uint32_t value) {
+        min = std::min(min, value);
+        max = std::max(max, value);
+    }
+    void Add(const MinMax &other) {
+        min = std::min(min, other.min);
+        max = std::max(max, other.max);
+    }
+};
+
+template <typename IndexType>
+MinMax ScalarMinMax(const IndexType *indices, size_t count) {
+    MinMax result;
+    for (size_t i = 0; i < count; ++i) {
+        result.Add(indices[i]);
+    }
+    return result;
+}
+
+namespace detail {
+// Horizontal reduction of a vector register spilled to memory, only used once per scan
+template <typename Lane, size_t kLanes>
+void ReduceLanes(const Lane (&min_lanes)[kLanes], const Lane (&max_lanes)[kLanes], MinMax &result) {
+    for (size_t i = 0; i < kLanes; ++i) {
+        result.min = std::min<uint32_t>(result.min, min_lanes[i]);
+        result.max = std::max<uint32_t>(result.max, max_lanes[i]);
+    }
+}
+}  // namespace detail
+
+inline MinMax IndexMinMax(const uint8_t *indices, size_t count) {
+    MinMax result;
+    size_t i = 0;
+#if defined(BP_INDEX_SCAN_AVX2)
+    if (count - i >= 32) {
+        __m256i vmin = _mm256_set1_epi8(-1);
+        __m256i vmax = _mm256_setzero_si256();
+        for (; i + 32 <= count; i += 32) {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(indices + i));
+            vmin = _mm256_min_epu8(vmin, v);
+            vmax = _mm256_max_epu8(vmax, v);
+        }
+        uint8_t min_lanes[32], max_lanes[32];
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(min_lanes), vmin);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(max_lanes), vmax);
+        detail::ReduceLanes(min_lanes, max_lanes, result);
+    }
+#endif
+#if defined(BP_INDEX_SCAN_SSE2)
+    if (count - i >= 16) {
+        __m128i vmin = _mm_set1_epi8(-1);
+        __m128i vmax = _mm_setzero_si128();
+        for (; i + 16 <= count; i += 16) {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(indices + i));
+            vmin = _mm_min_epu8(vmin, v);
+            vmax = _mm_max_epu8(vmax, v);
+        }
+        uint8_t min_lanes[16], max_lanes[16];
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(min_lanes), vmin);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(max_lanes), vmax);
+        detail::ReduceLanes(min_lanes, max_lanes, result);
+    }
+#elif defined(BP_INDEX_SCAN_NEON)
+    if (count - i >= 16) {
+        uint8x16_t vmin = vdupq_n_u8(0xFF);
+        uint8x16_t vmax = vdupq_n_u8(0);
+        for (; i + 16 <= count; i += 16) {
+            const uint8x16_t v = vld1q_u8(indices + i);
+            vmin = vminq_u8(vmin, v);
+            vmax = vmaxq_u8(vmax, v);
+        }
+        result.Add(MinMax{vminvq_u8(vmin), vmaxvq_u8(vmax)});
+    }
+#endif
+    result.Add(ScalarMinMax(indices + i, count - i));
+    return result;
+}
+
+inline MinMax IndexMinMax(const uint16_t *indices, size_t count) {
+    MinMax result;
+    size_t i = 0;
+#if defined(BP_INDEX_SCAN_AVX2)
+    if (count - i >= 16) {
+        __m256i vmin = _mm256_set1_epi16(-1);
+        __m256i vmax = _mm256_setzero_si256();
+        for (; i + 16 <= count; i += 16) {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(indices + i));
+            vmin = _mm256_min_epu16(vmin, v);
+            vmax = _mm256_max_epu16(vmax, v);
+        }
+        uint16_t min_lanes[16], max_lanes[16];
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(min_lanes), vmin);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(max_lanes), vmax);
+        detail::ReduceLanes(min_lanes, max_lanes, result);
+    }
+#endif
+#if defined(BP_INDEX_SCAN_SSE41)
+    if (count - i >= 8) {
+        __m128i vmin = _mm_set1_epi16(-1);
+        __m128i vmax = _mm_setzero_si128();
+        for (; i + 8 <= count; i += 8) {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(indices + i));
+            vmin = _mm_min_epu16(vmin, v);
+            vmax = _mm_max_epu16(vmax, v);
+        }
+        uint16_t min_lanes[8], max_lanes[8];
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(min_lanes), vmin);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(max_lanes), vmax);
+        detail::ReduceLanes(min_lanes, max_lanes, result);
+    }
+#elif defined(BP_INDEX_SCAN_SSE2)
+    if (count - i >= 8) {
+        // SSE2 only has signed 16 bit min/max, flipping the sign bit maps unsigned order onto signed order
+        const __m128i bias = _mm_set1_epi16(static_cast<int16_t>(0x8000));
+        __m128i vmin = _mm_set1_epi16(0x7FFF);
+        __m128i vmax = _mm_set1_epi16(static_cast<int16_t>(0x8000));
+        for (; i + 8 <= count; i += 8) {
+            const __m128i v = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(indices + i)), bias);
+            vmin = _mm_min_epi16(vmin, v);
+            vmax = _mm_max_epi16(vmax, v);
+        }
+        uint16_t min_lanes[8], max_lanes[8];
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(min_lanes), _mm_xor_si128(vmin, bias));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(max_lanes), _mm_xor_si128(vmax, bias));
+        detail::ReduceLanes(min_lanes, max_lanes, result);
+    }
+#elif defined(BP_INDEX_SCAN_NEON)
+    if (count - i >= 8) {
+        uint16x8_t vmin = vdupq_n_u16(0xFFFF);
+        uint16x8_t vmax = vdupq_n_u16(0);
+        for (; i + 8 <= count; i += 8) {
+            const uint16x8_t v = vld1q_u16(indices + i);
+            vmin = vminq_u16(vmin, v);
+            vmax = vmaxq_u16(vmax, v);
+        }
+        result.Add(MinMax{vminvq_u16(vmin), vmaxvq_u16(vmax)});
+    }
+#endif
+    result.Add(ScalarMinMax(indices + i, count - i));
+    return result;
+}
+
+inline MinMax IndexMinMax(const uint32_t *indices, size_t count) {
+    MinMax result;
+    size_t i = 0;
+#if defined(BP_INDEX_SCAN_AVX2)
+    if (count - i >= 8) {
+        __m256i vmin = _mm256_set1_epi32(-1);
+        __m256i vmax = _mm256_setzero_si256();
+        for (; i + 8 <= count; i += 8) {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(indices + i));
+            vmin = _mm256_min_epu32(vmin, v);
+            vmax = _mm256_max_epu32(vmax, v);
+        }
+        uint32_t min_lanes[8], max_lanes[8];
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(min_lanes), vmin);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(max_lanes), vmax);
+        detail::ReduceLanes(min_lanes, max_lanes, result);
+    }
+#endif
+#if defined(BP_INDEX_SCAN_SSE41)
+    if (count - i >= 4) {
+        __m128i vmin = _mm_set1_epi32(-1);
+        __m128i vmax = _mm_setzero_si128();
+        for (; i + 4 <= count; i += 4) {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(indices + i));
+            vmin = _mm_min_epu32(vmin, v);
+            vmax = _mm_max_epu32(vmax, v);
+        }
+        uint32_t min_lanes[4], max_lanes[4];
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(min_lanes), vmin);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(max_lanes), vmax);
+        detail::ReduceLanes(min_lanes, max_lanes, result);
+    }
+#elif defined(BP_INDEX_SCAN_SSE2)
+    if (count - i >= 4) {
+        // No 32 bit min/max before SSE4.1, select with a (sign biased) compare instead
+        const __m128i bias = _mm_set1_epi32(static_cast<int32_t>(0x80000000u));
+        __m128i vmin = _mm_set1_epi32(0x7FFFFFFF);
+        __m128i vmax = bias;
+        for (; i + 4 <= count; i += 4) {
+            const __m128i v = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(indices + i)), bias);
+            const __m128i lt = _mm_cmplt_epi32(v, vmin);
+            vmin = _mm_or_si128(_mm_and_si128(lt, v), _mm_andnot_si128(lt, vmin));
+            const __m128i gt = _mm_cmpgt_epi32(v, vmax);
+            vmax = _mm_or_si128(_mm_and_si128(gt, v), _mm_andnot_si128(gt, vmax));
+        }
+        uint32_t min_lanes[4], max_lanes[4];
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(min_lanes), _mm_xor_si128(vmin, bias));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(max_lanes), _mm_xor_si128(vmax, bias));
+        detail::ReduceLanes(min_lanes, max_lanes, result);
+    }
+#elif defined(BP_INDEX_SCAN_NEON)
+    if (count - i >= 4) {
+        uint32x4_t vmin = vdupq_n_u32(0xFFFFFFFFu);
+        uint32x4_t vmax = vdupq_n_u32(0);
+        for (; i + 4 <= count; i += 4) {
+            const uint32x4_t v = vld1q_u32(indices + i);
+            vmin = vminq_u32(vmin, v);
+            vmax = vmaxq_u32(vmax, v);
+        }
+        result.Add(MinMax{vminvq_u32(vmin), vmaxvq_u32(vmax)});
+    }
+#endif
+    result.Add(ScalarMinMax(indices + i, count - i));
+    return result;
+}
+
+namespace detail {
+inline uint32_t PopCount(uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<uint32_t>(__builtin_popcountll(value));
+#else
+    return static_cast<uint32_t>(std::bitset<64>(value).count());
+#endif
+}
+
+template <typename IndexType>
+uint32_t PopulateBitmap(const IndexType *indices, size_t count, uint32_t base, uint64_t *words, size_t word_count) {
+    for (size_t i = 0; i < count; ++i) {
+        const uint32_t offset = static_cast<uint32_t>(indices[i]) - base;
+        words[offset >> 6] |= uint64_t(1) << (offset & 63);
+    }
+    // Four independent sums, so the popcounts don't serialize on a single accumulator
+    uint32_t sums[4] = {};
+    size_t w = 0;
+    for (; w + 4 <= word_count; w += 4) {
+        sums[0] += PopCount(words[w]);
+        sums[1] += PopCount(words[w + 1]);
+        sums[2] += PopCount(words[w + 2]);
+        sums[3] += PopCount(words[w + 3]);
+    }
+    for (; w < word_count; ++w) {
+        sums[0] += PopCount(words[w]);
+    }
+    return sums[0] + sums[1] + sums[2] + sums[3];
+}
+}  // namespace detail
+
+// Number of distinct values among the indices, all of which must be in [min_max.min, min_max.max]
+template <typename IndexType>
+uint32_t CountDistinctIndices(const IndexType *indices, size_t count, const MinMax &min_max) {
+    if (count == 0 || min_max.max < min_max.min) return 0;
+    const uint64_t range = uint64_t(min_max.max) - min_max.min + 1;
+    const size_t word_count = static_cast<size_t>((range + 63) / 64);
+    // Small ranges (including every 8 bit index buffer) stay on the stack
+    constexpr size_t kStackWords = 64;
+    if (word_count <= kStackWords) {
+        std::array<uint64_t, kStackWords> words = {};
+        return detail::PopulateBitmap(indices, count, min_max.min, words.data(), word_count);
+    }
+    std::vector<uint64_t> words(word_count, 0);
+    return detail::PopulateBitmap(indices, count, min_max.min, words.data(), word_count);
+}
+
+}  // namespace bp_index_scan
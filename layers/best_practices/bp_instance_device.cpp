@@ -370,6 +370,19 @@ void BestPractices::PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount
             cb->num_submits++;
         }
     }
+    // The submitted work may write mapped index data
+    submit_write_generation_ = NextIndexWriteGeneration();
+}
+
+void BestPractices::PreCallRecordQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR* pSubmits,
+                                                 VkFence fence) {
+    ValidationStateTracker::PreCallRecordQueueSubmit2KHR(queue, submitCount, pSubmits, fence);
+    submit_write_generation_ = NextIndexWriteGeneration();
+}
+
+void BestPractices::PreCallRecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits, VkFence fence) {
+    ValidationStateTracker::PreCallRecordQueueSubmit2(queue, submitCount, pSubmits, fence);
+    submit_write_generation_ = NextIndexWriteGeneration();
 }
 
 bool BestPractices::PreCallValidateQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits,
@@ -22,11 +22,15 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <limits>
 #include <map>
+#include <memory>
 #include <string>
 #include <sstream>
+#include <type_traits>
 #include <utility>
+#include <vector>
 #include <cstdint>
 #include "custom_containers.h"
 
@@ -743,6 +747,243 @@ class range_map {
     const ImplMap &get_implementation_map() const { return impl_map_; }
 };
 
+// Free list pool of small nodes, backing node_pool_allocator.
+//
+// Nodes of each size are carved from blocks that grow geometrically (so small maps stay small) up to kMaxBlockNodes, and freed
+// nodes are recycled LIFO, which keeps the working set of a heavily split/merged map in a handful of contiguous blocks instead of
+// one heap allocation per node.  Each node is preceded by a pointer to its block, so a block is released as soon as all of its
+// nodes are free, keeping at most one empty block per node size for reuse.  Not thread safe, as a pool is only ever shared by
+// the allocator copies of a single container.
+class node_pool {
+  public:
+    static constexpr size_t kMinBlockNodes = 4;
+    static constexpr size_t kMaxBlockNodes = 256;
+
+    node_pool() = default;
+    node_pool(const node_pool &) = delete;
+    node_pool &operator=(const node_pool &) = delete;
+    ~node_pool() {
+        for (const auto &size_class : size_classes_) {
+            for (Block *block : size_class->blocks) {
+                ::operator delete(block);
+            }
+        }
+    }
+
+    // align must not exceed alignof(std::max_align_t)
+    void *allocate(size_t size, size_t align) {
+        SizeClass &size_class = GetSizeClass(size, align);
+        Block *block = size_class.available;
+        if (!block) {
+            block = size_class.spare ? size_class.spare : AddBlock(size_class);
+            size_class.spare = nullptr;
+            Link(size_class, block);
+        }
+        FreeNode *node = block->free;
+        block->free = node->next;
+        ++block->live;
+        if (!block->free) Unlink(size_class, block);
+        return node;
+    }
+
+    void deallocate(void *p) {
+        Block *block = static_cast<Block *const *>(p)[-1];
+        SizeClass &size_class = *block->owner;
+        if (!block->free) Link(size_class, block);
+        auto *node = static_cast<FreeNode *>(p);
+        node->next = block->free;
+        block->free = node;
+        if (--block->live == 0) {
+            Unlink(size_class, block);
+            if (size_class.spare) {
+                Release(size_class, block);
+            } else {
+                size_class.spare = block;
+            }
+        }
+    }
+
+    // Nodes held in blocks, free or not, over all node sizes
+    size_t reserved_nodes() const {
+        size_t reserved = 0;
+        for (const auto &size_class : size_classes_) {
+            reserved += size_class->reserved;
+        }
+        return reserved;
+    }
+
+  private:
+    struct FreeNode {
+        FreeNode *next;
+    };
+    struct SizeClass;
+    struct Block {
+        SizeClass *owner;
+        Block *prev;  // links in owner->available
+        Block *next;
+        FreeNode *free;
+        size_t live;
+        size_t capacity;
+        size_t index;  // in owner->blocks
+    };
+    struct SizeClass {
+        size_t size;
+        size_t align;
+        size_t header;  // padding before each node, the last pointer of which holds the node's Block
+        size_t stride;
+        Block *available = nullptr;  // blocks with both live and free nodes
+        Block *spare = nullptr;      // a block with no live nodes
+        std::vector<Block *> blocks;
+        size_t reserved = 0;
+    };
+
+    static constexpr size_t RoundUp(size_t value, size_t align) { return ((value + align - 1) / align) * align; }
+
+    SizeClass &GetSizeClass(size_t size, size_t align) {
+        // Only a couple of node sizes are ever seen: the container's node, and its bookkeeping on some implementations
+        for (const auto &size_class : size_classes_) {
+            if (size_class->size == size && size_class->align == align) return *size_class;
+        }
+        auto size_class = std::make_unique<SizeClass>();
+        size_class->size = size;
+        size_class->align = align;
+        const size_t node_align = std::max({align, alignof(Block *), alignof(FreeNode)});
+        size_class->header = RoundUp(sizeof(Block *), node_align);
+        size_class->stride = size_class->header + RoundUp(std::max(size, sizeof(FreeNode)), node_align);
+        size_classes_.emplace_back(std::move(size_class));
+        return *size_classes_.back();
+    }
+
+    Block *AddBlock(SizeClass &size_class) {
+        // Keep the nodes following the block header suitably aligned
+        constexpr size_t kBlockHeader = RoundUp(sizeof(Block), alignof(std::max_align_t));
+        const size_t capacity = std::min(std::max(size_class.reserved, kMinBlockNodes), kMaxBlockNodes);
+        auto *block = static_cast<Block *>(::operator new(kBlockHeader + size_class.stride * capacity));
+        block->owner = &size_class;
+        block->prev = block->next = nullptr;
+        block->free = nullptr;
+        block->live = 0;
+        block->capacity = capacity;
+        block->index = size_class.blocks.size();
+        size_class.blocks.push_back(block);
+        size_class.reserved += capacity;
+
+        // Thread the new nodes onto the free list in address order
+        auto *bytes = reinterpret_cast<uint8_t *>(block) + kBlockHeader;
+        for (size_t i = capacity; i > 0; --i) {
+            uint8_t *node = bytes + (i - 1) * size_class.stride + size_class.header;
+            reinterpret_cast<Block **>(node)[-1] = block;
+            reinterpret_cast<FreeNode *>(node)->next = block->free;
+            block->free = reinterpret_cast<FreeNode *>(node);
+        }
+        return block;
+    }
+
+    void Release(SizeClass &size_class, Block *block) {
+        Block *last = size_class.blocks.back();
+        last->index = block->index;
+        size_class.blocks[block->index] = last;
+        size_class.blocks.pop_back();
+        size_class.reserved -= block->capacity;
+        ::operator delete(block);
+    }
+
+    static void Link(SizeClass &size_class, Block *block) {
+        block->prev = nullptr;
+        block->next = size_class.available;
+        if (size_class.available) size_class.available->prev = block;
+        size_class.available = block;
+    }
+    static void Unlink(SizeClass &size_class, Block *block) {
+        if (block->prev) {
+            block->prev->next = block->next;
+        } else {
+            size_class.available = block->next;
+        }
+        if (block->next) block->next->prev = block->prev;
+        block->prev = block->next = nullptr;
+    }
+
+    std::vector<std::unique_ptr<SizeClass>> size_classes_;
+};
+
+// Allocator for node based containers (std::map, std::set, ...) drawing single node allocations from a node_pool.
+//
+// The pool is only created when first needed, so an empty container costs no allocation.  Every copy and rebind of an allocator
+// shares its pool (creating it if needed), so a node can be freed through any of them (e.g. the MSVC debug iterator proxy
+// allocator) and the pool lives until the last one is gone.  The pool follows the container on move and swap, leaving the
+// moved-from container without one, and a copied container gets a fresh pool.
+template <typename T>
+class node_pool_allocator {
+  public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    using is_always_equal = std::false_type;
+
+    node_pool_allocator() noexcept = default;
+    node_pool_allocator(const node_pool_allocator &other) : pool_(other.SharedPool()) {}
+    node_pool_allocator(node_pool_allocator &&other) noexcept : pool_(std::move(other.pool_)) {}
+    template <typename U>
+    node_pool_allocator(const node_pool_allocator<U> &other) : pool_(other.SharedPool()) {}
+    node_pool_allocator &operator=(const node_pool_allocator &other) {
+        pool_ = other.SharedPool();
+        return *this;
+    }
+    node_pool_allocator &operator=(node_pool_allocator &&other) noexcept {
+        pool_ = std::move(other.pool_);
+        return *this;
+    }
+
+    node_pool_allocator select_on_container_copy_construction() const { return node_pool_allocator(); }
+
+    T *allocate(size_t n) {
+        if (n == 1 && alignof(T) <= alignof(std::max_align_t)) {
+            return static_cast<T *>(SharedPool()->allocate(sizeof(T), alignof(T)));
+        }
+        return static_cast<T *>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T *p, size_t n) noexcept {
+        if (n == 1 && alignof(T) <= alignof(std::max_align_t)) {
+            pool_->deallocate(p);
+        } else {
+            ::operator delete(p);
+        }
+    }
+
+    const node_pool &pool() const { return *SharedPool(); }
+
+    // Allocators without a pool yet have not allocated anything, so they are equal
+    template <typename U>
+    bool operator==(const node_pool_allocator<U> &rhs) const noexcept {
+        return pool_ == rhs.pool_;
+    }
+    template <typename U>
+    bool operator!=(const node_pool_allocator<U> &rhs) const noexcept {
+        return pool_ != rhs.pool_;
+    }
+
+  private:
+    template <typename U>
+    friend class node_pool_allocator;
+
+    // Only the allocator copies of a single container share a pool, so creating it on a const copy source is not a race
+    const std::shared_ptr<node_pool> &SharedPool() const {
+        if (!pool_) pool_ = std::make_shared<node_pool>();
+        return pool_;
+    }
+
+    mutable std::shared_ptr<node_pool> pool_;
+};
+
+// range_map with pooled nodes, an alternative to the default std::map ImplMap for maps which see heavy split/insert/erase traffic.
+// Keeps std::map iterator stability, which range_map, cached_lower_bound and parallel_iterator rely on.
+template <typename Key, typename T, typename RangeKey = range<Key>>
+using pooled_range_map =
+    range_map<Key, T, RangeKey, std::map<RangeKey, T, std::less<RangeKey>, node_pool_allocator<std::pair<const RangeKey, T>>>>;
+
 template <typename Container>
 using const_correct_iterator = decltype(std::declval<Container>().begin());
 
@@ -147,6 +147,11 @@ class RangeEncoder {
     inline const Subresource& Limits() const { return limits_; }
     inline const VkImageSubresourceRange& FullRange() const { return full_range_; }
     inline IndexType SubresourceCount() const { return AspectSize() * Limits().aspect_index; }
+    // A range covering every subresource encodes to the single index range [0, SubresourceCount())
+    inline bool IsFullRange(const VkImageSubresourceRange& range) const {
+        return (range.baseMipLevel == 0) && (range.levelCount == limits_.mipLevel) && (range.baseArrayLayer == 0) &&
+               (range.layerCount == limits_.arrayLayer) && ((range.aspectMask & limits_.aspectMask) == limits_.aspectMask);
+    }
     inline VkImageAspectFlags AspectMask() const { return limits_.aspectMask; }
     inline VkImageAspectFlagBits AspectBit(uint32_t aspect_index) const {
         RANGE_ASSERT(aspect_index < limits_.aspect_index);
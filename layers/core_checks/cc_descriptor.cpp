@@ -753,9 +753,14 @@ bool CoreChecks::ValidateDrawState(const DescriptorSet &descriptor_set, const Bi
 
 template <typename T>
 bool CoreChecks::ValidateDescriptors(const DescriptorContext &context, const DescriptorBindingInfo &binding_info,
-                                     const T &binding) const {
+                                     const T &binding, uint64_t min_version) const {
     bool skip = false;
     for (uint32_t index = 0; !skip && index < binding.count; index++) {
+        if (binding.GetVersion(index) < min_version) {
+            // Nothing in this block was written since it was last validated
+            index |= cvdescriptorset::DescriptorBinding::kVersionBlockSize - 1;
+            continue;
+        }
         const auto &descriptor = binding.descriptors[index];
 
         if (!binding.updated[index]) {
@@ -775,7 +780,7 @@ bool CoreChecks::ValidateDescriptors(const DescriptorContext &context, const Des
 }
 
 bool CoreChecks::ValidateDescriptorSetBindingData(const DescriptorContext &context, const DescriptorBindingInfo &binding_info,
-                                                  const cvdescriptorset::DescriptorBinding &binding) const {
+                                                  const cvdescriptorset::DescriptorBinding &binding, uint64_t min_version) const {
     using DescriptorClass = cvdescriptorset::DescriptorClass;
     bool skip = false;
     switch (binding.descriptor_class) {
@@ -783,23 +788,28 @@ bool CoreChecks::ValidateDescriptorSetBindingData(const DescriptorContext &conte
             // Can't validate the descriptor because it may not have been updated.
             break;
         case DescriptorClass::GeneralBuffer:
-            skip = ValidateDescriptors(context, binding_info, static_cast<const cvdescriptorset::BufferBinding &>(binding));
+            skip = ValidateDescriptors(context, binding_info, static_cast<const cvdescriptorset::BufferBinding &>(binding),
+                                       min_version);
             break;
         case DescriptorClass::ImageSampler:
-            skip = ValidateDescriptors(context, binding_info, static_cast<const cvdescriptorset::ImageSamplerBinding &>(binding));
+            skip = ValidateDescriptors(context, binding_info, static_cast<const cvdescriptorset::ImageSamplerBinding &>(binding),
+                                       min_version);
             break;
         case DescriptorClass::Image:
-            skip = ValidateDescriptors(context, binding_info, static_cast<const cvdescriptorset::ImageBinding &>(binding));
+            skip = ValidateDescriptors(context, binding_info, static_cast<const cvdescriptorset::ImageBinding &>(binding),
+                                       min_version);
             break;
         case DescriptorClass::PlainSampler:
-            skip = ValidateDescriptors(context, binding_info, static_cast<const cvdescriptorset::SamplerBinding &>(binding));
+            skip = ValidateDescriptors(context, binding_info, static_cast<const cvdescriptorset::SamplerBinding &>(binding),
+                                       min_version);
             break;
         case DescriptorClass::TexelBuffer:
-            skip = ValidateDescriptors(context, binding_info, static_cast<const cvdescriptorset::TexelBinding &>(binding));
+            skip = ValidateDescriptors(context, binding_info, static_cast<const cvdescriptorset::TexelBinding &>(binding),
+                                       min_version);
             break;
         case DescriptorClass::AccelerationStructure:
             skip = ValidateDescriptors(context, binding_info,
-                                       static_cast<const cvdescriptorset::AccelerationStructureBinding &>(binding));
+                                       static_cast<const cvdescriptorset::AccelerationStructureBinding &>(binding), min_version);
             break;
         default:
             break;
@@ -19,7 +19,6 @@
  * This file deals with anything related to Phyiscal Devices, Logical Devices, or Device Queues Families, Device Masks, etc
  */
 
-#include <fstream>
 #include <string>
 #include <sys/stat.h>
 #include <vector>
@@ -460,22 +459,13 @@ void CoreChecks::CreateDevice(const VkDeviceCreateInfo *pCreateInfo) {
 #endif
         validation_cache_path += ".bin";
 
-        std::vector<char> validation_cache_data;
-        std::ifstream read_file(validation_cache_path.c_str(), std::ios::in | std::ios::binary);
-
-        if (read_file) {
-            std::copy(std::istreambuf_iterator<char>(read_file), {}, std::back_inserter(validation_cache_data));
-            read_file.close();
-        } else {
-            LogInfo(device, "UNASSIGNED-cache-file-error",
-                    "Cannot open shader validation cache at %s for reading (it may not exist yet)", validation_cache_path.c_str());
+        // Loaded from the file if it exists, then every shader that passes is appended to it
+        std::string error;
+        core_validation_cache =
+            ValidationCache::CreatePersistent(validation_cache_path, ValidationCache::kDefaultMaxEntries, error);
+        if (!error.empty()) {
+            LogInfo(device, "UNASSIGNED-cache-file-error", "Shader validation cache will not be saved, %s", error.c_str());
         }
-
-        VkValidationCacheCreateInfoEXT cacheCreateInfo = LvlInitStruct<VkValidationCacheCreateInfoEXT>();
-        cacheCreateInfo.initialDataSize = validation_cache_data.size();
-        cacheCreateInfo.pInitialData = validation_cache_data.data();
-        cacheCreateInfo.flags = 0;
-        CoreLayerCreateValidationCacheEXT(device, &cacheCreateInfo, nullptr, &core_validation_cache);
     }
 }
 
@@ -485,37 +475,11 @@ void CoreChecks::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationC
     StateTracker::PreCallRecordDestroyDevice(device, pAllocator);
 
     if (core_validation_cache) {
-        size_t validation_cache_size = 0;
-        void *validation_cache_data = nullptr;
-
-        CoreLayerGetValidationCacheDataEXT(device, core_validation_cache, &validation_cache_size, nullptr);
-
-        validation_cache_data = (char *)malloc(sizeof(char) * validation_cache_size);
-        if (!validation_cache_data) {
-            LogInfo(device, "UNASSIGNED-cache-memory-error", "Validation Cache Memory Error");
-            return;
-        }
-
-        VkResult result =
-            CoreLayerGetValidationCacheDataEXT(device, core_validation_cache, &validation_cache_size, validation_cache_data);
-
-        if (result != VK_SUCCESS) {
-            LogInfo(device, "UNASSIGNED-cache-retrieval-error", "Validation Cache Retrieval Error");
-            free(validation_cache_data);
-            return;
-        }
-
-        if (validation_cache_path.size() > 0) {
-            std::ofstream write_file(validation_cache_path.c_str(), std::ios::out | std::ios::binary);
-            if (write_file) {
-                write_file.write(static_cast<char *>(validation_cache_data), validation_cache_size);
-                write_file.close();
-            } else {
-                LogInfo(device, "UNASSIGNED-cache-write-error", "Cannot open shader validation cache at %s for writing",
-                        validation_cache_path.c_str());
-            }
+        // Everything was already appended to the file, rewrite it without the hashes that were evicted
+        std::string error;
+        if (!CastFromHandle<ValidationCache *>(core_validation_cache)->Compact(error)) {
+            LogInfo(device, "UNASSIGNED-cache-write-error", "Cannot compact shader validation cache, %s", error.c_str());
         }
-        free(validation_cache_data);
         CoreLayerDestroyValidationCacheEXT(device, core_validation_cache, NULL);
     }
 }
@@ -3426,6 +3426,69 @@ bool CoreChecks::PreCallValidateCmdDrawMeshTasksIndirectCountEXT(VkCommandBuffer
     return skip;
 }
 
+// Checks of ValidateCmdBufDrawState that are skipped while they passed and their inputs are unchanged, so back to back draws
+// that only change push constants or draw parameters do not revalidate the whole draw state
+enum DrawStateCheck : uint32_t {
+    kDrawCheckDescriptorMode = 0x1,
+    kDrawCheckGraphicsState = 0x2,
+    kDrawCheckProtectedAttachments = 0x4,
+    kDrawCheckDescriptorSets = 0x8,
+    kDrawCheckPushConstants = 0x10,
+};
+
+struct DrawStateCheckInputs {
+    DrawStateCheck check;
+    DrawStateDirtyFlags inputs;
+};
+
+// clang-format off
+static constexpr std::array<DrawStateCheckInputs, 5> kDrawStateCheckInputs = {{
+    {kDrawCheckDescriptorMode, DRAW_STATE_DIRTY_PIPELINE | DRAW_STATE_DIRTY_DESCRIPTOR_SETS},
+    {kDrawCheckGraphicsState, DRAW_STATE_DIRTY_ALL & ~DRAW_STATE_DIRTY_PUSH_CONSTANTS},
+    {kDrawCheckProtectedAttachments, DRAW_STATE_DIRTY_RENDER_PASS | DRAW_STATE_DIRTY_OTHER},
+    // Also revalidated when a bound set is updated or an image layout changes, see DrawStateCache::descriptor_change_count
+    {kDrawCheckDescriptorSets, DRAW_STATE_DIRTY_ALL & ~(DRAW_STATE_DIRTY_PUSH_CONSTANTS | DRAW_STATE_DIRTY_VERTEX_INPUT)},
+    {kDrawCheckPushConstants, DRAW_STATE_DIRTY_PIPELINE | DRAW_STATE_DIRTY_DESCRIPTOR_SETS | DRAW_STATE_DIRTY_PUSH_CONSTANTS},
+}};
+// clang-format on
+
+// Drops the checks whose inputs changed since the previous draw of this bind point
+static void UpdateDrawStateCache(const CMD_BUFFER_STATE &cb_state, const LAST_BOUND_STATE &last_bound_state, CMD_TYPE cmd_type) {
+    auto &cache = last_bound_state.draw_state_cache;
+    uint64_t descriptor_change_count = cb_state.image_layout_change_count;
+    for (const auto &set_info : last_bound_state.per_set) {
+        if (set_info.bound_descriptor_set) {
+            descriptor_change_count += set_info.bound_descriptor_set->GetChangeCount();
+        }
+    }
+    // The VUIDs and some checks depend on the command, and an invalidated command buffer may refer to destroyed objects
+    if (cache.cmd_type != cmd_type || cb_state.state != CB_RECORDING) {
+        cache.passed_checks = 0;
+    }
+    for (const auto &check_inputs : kDrawStateCheckInputs) {
+        if (cache.dirty & check_inputs.inputs) {
+            cache.passed_checks &= ~check_inputs.check;
+        }
+    }
+    // Change counts only grow, so the sum stays the same only if none of them changed
+    if (cache.descriptor_change_count != descriptor_change_count) {
+        cache.passed_checks &= ~kDrawCheckDescriptorSets;
+    }
+    cache.dirty = 0;
+    cache.cmd_type = cmd_type;
+    cache.descriptor_change_count = descriptor_change_count;
+}
+
+static void PassDrawStateCheck(const LAST_BOUND_STATE &last_bound_state, DrawStateCheck check, uint64_t message_count) {
+    if (LogMsgAttemptCount() == message_count) {
+        last_bound_state.draw_state_cache.passed_checks |= check;
+    }
+}
+
+static bool NeedsDrawStateCheck(const LAST_BOUND_STATE &last_bound_state, DrawStateCheck check) {
+    return (last_bound_state.draw_state_cache.passed_checks & check) == 0;
+}
+
 // Validate overall state at the time of a draw call
 bool CoreChecks::ValidateCmdBufDrawState(const CMD_BUFFER_STATE &cb_state, CMD_TYPE cmd_type,
                                          const VkPipelineBindPoint bind_point) const {
@@ -3448,36 +3511,47 @@ bool CoreChecks::ValidateCmdBufDrawState(const CMD_BUFFER_STATE &cb_state, CMD_T
     const PIPELINE_STATE &pipeline = *last_pipeline;
 
     bool skip = false;
+    UpdateDrawStateCache(cb_state, last_bound_state, cmd_type);
+    uint64_t message_count = LogMsgAttemptCount();
+
+    if (NeedsDrawStateCheck(last_bound_state, kDrawCheckDescriptorMode)) {
+        for (const auto &ds : last_bound_state.per_set) {
+            if (pipeline.descriptor_buffer_mode) {
+                if (ds.bound_descriptor_set && !ds.bound_descriptor_set->IsPushDescriptor()) {
+                    const LogObjectList objlist(cb_state.Handle(), pipeline.Handle(), ds.bound_descriptor_set->Handle());
+                    skip |= LogError(objlist, vuid.descriptor_buffer_set_offset_missing_08117,
+                                     "%s: pipeline bound to %s requires a descriptor buffer but has a bound descriptor set (%s)",
+                                     function, string_VkPipelineBindPoint(bind_point),
+                                     report_data->FormatHandle(ds.bound_descriptor_set->Handle()).c_str());
+                    break;
+                }
 
-    for (const auto &ds : last_bound_state.per_set) {
-        if (pipeline.descriptor_buffer_mode) {
-            if (ds.bound_descriptor_set && !ds.bound_descriptor_set->IsPushDescriptor()) {
-                const LogObjectList objlist(cb_state.Handle(), pipeline.Handle(), ds.bound_descriptor_set->Handle());
-                skip |= LogError(objlist, vuid.descriptor_buffer_set_offset_missing_08117,
-                                 "%s: pipeline bound to %s requires a descriptor buffer but has a bound descriptor set (%s)",
-                                 function, string_VkPipelineBindPoint(bind_point),
-                                 report_data->FormatHandle(ds.bound_descriptor_set->Handle()).c_str());
-                break;
-            }
-
-        } else {
-            if (ds.bound_descriptor_buffer.has_value()) {
-                const LogObjectList objlist(cb_state.Handle(), pipeline.Handle());
-                skip |= LogError(objlist, vuid.descriptor_buffer_bit_not_set_08115,
-                                 "%s: pipeline bound to %s requires a descriptor set but has a bound descriptor buffer"
-                                 " (index=%" PRIu32 " offset=%" PRIu64 ")",
-                                 function, string_VkPipelineBindPoint(bind_point), ds.bound_descriptor_buffer->index,
-                                 ds.bound_descriptor_buffer->offset);
-                break;
+            } else {
+                if (ds.bound_descriptor_buffer.has_value()) {
+                    const LogObjectList objlist(cb_state.Handle(), pipeline.Handle());
+                    skip |= LogError(objlist, vuid.descriptor_buffer_bit_not_set_08115,
+                                     "%s: pipeline bound to %s requires a descriptor set but has a bound descriptor buffer"
+                                     " (index=%" PRIu32 " offset=%" PRIu64 ")",
+                                     function, string_VkPipelineBindPoint(bind_point), ds.bound_descriptor_buffer->index,
+                                     ds.bound_descriptor_buffer->offset);
+                    break;
+                }
             }
         }
+        PassDrawStateCheck(last_bound_state, kDrawCheckDescriptorMode, message_count);
     }
 
     if (VK_PIPELINE_BIND_POINT_GRAPHICS == bind_point) {
-        skip |= ValidateDrawDynamicState(last_bound_state, cmd_type);
-        skip |= ValidatePipelineDrawtimeState(last_bound_state, cmd_type);
+        if (NeedsDrawStateCheck(last_bound_state, kDrawCheckGraphicsState)) {
+            message_count = LogMsgAttemptCount();
+            skip |= ValidateDrawDynamicState(last_bound_state, cmd_type);
+            skip |= ValidatePipelineDrawtimeState(last_bound_state, cmd_type);
+            PassDrawStateCheck(last_bound_state, kDrawCheckGraphicsState, message_count);
+        }
 
-        if (cb_state.activeRenderPass && cb_state.activeFramebuffer) {
+        if (cb_state.activeRenderPass && cb_state.activeFramebuffer &&
+            NeedsDrawStateCheck(last_bound_state, kDrawCheckProtectedAttachments)) {
+            message_count = LogMsgAttemptCount();
             // Verify attachments for unprotected/protected command buffer.
             if (enabled_features.core11.protectedMemory == VK_TRUE && cb_state.active_attachments) {
                 uint32_t i = 0;
@@ -3499,6 +3573,7 @@ bool CoreChecks::ValidateCmdBufDrawState(const CMD_BUFFER_STATE &cb_state, CMD_T
                     ++i;
                 }
             }
+            PassDrawStateCheck(last_bound_state, kDrawCheckProtectedAttachments, message_count);
         }
     }
     // Now complete other state checks
@@ -3506,27 +3581,35 @@ bool CoreChecks::ValidateCmdBufDrawState(const CMD_BUFFER_STATE &cb_state, CMD_T
     auto const &pipeline_layout = pipeline.PipelineLayoutState();
 
     // Check if the current pipeline is compatible for the maximum used set with the bound sets.
-    if (!pipeline.descriptor_buffer_mode) {
+    if (!pipeline.descriptor_buffer_mode && NeedsDrawStateCheck(last_bound_state, kDrawCheckDescriptorSets)) {
+        message_count = LogMsgAttemptCount();
         if (!pipeline.active_slots.empty() && !IsBoundSetCompat(pipeline.max_active_slot, last_bound_state, *pipeline_layout)) {
             LogObjectList objlist(pipeline.pipeline());
             const auto layouts = pipeline.PipelineLayoutStateUnion();
-            std::ostringstream pipe_layouts_log;
             if (layouts.size() > 1) {
-                pipe_layouts_log << "a union of layouts [ ";
                 for (const auto &layout : layouts) {
                     objlist.add(layout->layout());
-                    pipe_layouts_log << report_data->FormatHandle(layout->layout()) << " ";
                 }
-                pipe_layouts_log << "]";
-            } else {
-                pipe_layouts_log << report_data->FormatHandle(layouts.front()->layout());
             }
             objlist.add(last_bound_state.pipeline_layout);
-            skip |= LogError(objlist, vuid.compatible_pipeline_02697,
-                             "%s(): The %s (created with %s) statically uses descriptor set (index #%" PRIu32
-                             ") which is not compatible with the currently bound descriptor set's pipeline layout (%s)",
-                             function, report_data->FormatHandle(pipeline.pipeline()).c_str(), pipe_layouts_log.str().c_str(),
-                             pipeline.max_active_slot, report_data->FormatHandle(last_bound_state.pipeline_layout).c_str());
+            // This fires on every draw until the app rebinds, only build the layout list if the message is reported
+            skip |= LogErrorDeferred(objlist, vuid.compatible_pipeline_02697, [&]() {
+                std::ostringstream pipe_layouts_log;
+                if (layouts.size() > 1) {
+                    pipe_layouts_log << "a union of layouts [ ";
+                    for (const auto &layout : layouts) {
+                        pipe_layouts_log << report_data->FormatHandle(layout->layout()) << " ";
+                    }
+                    pipe_layouts_log << "]";
+                } else {
+                    pipe_layouts_log << report_data->FormatHandle(layouts.front()->layout());
+                }
+                return FormatString(
+                    "%s(): The %s (created with %s) statically uses descriptor set (index #%" PRIu32
+                    ") which is not compatible with the currently bound descriptor set's pipeline layout (%s)",
+                    function, report_data->FormatHandle(pipeline.pipeline()).c_str(), pipe_layouts_log.str().c_str(),
+                    pipeline.max_active_slot, report_data->FormatHandle(last_bound_state.pipeline_layout).c_str());
+            });
         } else {
             // if the bound set is not copmatible, the rest will just be extra redundant errors
             for (const auto &set_binding_pair : pipeline.active_slots) {
@@ -3596,13 +3679,16 @@ bool CoreChecks::ValidateCmdBufDrawState(const CMD_BUFFER_STATE &cb_state, CMD_T
                 }
             }
         }
+        PassDrawStateCheck(last_bound_state, kDrawCheckDescriptorSets, message_count);
     }
 
     // Verify if push constants have been set
     // NOTE: Currently not checking whether active push constants are compatible with the active pipeline, nor whether the
     //       "life times" of push constants are correct.
     //       Discussion on validity of these checks can be found at https://gitlab.khronos.org/vulkan/vulkan/-/issues/2602.
-    if (!cb_state.push_constant_data_ranges || (pipeline_layout->push_constant_ranges == cb_state.push_constant_data_ranges)) {
+    if (NeedsDrawStateCheck(last_bound_state, kDrawCheckPushConstants) &&
+        (!cb_state.push_constant_data_ranges || (pipeline_layout->push_constant_ranges == cb_state.push_constant_data_ranges))) {
+        message_count = LogMsgAttemptCount();
         for (const auto &stage : pipeline.stage_states) {
             if (!stage.entrypoint || !stage.entrypoint->push_constant_variable) {
                 continue;  // no static push constant in shader
@@ -3618,6 +3704,7 @@ bool CoreChecks::ValidateCmdBufDrawState(const CMD_BUFFER_STATE &cb_state, CMD_T
                                  report_data->FormatHandle(pipeline_layout->layout()).c_str());
             }
         }
+        PassDrawStateCheck(last_bound_state, kDrawCheckPushConstants, message_count);
     }
 
     return skip;
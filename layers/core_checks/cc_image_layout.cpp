@@ -311,29 +311,17 @@ bool CoreChecks::ValidateCmdBufImageLayouts(const Location &loc, const CMD_BUFFE
         assert(global_map);
         auto global_map_guard = global_map->ReadLock();
 
-        // Note: don't know if it would matter
-        // if (global_map->empty() && overlay_map->empty()) // skip this next loop...;
-
-        auto pos = layout_map.begin();
-        const auto end = layout_map.end();
-        sparse_container::parallel_iterator<const GlobalImageLayoutRangeMap> current_layout(*overlay_map, *global_map,
-                                                                                            pos->first.begin);
-        while (pos != end) {
-            VkImageLayout initial_layout = pos->second.initial_layout;
-            assert(initial_layout != image_layout_map::kInvalidLayout);
-            if (initial_layout == image_layout_map::kInvalidLayout) {
-                continue;
-            }
-
-            VkImageLayout image_layout = kInvalidLayout;
+        // Unless an earlier command buffer of this submission used the image, the result only depends on the global layouts,
+        // so there is nothing to do if they are unchanged since this command buffer was last validated against them
+        const bool global_only = overlay_map->empty();
+        const uint64_t epoch = global_map->GetEpoch();
+        if (global_only && subres_map->GetValidatedEpoch() == epoch) {
+            sparse_container::splice(*overlay_map, subres_map->GetLayoutMap(), GlobalLayoutUpdater());
+            continue;
+        }
+        const uint64_t message_count = LogMsgAttemptCount();
 
-            if (current_layout->range.empty()) break;  // When we are past the end of data in overlay and global... stop looking
-            if (current_layout->pos_A->valid) {        // pos_A denotes the overlay map in the parallel iterator
-                image_layout = current_layout->pos_A->lower_bound->second;
-            } else if (current_layout->pos_B->valid) {  // pos_B denotes the global map in the parallel iterator
-                image_layout = current_layout->pos_B->lower_bound->second;
-            }
-            const auto intersected_range = pos->first & current_layout->range;
+        auto validate_range = [&](const LayoutRange &intersected_range, VkImageLayout initial_layout, VkImageLayout image_layout) {
             if (initial_layout == VK_IMAGE_LAYOUT_UNDEFINED) {
                 // TODO: Set memory invalid which is in mem_tracker currently
             } else if (image_layout != initial_layout) {
@@ -341,7 +329,7 @@ bool CoreChecks::ValidateCmdBufImageLayouts(const Location &loc, const CMD_BUFFE
                 const bool matches = ImageLayoutMatches(aspect_mask, image_layout, initial_layout);
                 if (!matches) {
                     // We can report all the errors for the intersected range directly
-                    for (auto index : sparse_container::range_view<decltype(intersected_range)>(intersected_range)) {
+                    for (auto index : sparse_container::range_view<LayoutRange>(intersected_range)) {
                         const auto subresource = image_state->subresource_encoder.Decode(index);
                         skip |= LogError(cb_state.commandBuffer(), kVUID_Core_DrawState_InvalidImageLayout,
                                          "%s command buffer %s expects %s (subresource: aspectMask 0x%x array layer %" PRIu32
@@ -355,15 +343,53 @@ bool CoreChecks::ValidateCmdBufImageLayouts(const Location &loc, const CMD_BUFFE
                     }
                 }
             }
-            if (pos->first.includes(intersected_range.end)) {
-                current_layout.seek(intersected_range.end);
-            } else {
-                ++pos;
-                if (pos != end) {
-                    current_layout.seek(pos->first.begin);
+        };
+
+        if (global_only && global_map->size() == 1) {
+            // The whole image is in a single layout, so every range can be compared against it directly
+            const auto &global_entry = *global_map->begin();
+            for (const auto &entry : layout_map) {
+                assert(entry.second.initial_layout != image_layout_map::kInvalidLayout);
+                const auto intersected_range = entry.first & global_entry.first;
+                if (intersected_range.non_empty()) {
+                    validate_range(intersected_range, entry.second.initial_layout, global_entry.second);
+                }
+            }
+        } else {
+            auto pos = layout_map.begin();
+            const auto end = layout_map.end();
+            sparse_container::parallel_iterator<const GlobalImageLayoutRangeMap> current_layout(*overlay_map, *global_map,
+                                                                                                pos->first.begin);
+            while (pos != end) {
+                VkImageLayout initial_layout = pos->second.initial_layout;
+                assert(initial_layout != image_layout_map::kInvalidLayout);
+                if (initial_layout == image_layout_map::kInvalidLayout) {
+                    continue;
+                }
+
+                VkImageLayout image_layout = kInvalidLayout;
+
+                if (current_layout->range.empty()) break;  // When we are past the end of data in overlay and global... stop looking
+                if (current_layout->pos_A->valid) {        // pos_A denotes the overlay map in the parallel iterator
+                    image_layout = current_layout->pos_A->lower_bound->second;
+                } else if (current_layout->pos_B->valid) {  // pos_B denotes the global map in the parallel iterator
+                    image_layout = current_layout->pos_B->lower_bound->second;
+                }
+                const auto intersected_range = pos->first & current_layout->range;
+                validate_range(intersected_range, initial_layout, image_layout);
+                if (pos->first.includes(intersected_range.end)) {
+                    current_layout.seek(intersected_range.end);
+                } else {
+                    ++pos;
+                    if (pos != end) {
+                        current_layout.seek(pos->first.begin);
+                    }
                 }
             }
         }
+        if (global_only && LogMsgAttemptCount() == message_count) {
+            subres_map->SetValidatedEpoch(epoch);
+        }
         // Update all layout set operations (which will be a subset of the initial_layouts)
         sparse_container::splice(*overlay_map, subres_map->GetLayoutMap(), GlobalLayoutUpdater());
     }
@@ -376,7 +402,9 @@ void CoreChecks::UpdateCmdBufImageLayouts(const CMD_BUFFER_STATE *cb_state) {
         const auto *image_state = layout_map_entry.first;
         const auto &subres_map = layout_map_entry.second;
         auto guard = image_state->layout_range_map->WriteLock();
-        sparse_container::splice(*image_state->layout_range_map, subres_map->GetLayoutMap(), GlobalLayoutUpdater());
+        if (sparse_container::splice(*image_state->layout_range_map, subres_map->GetLayoutMap(), GlobalLayoutUpdater())) {
+            image_state->layout_range_map->NextEpoch();
+        }
     }
 }
 
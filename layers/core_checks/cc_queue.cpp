@@ -69,13 +69,26 @@ struct CommandBufferSubmitState {
                                                       false,  // This is submit time not record time...
                                                       checked_layouts};
 
-                for (const auto &binding_info : cmd_info.binding_infos) {
-                    std::string error;
+                for (size_t i = 0; i < cmd_info.binding_infos.size(); ++i) {
+                    const auto &binding_info = cmd_info.binding_infos[i];
                     if (set_node->GetTotalDescriptorCount() > cvdescriptorset::PrefilterBindRequestMap::kManyDescriptors_) {
                         context.checked_layouts.emplace();
                     }
                     const auto *binding = set_node->GetBinding(binding_info.first);
-                    skip |= core->ValidateDescriptorSetBindingData(context, binding_info, *binding);
+
+                    // Only the descriptors written since this binding was last validated clean for this draw need to be
+                    // checked again, unless a resource was invalidated or the result depends on samplers in other bindings
+                    const uint64_t change_count = set_node->GetChangeCount();
+                    uint64_t min_version = cmd_info.validated_versions[i];
+                    if (set_node->GetInvalidatedVersion() >= min_version ||
+                        (!binding_info.second.variable->samplers_used_by_image.empty() && change_count >= min_version)) {
+                        min_version = 0;
+                    }
+                    const uint64_t message_count = LogMsgAttemptCount();
+                    skip |= core->ValidateDescriptorSetBindingData(context, binding_info, *binding, min_version);
+                    if (LogMsgAttemptCount() == message_count) {
+                        cmd_info.validated_versions[i] = change_count + 1;
+                    }
                 }
             }
         }
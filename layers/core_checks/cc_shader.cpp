@@ -19,8 +19,10 @@
 
 #include "cc_shader.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cinttypes>
+#include <cstring>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -30,7 +32,6 @@
 #include "generated/chassis.h"
 #include "core_validation.h"
 #include "generated/spirv_grammar_helper.h"
-#include "external/xxhash.h"
 
 bool CoreChecks::ValidateViAgainstVsInputs(const PIPELINE_STATE &pipeline, const SHADER_MODULE_STATE &module_state,
                                            const EntryPoint &entrypoint) const {
@@ -3050,8 +3051,6 @@ bool CoreChecks::GroupHasValidIndex(const PIPELINE_STATE &pipeline, uint32_t gro
     return false;
 }
 
-uint32_t ValidationCache::MakeShaderHash(VkShaderModuleCreateInfo const *smci) { return XXH32(smci->pCode, smci->codeSize, 0); }
-
 static ValidationCache *GetValidationCacheInfo(VkShaderModuleCreateInfo const *pCreateInfo) {
     const auto validation_cache_ci = LvlFindInChain<VkShaderModuleValidationCacheCreateInfoEXT>(pCreateInfo->pNext);
     if (validation_cache_ci) {
@@ -3076,17 +3075,18 @@ bool CoreChecks::PreCallValidateCreateShaderModule(VkDevice device, const VkShad
                          "SPIR-V module not valid: Codesize must be a multiple of 4 but is %zu", pCreateInfo->codeSize);
     } else {
         auto cache = GetValidationCacheInfo(pCreateInfo);
-        uint32_t hash = 0;
+        uint64_t hash = 0;
+        spv_target_env spirv_environment = PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4));
         // If app isn't using a shader validation cache, use the default one from CoreChecks
         if (!cache) cache = CastFromHandle<ValidationCache *>(core_validation_cache);
         if (cache) {
-            hash = ValidationCache::MakeShaderHash(pCreateInfo);
+            const uint32_t options_key = ValidatorOptionsKey(device_extensions, enabled_features, spirv_environment);
+            hash = ValidationCache::MakeShaderHash(pCreateInfo, options_key);
             if (cache->Contains(hash)) return false;
         }
 
         // Use SPIRV-Tools validator to try and catch any issues with the module itself. If specialization constants are present,
         // the default values will be used during validation.
-        spv_target_env spirv_environment = PickSpirvEnv(api_version, IsExtEnabled(device_extensions.vk_khr_spirv_1_4));
         spv_context ctx = spvContextCreate(spirv_environment);
         spv_const_binary_t binary{pCreateInfo->pCode, pCreateInfo->codeSize / sizeof(uint32_t)};
         spv_diagnostic diag = nullptr;
@@ -3384,31 +3384,61 @@ spv_target_env PickSpirvEnv(APIVersion api_version, bool spirv_1_4) {
 }
 
 // Some Vulkan extensions/features are just all done in spirv-val behind optional settings
-void AdjustValidatorOptions(const DeviceExtensions &device_extensions, const DeviceFeatures &enabled_features,
-                            spvtools::ValidatorOptions &options) {
+// spirv-val options that depend on the device, one bit each
+enum ValidatorOptionBits : uint32_t {
+    kRelaxBlockLayout = 1 << 0,
+    kUniformBufferStandardLayout = 1 << 1,
+    kScalarBlockLayout = 1 << 2,
+    kWorkgroupScalarBlockLayout = 1 << 3,
+    kAllowLocalSizeId = 1 << 4,
+};
+
+static uint32_t GetValidatorOptionBits(const DeviceExtensions &device_extensions, const DeviceFeatures &enabled_features) {
+    uint32_t bits = 0;
     // VK_KHR_relaxed_block_layout never had a feature bit so just enabling the extension allows relaxed layout
     // Was promotoed in Vulkan 1.1 so anyone using Vulkan 1.1 also gets this for free
     if (IsExtEnabled(device_extensions.vk_khr_relaxed_block_layout)) {
-        // --relax-block-layout
-        options.SetRelaxBlockLayout(true);
+        bits |= kRelaxBlockLayout;
     }
 
     // The rest of the settings are controlled from a feature bit, which are set correctly in the state tracking. Regardless of
     // Vulkan version used, the feature bit is needed (also described in the spec).
 
     if (enabled_features.core12.uniformBufferStandardLayout == VK_TRUE) {
+        bits |= kUniformBufferStandardLayout;
+    }
+    if (enabled_features.core12.scalarBlockLayout == VK_TRUE) {
+        bits |= kScalarBlockLayout;
+    }
+    if (enabled_features.workgroup_memory_explicit_layout_features.workgroupMemoryExplicitLayoutScalarBlockLayout) {
+        bits |= kWorkgroupScalarBlockLayout;
+    }
+    if (enabled_features.core13.maintenance4) {
+        bits |= kAllowLocalSizeId;
+    }
+    return bits;
+}
+
+void AdjustValidatorOptions(const DeviceExtensions &device_extensions, const DeviceFeatures &enabled_features,
+                            spvtools::ValidatorOptions &options) {
+    const uint32_t bits = GetValidatorOptionBits(device_extensions, enabled_features);
+    if (bits & kRelaxBlockLayout) {
+        // --relax-block-layout
+        options.SetRelaxBlockLayout(true);
+    }
+    if (bits & kUniformBufferStandardLayout) {
         // --uniform-buffer-standard-layout
         options.SetUniformBufferStandardLayout(true);
     }
-    if (enabled_features.core12.scalarBlockLayout == VK_TRUE) {
+    if (bits & kScalarBlockLayout) {
         // --scalar-block-layout
         options.SetScalarBlockLayout(true);
     }
-    if (enabled_features.workgroup_memory_explicit_layout_features.workgroupMemoryExplicitLayoutScalarBlockLayout) {
+    if (bits & kWorkgroupScalarBlockLayout) {
         // --workgroup-scalar-block-layout
         options.SetWorkgroupScalarBlockLayout(true);
     }
-    if (enabled_features.core13.maintenance4) {
+    if (bits & kAllowLocalSizeId) {
         // --allow-localsizeid
         options.SetAllowLocalSizeId(true);
     }
@@ -3416,3 +3446,9 @@ void AdjustValidatorOptions(const DeviceExtensions &device_extensions, const Dev
     // Faster validation without friendly names.
     options.SetFriendlyNames(false);
 }
+
+// Identifies everything besides the SPIR-V that decides if spirv-val passes, part of the ValidationCache hash
+uint32_t ValidatorOptionsKey(const DeviceExtensions &device_extensions, const DeviceFeatures &enabled_features,
+                             spv_target_env spirv_environment) {
+    return GetValidatorOptionBits(device_extensions, enabled_features) | (static_cast<uint32_t>(spirv_environment) << 16);
+}
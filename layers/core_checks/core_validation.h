@@ -791,11 +791,13 @@ class CoreChecks : public ValidationStateTracker {
     };
     using DescriptorBindingInfo = std::pair<const uint32_t, DescriptorRequirement>;
 
+    // Descriptors whose version (see cvdescriptorset::DescriptorBinding::GetVersion()) is below min_version are skipped
     bool ValidateDescriptorSetBindingData(const DescriptorContext& context, const DescriptorBindingInfo& binding_info,
-                                          const cvdescriptorset::DescriptorBinding& binding) const;
+                                          const cvdescriptorset::DescriptorBinding& binding, uint64_t min_version = 0) const;
 
     template <typename T>
-    bool ValidateDescriptors(const DescriptorContext& context, const DescriptorBindingInfo& binding_info, const T& binding) const;
+    bool ValidateDescriptors(const DescriptorContext& context, const DescriptorBindingInfo& binding_info, const T& binding,
+                             uint64_t min_version) const;
 
     bool ValidateDescriptor(const DescriptorContext& context, const DescriptorBindingInfo& binding_info, uint32_t index,
                             VkDescriptorType descriptor_type, const cvdescriptorset::BufferDescriptor& descriptor) const;
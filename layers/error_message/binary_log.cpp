@@ -0,0 +1,398 @@
+/* Copyright (c) 2023 The Khronos Group Inc.
+ * Copyright (c) 2023 Valve Corporation
+ * Copyright (c) 2023 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "binary_log.h"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstring>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+using namespace binary_log;
+
+static uint64_t NowNs() {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+}
+
+template <typename T>
+static void Append(std::string &record, T value) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    record.append(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+template <typename T>
+static void Store(std::string &record, size_t offset, T value) {
+    std::memcpy(record.data() + offset, &value, sizeof(T));
+}
+
+// precision is the printf precision of the conversion or -1, a string with a precision doesn't need a terminator
+static void AppendString(std::string &record, const char *str, int precision) {
+    if (!str) {
+        str = "(null)";
+    }
+    const size_t max_length = precision >= 0 ? std::min(static_cast<size_t>(precision), size_t(kMaxStringArgument))
+                                             : size_t(kMaxStringArgument);
+    const uint32_t length = static_cast<uint32_t>(strnlen(str, max_length));
+    Append<uint8_t>(record, kString);
+    Append<uint32_t>(record, length);
+    record.append(str, length);
+}
+
+// Pulls the arguments out of argptr following the conversions in format, the same way vsnprintf() would.
+// Returns the number of arguments appended to record.
+static uint16_t AppendArguments(std::string &record, const char *format, va_list argptr) {
+    uint16_t count = 0;
+    for (const char *c = format; *c; ++c) {
+        if (*c != '%') {
+            continue;
+        }
+        ++c;
+        if (*c == '%') {
+            continue;
+        }
+        while (*c && std::strchr("-+ #0", *c)) {
+            ++c;
+        }
+        // A '*' width or precision is passed as an int argument ahead of the value
+        if (*c == '*') {
+            Append<uint8_t>(record, kSigned);
+            Append<int64_t>(record, va_arg(argptr, int));
+            ++count;
+            ++c;
+        }
+        while (*c >= '0' && *c <= '9') {
+            ++c;
+        }
+        // A negative '*' precision is taken as if the precision were omitted
+        int precision = -1;
+        if (*c == '.') {
+            ++c;
+            precision = 0;
+            if (*c == '*') {
+                precision = va_arg(argptr, int);
+                Append<uint8_t>(record, kSigned);
+                Append<int64_t>(record, precision);
+                ++count;
+                ++c;
+            }
+            while (*c >= '0' && *c <= '9') {
+                precision = std::min(precision * 10 + (*c - '0'), static_cast<int>(kMaxStringArgument));
+                ++c;
+            }
+        }
+        int longs = 0;
+        bool size_t_arg = false;
+        bool long_double = false;
+        for (;; ++c) {
+            if (*c == 'l') {
+                ++longs;
+            } else if (*c == 'z' || *c == 'j' || *c == 't') {
+                size_t_arg = true;
+            } else if (*c == 'L') {
+                long_double = true;
+            } else if (*c != 'h') {
+                break;
+            }
+        }
+        switch (*c) {
+            case 'd':
+            case 'i': {
+                int64_t value;
+                if (size_t_arg) {
+                    value = static_cast<int64_t>(va_arg(argptr, ptrdiff_t));
+                } else if (longs >= 2) {
+                    value = va_arg(argptr, long long);
+                } else if (longs == 1) {
+                    value = va_arg(argptr, long);
+                } else {
+                    value = va_arg(argptr, int);
+                }
+                Append<uint8_t>(record, kSigned);
+                Append<int64_t>(record, value);
+                break;
+            }
+            case 'u':
+            case 'o':
+            case 'x':
+            case 'X':
+            case 'c': {
+                uint64_t value;
+                if (size_t_arg) {
+                    value = va_arg(argptr, size_t);
+                } else if (longs >= 2) {
+                    value = va_arg(argptr, unsigned long long);
+                } else if (longs == 1) {
+                    value = va_arg(argptr, unsigned long);
+                } else {
+                    value = va_arg(argptr, unsigned int);
+                }
+                Append<uint8_t>(record, kUnsigned);
+                Append<uint64_t>(record, value);
+                break;
+            }
+            case 'f':
+            case 'F':
+            case 'e':
+            case 'E':
+            case 'g':
+            case 'G':
+            case 'a':
+            case 'A': {
+                const double value = long_double ? static_cast<double>(va_arg(argptr, long double)) : va_arg(argptr, double);
+                Append<uint8_t>(record, kDouble);
+                Append<double>(record, value);
+                break;
+            }
+            case 's':
+                AppendString(record, va_arg(argptr, const char *), precision);
+                break;
+            case 'p':
+                Append<uint8_t>(record, kPointer);
+                Append<uint64_t>(record, reinterpret_cast<uintptr_t>(va_arg(argptr, void *)));
+                break;
+            case 'n':
+                // Nothing is printed, the pointer is never written through
+                (void)va_arg(argptr, void *);
+                continue;
+            default:
+                // Malformed conversion, stop before misreading the rest of the arguments
+                return count;
+        }
+        ++count;
+    }
+    return count;
+}
+
+std::shared_ptr<BinaryMessageLog> BinaryMessageLog::Create(const char *filename, uint64_t file_size, VkFlags msg_flags,
+                                                           std::string &error) {
+    // The ring must hold a good number of maximum size records for the tail walk in Commit() to stay cheap
+    constexpr uint64_t kMinFileSize = 1024 * 1024;
+    file_size = std::max(file_size, kMinFileSize);
+
+    std::shared_ptr<BinaryMessageLog> log(new BinaryMessageLog());
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(filename, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        error = "could not create the file";
+        return nullptr;
+    }
+    log->file_handle_ = file;
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READWRITE, static_cast<DWORD>(file_size >> 32),
+                                        static_cast<DWORD>(file_size & 0xFFFFFFFF), nullptr);
+    if (!mapping) {
+        error = "could not size the file";
+        return nullptr;
+    }
+    log->mapping_handle_ = mapping;
+    void *view = MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, static_cast<SIZE_T>(file_size));
+    if (!view) {
+        error = "could not map the file";
+        return nullptr;
+    }
+#else
+    const int fd = open(filename, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        error = "could not create the file";
+        return nullptr;
+    }
+    log->fd_ = fd;
+    if (ftruncate(fd, static_cast<off_t>(file_size)) != 0) {
+        error = "could not size the file";
+        return nullptr;
+    }
+    void *view = mmap(nullptr, static_cast<size_t>(file_size), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (view == MAP_FAILED) {
+        error = "could not map the file";
+        return nullptr;
+    }
+#endif
+    log->mapping_ = static_cast<uint8_t *>(view);
+    log->mapping_size_ = file_size;
+
+    // An eighth of the file for the dictionary is far more than the layer has distinct format strings and VUIDs
+    const uint64_t dictionary_capacity = ((file_size - kHeaderSize) / 8) & ~uint64_t(7);
+    FileHeader header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.header_size = static_cast<uint32_t>(kHeaderSize);
+    header.dictionary_offset = kHeaderSize;
+    header.dictionary_capacity = dictionary_capacity;
+    header.ring_offset = kHeaderSize + dictionary_capacity;
+    header.ring_capacity = file_size - header.ring_offset;
+    header.start_time_ns = NowNs();
+    log->header_ = reinterpret_cast<FileHeader *>(log->mapping_);
+    *log->header_ = header;
+
+    DebugReportFlagsToAnnotFlags(msg_flags, &log->severities_, &log->types_);
+    return log;
+}
+
+BinaryMessageLog::~BinaryMessageLog() {
+#if defined(_WIN32)
+    if (mapping_) {
+        FlushViewOfFile(mapping_, 0);
+        UnmapViewOfFile(mapping_);
+    }
+    if (mapping_handle_) {
+        CloseHandle(mapping_handle_);
+    }
+    if (file_handle_) {
+        CloseHandle(file_handle_);
+    }
+#else
+    if (mapping_) {
+        msync(mapping_, static_cast<size_t>(mapping_size_), MS_SYNC);
+        munmap(mapping_, static_cast<size_t>(mapping_size_));
+    }
+    if (fd_ >= 0) {
+        close(fd_);
+    }
+#endif
+}
+
+void BinaryMessageLog::BeginRecord(std::string &record, VkFlags msg_flags, const LogObjectList &objects) {
+    const uint8_t object_count = static_cast<uint8_t>(std::min<size_t>(objects.object_list.size(), UINT8_MAX));
+    record.clear();
+    Append<uint32_t>(record, 0);  // size, patched in Commit()
+    Append<uint8_t>(record, static_cast<uint8_t>(msg_flags));
+    Append<uint8_t>(record, object_count);
+    Append<uint16_t>(record, 0);  // argument count
+    Append<uint32_t>(record, 0);  // VUID hash
+    Append<uint32_t>(record, 0);  // format id
+    Append<uint64_t>(record, NowNs() - header_->start_time_ns);
+    assert(record.size() == kRecordHeaderSize);
+    for (uint32_t i = 0; i < object_count; ++i) {
+        Append<uint32_t>(record, static_cast<uint32_t>(ConvertVulkanObjectToCoreObject(objects.object_list[i].type)));
+        Append<uint64_t>(record, objects.object_list[i].handle);
+    }
+}
+
+void BinaryMessageLog::Write(VkFlags msg_flags, const LogObjectList &objects, std::string_view vuid_text, const char *format,
+                             va_list argptr) {
+    // Everything except the dictionary lookups and the copy into the ring happens outside of the lock
+    thread_local std::string record;
+    BeginRecord(record, msg_flags, objects);
+    const uint16_t arg_count = AppendArguments(record, format, argptr);
+    Commit(record, vuid_text, format, arg_count);
+}
+
+void BinaryMessageLog::WriteText(VkFlags msg_flags, const LogObjectList &objects, std::string_view vuid_text,
+                                 std::string_view message) {
+    static constexpr const char kTextFormat[] = "%s";
+    thread_local std::string record;
+    BeginRecord(record, msg_flags, objects);
+    const uint32_t length = static_cast<uint32_t>(std::min<size_t>(message.size(), kMaxStringArgument));
+    Append<uint8_t>(record, kString);
+    Append<uint32_t>(record, length);
+    record.append(message.data(), length);
+    Commit(record, vuid_text, kTextFormat, 1);
+}
+
+bool BinaryMessageLog::AddDictionaryEntry(DictionaryEntryType type, uint32_t id, std::string_view text) {
+    const uint64_t size = (12 + text.size() + 7) & ~uint64_t(7);
+    if (header_->dictionary_used + size > header_->dictionary_capacity) {
+        return false;
+    }
+    uint8_t *entry = mapping_ + header_->dictionary_offset + header_->dictionary_used;
+    const uint32_t entry_size = static_cast<uint32_t>(size);
+    std::memcpy(entry, &entry_size, sizeof(entry_size));
+    entry[4] = type;
+    entry[5] = entry[6] = entry[7] = 0;
+    std::memcpy(entry + 8, &id, sizeof(id));
+    std::memcpy(entry + 12, text.data(), text.size());
+    std::memset(entry + 12 + text.size(), 0, size - 12 - text.size());
+    header_->dictionary_used += size;
+    return true;
+}
+
+void BinaryMessageLog::RingWrite(uint64_t logical_offset, const void *data, uint64_t size) {
+    const uint64_t capacity = header_->ring_capacity;
+    const uint64_t position = logical_offset % capacity;
+    const uint64_t first = std::min(size, capacity - position);
+    uint8_t *ring = mapping_ + header_->ring_offset;
+    std::memcpy(ring + position, data, static_cast<size_t>(first));
+    if (first < size) {
+        std::memcpy(ring, static_cast<const uint8_t *>(data) + first, static_cast<size_t>(size - first));
+    }
+}
+
+uint32_t BinaryMessageLog::RingReadSize(uint64_t logical_offset) const {
+    const uint64_t capacity = header_->ring_capacity;
+    const uint8_t *ring = mapping_ + header_->ring_offset;
+    uint8_t bytes[sizeof(uint32_t)];
+    for (uint64_t i = 0; i < sizeof(bytes); ++i) {
+        bytes[i] = ring[(logical_offset + i) % capacity];
+    }
+    uint32_t size;
+    std::memcpy(&size, bytes, sizeof(size));
+    return size;
+}
+
+uint32_t BinaryMessageLog::FormatId(std::string_view format) {
+    auto &entries = format_ids_[std::hash<std::string_view>()(format)];
+    for (const auto &entry : entries) {
+        if (entry.text == format) {
+            return entry.id;
+        }
+    }
+    // Id 0 is left for messages whose format string did not fit in the dictionary
+    uint32_t format_id = ++format_count_;
+    if (!AddDictionaryEntry(kFormatString, format_id, format)) {
+        format_id = 0;
+        header_->dropped_count++;
+    }
+    entries.push_back({std::string(format), format_id});
+    return format_id;
+}
+
+void BinaryMessageLog::Commit(std::string &record, std::string_view vuid_text, const char *format, uint16_t arg_count) {
+    const uint32_t vuid_hash = vvl_vuid_hash(vuid_text);
+    const uint32_t record_size = static_cast<uint32_t>(record.size());
+    Store<uint32_t>(record, 0, record_size);
+    Store<uint16_t>(record, 6, arg_count);
+    Store<uint32_t>(record, 8, vuid_hash);
+
+    std::lock_guard<std::mutex> guard(lock_);
+    if (record_size > header_->ring_capacity / 16) {
+        header_->dropped_count++;
+        return;
+    }
+    Store<uint32_t>(record, 12, FormatId(format));
+    if (known_vuids_.insert(vuid_hash).second) {
+        AddDictionaryEntry(kVuid, vuid_hash, vuid_text);
+    }
+
+    // Overwrite the oldest records to make room
+    while (header_->ring_head + record_size - header_->ring_tail > header_->ring_capacity) {
+        header_->ring_tail += RingReadSize(header_->ring_tail);
+    }
+    RingWrite(header_->ring_head, record.data(), record_size);
+    header_->ring_head += record_size;
+    header_->record_count++;
+}
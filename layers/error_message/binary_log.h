@@ -0,0 +1,136 @@
+/* Copyright (c) 2023 The Khronos Group Inc.
+ * Copyright (c) 2023 Valve Corporation
+ * Copyright (c) 2023 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdarg>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "logging.h"
+
+// Binary message log, written by VK_DBG_LAYER_ACTION_LOG_BINARY instead of formatting text.
+//
+// The file is memory mapped and laid out as a fixed size header, an append-only dictionary holding the
+// format strings and VUID names, and a ring of message records that overwrites the oldest records once full.
+// Messages keep their printf format string id and the raw arguments, formatting is left to
+// scripts/decode_binary_log.py. All values are little endian. Keep the decoder in sync with this layout.
+namespace binary_log {
+
+static constexpr char kMagic[8] = {'V', 'V', 'L', 'B', 'L', 'O', 'G', '1'};
+static constexpr uint32_t kVersion = 1;
+static constexpr uint64_t kHeaderSize = 4096;
+
+struct FileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t header_size;
+    uint64_t dictionary_offset;
+    uint64_t dictionary_capacity;
+    uint64_t dictionary_used;
+    uint64_t ring_offset;
+    uint64_t ring_capacity;
+    uint64_t ring_head;  // logical bytes ever written, the next record starts at ring_head % ring_capacity
+    uint64_t ring_tail;  // logical offset of the oldest record still in the ring
+    uint64_t record_count;
+    uint64_t dropped_count;  // records lost because they were too big or the dictionary was full
+    uint64_t start_time_ns;  // system clock, the timestamp of every record is relative to this
+};
+static_assert(sizeof(FileHeader) <= kHeaderSize, "binary log header does not fit");
+
+// Dictionary entry: uint32_t size, uint8_t type, 3 bytes padding, uint32_t id, then the text without a terminator
+enum DictionaryEntryType : uint8_t {
+    kFormatString = 1,  // id is the format id used by messages
+    kVuid = 2,          // id is the VUID hash
+};
+
+// Message record: uint32_t size, uint8_t msg_flags, uint8_t object count, uint16_t argument count,
+// uint32_t VUID hash, uint32_t format id, uint64_t timestamp (ns), then the objects (uint32_t VkObjectType,
+// uint64_t handle) and the arguments (uint8_t ArgumentKind followed by its value)
+static constexpr uint32_t kRecordHeaderSize = 24;
+static constexpr uint32_t kObjectSize = 12;
+
+enum ArgumentKind : uint8_t {
+    kSigned = 1,    // int64_t
+    kUnsigned = 2,  // uint64_t
+    kDouble = 3,    // double
+    kString = 4,    // uint32_t length, then the bytes
+    kPointer = 5,   // uint64_t
+};
+
+// Arguments longer than this are truncated, so one record can never take a large part of the ring
+static constexpr uint32_t kMaxStringArgument = 4096;
+
+}  // namespace binary_log
+
+class BinaryMessageLog {
+  public:
+    // Returns nullptr and sets error if the file could not be created and mapped
+    static std::shared_ptr<BinaryMessageLog> Create(const char *filename, uint64_t file_size, VkFlags msg_flags,
+                                                    std::string &error);
+    ~BinaryMessageLog();
+
+    BinaryMessageLog(const BinaryMessageLog &) = delete;
+    BinaryMessageLog &operator=(const BinaryMessageLog &) = delete;
+
+    VkDebugUtilsMessageSeverityFlagsEXT Severities() const { return severities_; }
+    VkDebugUtilsMessageTypeFlagsEXT Types() const { return types_; }
+    bool Accepts(VkDebugUtilsMessageSeverityFlagsEXT severity, VkDebugUtilsMessageTypeFlagsEXT type) const {
+        return (severities_ & severity) && (types_ & type);
+    }
+
+    // argptr is consumed
+    void Write(VkFlags msg_flags, const LogObjectList &objects, std::string_view vuid_text, const char *format, va_list argptr);
+    // For messages that are formatted before they reach the log
+    void WriteText(VkFlags msg_flags, const LogObjectList &objects, std::string_view vuid_text, std::string_view message);
+
+  private:
+    BinaryMessageLog() = default;
+
+    void BeginRecord(std::string &record, VkFlags msg_flags, const LogObjectList &objects);
+    void Commit(std::string &record, std::string_view vuid_text, const char *format, uint16_t arg_count);
+    bool AddDictionaryEntry(binary_log::DictionaryEntryType type, uint32_t id, std::string_view text);
+    void RingWrite(uint64_t logical_offset, const void *data, uint64_t size);
+    uint32_t RingReadSize(uint64_t logical_offset) const;
+    // Called with lock_ held
+    uint32_t FormatId(std::string_view format);
+
+    uint8_t *mapping_ = nullptr;
+    uint64_t mapping_size_ = 0;
+    binary_log::FileHeader *header_ = nullptr;
+#if defined(_WIN32)
+    void *file_handle_ = nullptr;
+    void *mapping_handle_ = nullptr;
+#else
+    int fd_ = -1;
+#endif
+    VkDebugUtilsMessageSeverityFlagsEXT severities_ = 0;
+    VkDebugUtilsMessageTypeFlagsEXT types_ = 0;
+
+    std::mutex lock_;
+    // Keyed by the hash of the format text, not its address, some formats are built at runtime and their buffers reused
+    struct FormatEntry {
+        std::string text;
+        uint32_t id;
+    };
+    vvl::unordered_map<size_t, std::vector<FormatEntry>> format_ids_;
+    uint32_t format_count_ = 0;
+    vvl::unordered_set<uint32_t> known_vuids_;
+};
@@ -18,10 +18,13 @@
 
 #include <csignal>
 #include <cstring>
+#include <unordered_map>
 #ifdef VK_USE_PLATFORM_WIN32_KHR
 #include <debugapi.h>
 #endif
 
+#include "binary_log.h"
+#include "utils/vk_layer_utils.h"
 #include "generated/vk_enum_string_helper.h"
 #include "generated/vk_safe_struct.h"
 #include "generated/vk_validation_error_messages.h"
@@ -59,22 +62,295 @@ VKAPI_ATTR void RemoveDebugUtilsCallback(debug_report_data *debug_data, std::vec
     SetDebugUtilsSeverityFlags(callbacks, debug_data);
 }
 
-// Returns TRUE if the number of times this message has been logged is over the set limit
-static bool UpdateLogMsgCounts(const debug_report_data *debug_data, int32_t vuid_hash) {
-    auto vuid_count_it = debug_data->duplicate_message_count_map.find(vuid_hash);
-    if (vuid_count_it == debug_data->duplicate_message_count_map.end()) {
-        debug_data->duplicate_message_count_map.emplace(vuid_hash, 1);
-        return false;
+struct DebugObjectNames::Impl {
+    struct Name {
+        std::string text;
+        uint32_t refs = 0;  // handles named with it, guarded by lock
+    };
+
+    std::mutex lock;  // serializes Set()
+    // Keyed by a view of Name::text. The names are heap allocated, so an interned name never moves.
+    std::unordered_map<std::string_view, std::unique_ptr<Name>> pool;
+    vl_concurrent_lockfree_map<uint64_t, const Name *> names;
+    vl_deferred_reclaimer<Name> reclaimer;
+
+    const Name *Acquire(std::string_view text) {
+        auto it = pool.find(text);
+        if (it == pool.end()) {
+            auto name = std::make_unique<Name>();
+            name->text = text;
+            const std::string_view key(name->text);
+            it = pool.emplace(key, std::move(name)).first;
+        }
+        ++it->second->refs;
+        return it->second.get();
+    }
+
+    // Readers may still hold the name, so it is only unpublished here and freed once no ReadGuard can see it
+    void Release(const Name *name) {
+        auto it = pool.find(name->text);
+        if (--it->second->refs == 0) {
+            auto unused = std::move(it->second);
+            pool.erase(it);
+            reclaimer.Retire(std::move(unused));
+        }
+    }
+};
+
+DebugObjectNames::ReadGuard::ReadGuard(const DebugObjectNames &names)
+    : names_(names), ticket_(names.impl_->reclaimer.Enter()) {}
+DebugObjectNames::ReadGuard::~ReadGuard() { names_.impl_->reclaimer.Leave(ticket_); }
+
+DebugObjectNames::DebugObjectNames() : impl_(std::make_unique<Impl>()) {}
+DebugObjectNames::~DebugObjectNames() = default;
+
+void DebugObjectNames::Set(uint64_t handle, const char *name) {
+    // 0 and ~0 are reserved keys of the map, neither is a handle that can be named
+    if (handle == 0 || handle == ~uint64_t(0)) {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(impl_->lock);
+    const auto found = impl_->names.find(handle);
+    const Impl::Name *old_name = (found != impl_->names.end()) ? found->second : nullptr;
+    if (name) {
+        // Taken before the old name is released, so renaming to the same name keeps it
+        impl_->names.insert_or_assign(handle, impl_->Acquire(name));
+    } else {
+        impl_->names.erase(handle);
+    }
+    if (old_name) {
+        impl_->Release(old_name);
+    }
+}
+
+std::string_view DebugObjectNames::Get(uint64_t handle) const {
+    if (handle == 0 || handle == ~uint64_t(0)) {
+        return {};
+    }
+    const auto found = impl_->names.find(handle);
+    return (found != impl_->names.end()) ? std::string_view(found->second->text) : std::string_view();
+}
+
+// The stack only grows, popped labels keep their name storage so recording the same labels again does not allocate
+struct CommandBufferLabelStack {
+    std::vector<LoggingLabel> labels;
+    size_t depth = 0;
+    LoggingLabel insert_label;
+
+    static void Assign(LoggingLabel &label, const VkDebugUtilsLabelEXT *label_info) {
+        label.name.assign(label_info->pLabelName);
+        std::copy_n(std::begin(label_info->color), 4, label.color.begin());
+    }
+};
+
+struct CommandBufferLabels::Impl {
+    struct Pool {
+        uint64_t device = 0;
+        vvl::unordered_set<uint64_t> command_buffers;
+    };
+
+    std::mutex lock;  // serializes adding and erasing stacks, and the pool membership
+    vvl::unordered_map<uint64_t, std::unique_ptr<CommandBufferLabelStack>> owned;
+    vl_concurrent_lockfree_map<uint64_t, CommandBufferLabelStack *> stacks;
+    vl_deferred_reclaimer<CommandBufferLabelStack> reclaimer;
+    vvl::unordered_map<uint64_t, Pool> pools;
+
+    // 0 and ~0 are reserved keys of the map, neither is a valid command buffer
+    static bool ValidKey(uint64_t key) { return key != 0 && key != ~uint64_t(0); }
+
+    CommandBufferLabelStack *Find(VkCommandBuffer command_buffer) const {
+        const uint64_t key = CastToUint64(command_buffer);
+        if (!ValidKey(key)) {
+            return nullptr;
+        }
+        const auto found = stacks.find(key);
+        return (found != stacks.end()) ? found->second : nullptr;
+    }
+
+    // Adds a stack the first time the command buffer gets a label
+    CommandBufferLabelStack *Get(VkCommandBuffer command_buffer) {
+        CommandBufferLabelStack *stack = Find(command_buffer);
+        const uint64_t key = CastToUint64(command_buffer);
+        if (stack || !ValidKey(key)) {
+            return stack;
+        }
+        std::lock_guard<std::mutex> guard(lock);
+        auto &owned_stack = owned[key];
+        if (!owned_stack) {
+            owned_stack = std::make_unique<CommandBufferLabelStack>();
+            stacks.insert_or_assign(key, owned_stack.get());
+        }
+        return owned_stack.get();
+    }
+
+    // Exporters on other threads may still read the stack, it is freed once no ReadGuard can see it. Requires lock.
+    void EraseLocked(uint64_t key) {
+        auto it = owned.find(key);
+        if (it == owned.end()) {
+            return;
+        }
+        stacks.erase(key);
+        reclaimer.Retire(std::move(it->second));
+        owned.erase(it);
+    }
+
+    // Returns the pool after the erased one
+    decltype(pools)::iterator ErasePoolLocked(decltype(pools)::iterator pool) {
+        for (const uint64_t key : pool->second.command_buffers) {
+            EraseLocked(key);
+        }
+        return pools.erase(pool);
+    }
+};
+
+CommandBufferLabels::ReadGuard::ReadGuard(const CommandBufferLabels &labels)
+    : labels_(labels), ticket_(labels.impl_->reclaimer.Enter()) {}
+CommandBufferLabels::ReadGuard::~ReadGuard() { labels_.impl_->reclaimer.Leave(ticket_); }
+
+CommandBufferLabels::CommandBufferLabels() : impl_(std::make_unique<Impl>()) {}
+CommandBufferLabels::~CommandBufferLabels() = default;
+
+void CommandBufferLabels::Begin(VkCommandBuffer command_buffer, const VkDebugUtilsLabelEXT *label_info) {
+    if (nullptr == label_info || nullptr == label_info->pLabelName) {
+        return;
+    }
+    CommandBufferLabelStack *stack = impl_->Get(command_buffer);
+    if (!stack) {
+        return;
+    }
+    if (stack->depth == stack->labels.size()) {
+        stack->labels.emplace_back();
+    }
+    CommandBufferLabelStack::Assign(stack->labels[stack->depth++], label_info);
+
+    // TODO: Determine if this is the correct semantics for insert label vs. begin/end, perserving existing semantics for now
+    stack->insert_label.name.clear();
+}
+
+void CommandBufferLabels::End(VkCommandBuffer command_buffer) {
+    CommandBufferLabelStack *stack = impl_->Find(command_buffer);
+    if (stack) {
+        // Pop the normal item
+        if (stack->depth > 0) {
+            --stack->depth;
+        }
+
+        // TODO: Determine if this is the correct semantics for insert label vs. begin/end, perserving existing semantics for now
+        stack->insert_label.name.clear();
+    }
+}
+
+void CommandBufferLabels::Insert(VkCommandBuffer command_buffer, const VkDebugUtilsLabelEXT *label_info) {
+    CommandBufferLabelStack *stack = impl_->Get(command_buffer);
+    if (!stack) {
+        return;
+    }
+    // TODO: Determine if this is the correct semantics for insert label vs. begin/end, perserving existing semantics for now
+    if (label_info && label_info->pLabelName) {
+        CommandBufferLabelStack::Assign(stack->insert_label, label_info);
     } else {
-        if (vuid_count_it->second >= debug_data->duplicate_message_limit) {
-            return true;
+        stack->insert_label.name.clear();
+    }
+}
+
+void CommandBufferLabels::Reset(VkCommandBuffer command_buffer) {
+    CommandBufferLabelStack *stack = impl_->Find(command_buffer);
+    if (stack) {
+        stack->depth = 0;
+        stack->insert_label.name.clear();
+    }
+}
+
+void CommandBufferLabels::Erase(VkCommandBuffer command_buffer) {
+    const uint64_t key = CastToUint64(command_buffer);
+    if (!Impl::ValidKey(key)) {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(impl_->lock);
+    impl_->EraseLocked(key);
+}
+
+void CommandBufferLabels::Allocate(VkDevice device, VkCommandPool pool, uint32_t count, const VkCommandBuffer *command_buffers) {
+    if (!command_buffers) {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(impl_->lock);
+    auto &pool_state = impl_->pools[CastToUint64(pool)];
+    pool_state.device = CastToUint64(device);
+    for (uint32_t i = 0; i < count; ++i) {
+        const uint64_t key = CastToUint64(command_buffers[i]);
+        if (Impl::ValidKey(key)) {
+            pool_state.command_buffers.insert(key);
+        }
+    }
+}
+
+void CommandBufferLabels::Free(VkCommandPool pool, uint32_t count, const VkCommandBuffer *command_buffers) {
+    if (!command_buffers) {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(impl_->lock);
+    auto pool_state = impl_->pools.find(CastToUint64(pool));
+    for (uint32_t i = 0; i < count; ++i) {
+        const uint64_t key = CastToUint64(command_buffers[i]);
+        if (!Impl::ValidKey(key)) {
+            continue;
+        }
+        impl_->EraseLocked(key);
+        if (pool_state != impl_->pools.end()) {
+            pool_state->second.command_buffers.erase(key);
+        }
+    }
+}
+
+void CommandBufferLabels::ResetPool(VkCommandPool pool) {
+    std::lock_guard<std::mutex> guard(impl_->lock);
+    const auto pool_state = impl_->pools.find(CastToUint64(pool));
+    if (pool_state == impl_->pools.end()) {
+        return;
+    }
+    for (const uint64_t key : pool_state->second.command_buffers) {
+        Reset(CastFromUint64<VkCommandBuffer>(key));
+    }
+}
+
+void CommandBufferLabels::ErasePool(VkCommandPool pool) {
+    std::lock_guard<std::mutex> guard(impl_->lock);
+    const auto pool_state = impl_->pools.find(CastToUint64(pool));
+    if (pool_state != impl_->pools.end()) {
+        impl_->ErasePoolLocked(pool_state);
+    }
+}
+
+void CommandBufferLabels::EraseDevice(VkDevice device) {
+    const uint64_t device_key = CastToUint64(device);
+    std::lock_guard<std::mutex> guard(impl_->lock);
+    for (auto pool_state = impl_->pools.begin(); pool_state != impl_->pools.end();) {
+        if (pool_state->second.device == device_key) {
+            pool_state = impl_->ErasePoolLocked(pool_state);
         } else {
-            vuid_count_it->second++;
-            return false;
+            ++pool_state;
         }
     }
 }
 
+std::vector<VkDebugUtilsLabelEXT> CommandBufferLabels::Export(VkCommandBuffer command_buffer) const {
+    std::vector<VkDebugUtilsLabelEXT> out;
+    const CommandBufferLabelStack *stack = impl_->Find(command_buffer);
+    if (!stack) {
+        return out;
+    }
+    // Same order as LoggingLabelState::Export()
+    out.reserve(stack->depth + 1);
+    for (size_t i = stack->depth; i > 0; --i) {
+        out.emplace_back(stack->labels[i - 1].Export());
+    }
+    if (!stack->insert_label.Empty()) {
+        out.emplace_back(stack->insert_label.Export());
+    }
+    return out;
+}
+
 static bool debug_log_msg(const debug_report_data *debug_data, VkFlags msg_flags, const LogObjectList &objects,
                                  const char *layer_prefix, const char *message, const char *text_vuid) {
     bool bail = false;
@@ -86,11 +362,10 @@ static bool debug_log_msg(const debug_report_data *debug_data, VkFlags msg_flags
     VkDebugUtilsMessageSeverityFlagsEXT severity;
     DebugReportFlagsToAnnotFlags(msg_flags, &severity, &types);
 
-    std::vector<std::string> object_labels;
-    // Ensures that push_back will not reallocate, thereby providing pointer
-    // stability for pushed strings.
-    object_labels.reserve(objects.object_list.size());
-
+    // The object names and command buffer labels handed to the callback stay valid until the guards are released
+    const DebugObjectNames::ReadGuard utils_names_guard(debug_data->debugUtilsObjectNames);
+    const DebugObjectNames::ReadGuard marker_names_guard(debug_data->debugObjectNames);
+    const CommandBufferLabels::ReadGuard cmd_buf_labels_guard(debug_data->debugUtilsCmdBufLabels);
     std::vector<VkDebugUtilsObjectNameInfoEXT> object_name_info;
     object_name_info.resize(objects.object_list.size());
     for (uint32_t i = 0; i < objects.object_list.size(); i++) {
@@ -99,15 +374,14 @@ static bool debug_log_msg(const debug_report_data *debug_data, VkFlags msg_flags
         object_name_info[i].objectHandle = objects.object_list[i].handle;
         object_name_info[i].pObjectName = NULL;
 
-        std::string object_label = {};
-        // Look for any debug utils or marker names to use for this object
-        object_label = debug_data->DebugReportGetUtilsObjectName(objects.object_list[i].handle);
+        // Look for any debug utils or marker names to use for this object. Names are interned and NUL terminated, so the
+        // view can be handed to the callback as is.
+        std::string_view object_label = debug_data->DebugReportGetUtilsObjectName(objects.object_list[i].handle);
         if (object_label.empty()) {
             object_label = debug_data->DebugReportGetMarkerObjectName(objects.object_list[i].handle);
         }
         if (!object_label.empty()) {
-            object_labels.push_back(std::move(object_label));
-            object_name_info[i].pObjectName = object_labels.back().c_str();
+            object_name_info[i].pObjectName = object_label.data();
         }
 
         // If this is a queue, add any queue labels to the callback data.
@@ -119,12 +393,9 @@ static bool debug_log_msg(const debug_report_data *debug_data, VkFlags msg_flags
             }
             // If this is a command buffer, add any command buffer labels to the callback data.
         } else if (VK_OBJECT_TYPE_COMMAND_BUFFER == object_name_info[i].objectType) {
-            auto label_iter =
-                debug_data->debugUtilsCmdBufLabels.find(reinterpret_cast<VkCommandBuffer>(object_name_info[i].objectHandle));
-            if (label_iter != debug_data->debugUtilsCmdBufLabels.end()) {
-                auto found_cmd_buf_labels = label_iter->second->Export();
-                cmd_buf_labels.insert(cmd_buf_labels.end(), found_cmd_buf_labels.begin(), found_cmd_buf_labels.end());
-            }
+            auto found_cmd_buf_labels =
+                debug_data->debugUtilsCmdBufLabels.Export(CastFromUint64<VkCommandBuffer>(object_name_info[i].objectHandle));
+            cmd_buf_labels.insert(cmd_buf_labels.end(), found_cmd_buf_labels.begin(), found_cmd_buf_labels.end());
         }
     }
 
@@ -317,124 +588,213 @@ VKAPI_ATTR void DeactivateInstanceDebugCallbacks(debug_report_data *debug_data)
 
 // helper for VUID based filtering. This needs to be separate so it can be called before incurring
 // the cost of sprintf()-ing the err_msg needed by LogMsgLocked().
+// Called without debug_output_mutex, everything it reads is either atomic or only written while the instance is created.
+static bool CallbacksEnabled(const debug_report_data *debug_data, VkDebugUtilsMessageSeverityFlagsEXT severity,
+                             VkDebugUtilsMessageTypeFlagsEXT type) {
+    return (debug_data->active_severities.load(std::memory_order_relaxed) & severity) &&
+           (debug_data->active_types.load(std::memory_order_relaxed) & type);
+}
+
+static bool BinaryLogEnabled(const debug_report_data *debug_data, VkDebugUtilsMessageSeverityFlagsEXT severity,
+                             VkDebugUtilsMessageTypeFlagsEXT type) {
+    return debug_data->binary_log && debug_data->binary_log->Accepts(severity, type);
+}
+
+static thread_local uint64_t log_msg_attempt_count = 0;
+
+VKAPI_ATTR uint64_t LogMsgAttemptCount() { return log_msg_attempt_count; }
+
 static bool LogMsgEnabled(const debug_report_data *debug_data, std::string_view vuid_text,
                           VkDebugUtilsMessageSeverityFlagsEXT severity, VkDebugUtilsMessageTypeFlagsEXT type) {
-    if (!(debug_data->active_severities & severity) || !(debug_data->active_types & type)) {
+    ++log_msg_attempt_count;
+    if (!CallbacksEnabled(debug_data, severity, type) && !BinaryLogEnabled(debug_data, severity, type)) {
         return false;
     }
-    // If message is in filter list, bail out very early
+    const bool filtering = !debug_data->filter_message_ids.empty();
+    const bool counting = debug_data->duplicate_message_limit > 0;
+    if (!filtering && !counting) {
+        return true;
+    }
     const uint32_t message_id = vvl_vuid_hash(vuid_text);
-    if (std::find(debug_data->filter_message_ids.begin(), debug_data->filter_message_ids.end(), message_id)
-        != debug_data->filter_message_ids.end()) {
+    // If message is in filter list, bail out very early
+    if (filtering && debug_data->filter_message_ids.Contains(message_id)) {
         return false;
     }
-    if ((debug_data->duplicate_message_limit > 0) && UpdateLogMsgCounts(debug_data, static_cast<int32_t>(message_id))) {
+    if (counting && debug_data->duplicate_message_counts.OverLimit(message_id, debug_data->duplicate_message_limit)) {
         // Count for this particular message is over the limit, ignore it
         return false;
     }
     return true;
 }
 
-VKAPI_ATTR bool LogMsg(const debug_report_data *debug_data, VkFlags msg_flags, const LogObjectList &objects,
-                       std::string_view vuid_text, const char *format, va_list argptr) {
-    assert(*(vuid_text.data() + vuid_text.size()) == '\0');
-
+VKAPI_ATTR bool LogMsgEnabled(const debug_report_data *debug_data, VkFlags msg_flags, std::string_view vuid_text) {
     VkDebugUtilsMessageSeverityFlagsEXT severity;
     VkDebugUtilsMessageTypeFlagsEXT type;
-
     DebugReportFlagsToAnnotFlags(msg_flags, &severity, &type);
-    std::unique_lock<std::mutex> lock(debug_data->debug_output_mutex);
-    // Avoid logging cost if msg is to be ignored
-    if (!LogMsgEnabled(debug_data, vuid_text, severity, type)) {
-        return false;
+    return LogMsgEnabled(debug_data, vuid_text, severity, type);
+}
+
+// The parts of the spec link that only depend on the header version, built on first use instead of for every message
+struct SpecLinkStrings {
+    std::string link;  // still contains kSpecTypeToken, which depends on the VUID
+    size_t spec_type_pos;
+};
+static constexpr std::string_view kSpecTypeToken = "_MAGIC_KHRONOS_SPEC_TYPE_";
+
+static const SpecLinkStrings &GetSpecLinkStrings() {
+    static const SpecLinkStrings strings = []() {
+        std::string spec_link = "https://www.khronos.org/registry/vulkan/specs/_MAGIC_KHRONOS_SPEC_TYPE_/html/vkspec.html";
+#ifdef ANNOTATED_SPEC_LINK
+        spec_link = ANNOTATED_SPEC_LINK;
+#endif
+        const std::string major_version = std::to_string(VK_VERSION_MAJOR(VK_HEADER_VERSION_COMPLETE));
+        const std::string minor_version = std::to_string(VK_VERSION_MINOR(VK_HEADER_VERSION_COMPLETE));
+        const std::string patch_version = std::to_string(VK_VERSION_PATCH(VK_HEADER_VERSION_COMPLETE));
+        const std::string header_version = major_version + "." + minor_version + "." + patch_version;
+        const std::string annotated_spec_type = major_version + "." + minor_version + "-extensions";
+        auto Replace = [&spec_link](std::string_view to_replace, const std::string &replace_with) {
+            const size_t pos = spec_link.find(to_replace);
+            if (pos != std::string::npos) {
+                spec_link.replace(pos, to_replace.size(), replace_with);
+            }
+        };
+        Replace("_MAGIC_ANNOTATED_SPEC_TYPE_", annotated_spec_type);
+        Replace("_MAGIC_VERSION_ID_", header_version);
+        return SpecLinkStrings{spec_link, spec_link.find(kSpecTypeToken)};
+    }();
+    return strings;
+}
+
+static const vuid_spec_text_pair *FindSpecText(std::string_view vuid_text) {
+    // Built once, the table is static and a lookup happens for every logged VUID
+    using SpecTextMap = vvl::unordered_map<std::string_view, const vuid_spec_text_pair *, std::hash<std::string_view>>;
+    static const SpecTextMap spec_text_map = []() {
+        SpecTextMap map;
+        const uint32_t num_vuids = sizeof(vuid_spec_text) / sizeof(vuid_spec_text_pair);
+        map.reserve(num_vuids);
+        for (uint32_t i = 0; i < num_vuids; i++) {
+            map.emplace(vuid_spec_text[i].vuid, &vuid_spec_text[i]);
+        }
+        return map;
+    }();
+    const auto it = spec_text_map.find(vuid_text);
+    return (it != spec_text_map.end()) ? it->second : nullptr;
+}
+
+// Append the spec error text to the error message, unless the VUID contains a word treated as special
+static void AppendSpecText(std::string &str_plus_spec_text, std::string_view vuid_text) {
+    if ((vuid_text.find("UNASSIGNED-") != std::string::npos) || (vuid_text.find(kVUIDUndefined) != std::string::npos) ||
+        (vuid_text.rfind("SYNC-", 0) != std::string::npos) || (vuid_text.find("INTERNAL-ERROR-") != std::string::npos)) {
+        return;
     }
+    const vuid_spec_text_pair *spec = FindSpecText(vuid_text);
+    if (nullptr == spec || nullptr == spec->spec_text) {
+        return;
+    }
+
+    // Construct and append the specification text and link to the appropriate version of the spec
+    str_plus_spec_text.append(" The Vulkan spec states: ");
+    str_plus_spec_text.append(spec->spec_text);
+    const std::string_view spec_type = spec->url_id;
+    if (spec_type == "default") {
+        str_plus_spec_text.append(" (https://github.com/KhronosGroup/Vulkan-Docs/search?q=)");
+    } else {
+        const SpecLinkStrings &spec_link = GetSpecLinkStrings();
+        str_plus_spec_text.append(" (");
+        if (spec_link.spec_type_pos != std::string::npos) {
+            str_plus_spec_text.append(spec_link.link, 0, spec_link.spec_type_pos);
+            str_plus_spec_text.append(spec_type);
+            str_plus_spec_text.append(spec_link.link, spec_link.spec_type_pos + kSpecTypeToken.size());
+        } else {
+            str_plus_spec_text.append(spec_link.link);
+        }
+        str_plus_spec_text.append("#");  // CMake hates hashes
+    }
+    str_plus_spec_text.append(vuid_text);
+    str_plus_spec_text.append(")");
+}
 
+VKAPI_ATTR void FormatLogMessage(std::string &buffer, const char *format, va_list argptr) {
     // Best guess at an upper bound for message length. At least some of the extra space
     // should get used to store the VUID URL and text in the common case, without additional allocations.
-    std::string str_plus_spec_text(1024, '\0');
+    buffer.resize(std::max<size_t>(buffer.capacity(), 1024));
 
     // vsnprintf() returns the number of characters that *would* have been printed, if there was
-    // enough space. If we have a huge message, reallocate the string and try again.
-    int result;
-    size_t old_size = str_plus_spec_text.size();
+    // enough space. If we have a huge message, grow the string and try again.
     // The va_list will be destroyed by the call to vsnprintf(), so use a copy in case we need
     // to try again.
     va_list arg_copy;
     va_copy(arg_copy, argptr);
-    result = vsnprintf(str_plus_spec_text.data(), str_plus_spec_text.size(), format, arg_copy);
+    int result = vsnprintf(buffer.data(), buffer.size(), format, arg_copy);
     va_end(arg_copy);
 
     assert(result >= 0);
     if (result < 0) {
-        str_plus_spec_text = "Message generation failure";
-    } else if (static_cast<size_t>(result) <= old_size) {
+        buffer = "Message generation failure";
+    } else if (static_cast<size_t>(result) < buffer.size()) {
         // Shrink the string to exactly fit the successfully printed string
-        str_plus_spec_text.resize(result);
+        buffer.resize(result);
     } else {
         // Grow buffer to fit needed size. Note that the input size to vsnprintf() must
         // include space for the trailing '\0' character, but the return value DOES NOT
         // include the `\0' character.
-        str_plus_spec_text.resize(result + 1);
+        buffer.resize(result + 1);
         // consume the va_list passed to us by the caller
-        result = vsnprintf(str_plus_spec_text.data(), str_plus_spec_text.size(), format, argptr);
+        result = vsnprintf(buffer.data(), buffer.size(), format, argptr);
         // remove the `\0' character from the string
-        str_plus_spec_text.resize(result);
+        buffer.resize(result);
     }
+}
 
-    // Append the spec error text to the error message, unless it contains a word treated as special
-    if ((vuid_text.find("UNASSIGNED-") == std::string::npos) && (vuid_text.find(kVUIDUndefined) == std::string::npos) &&
-        (vuid_text.rfind("SYNC-", 0) == std::string::npos) && (vuid_text.find("INTERNAL-ERROR-") == std::string::npos)) {
-        // Linear search makes no assumptions about the layout of the string table. This is not fast, but it does not need to be at
-        // this point in the error reporting path
-        uint32_t num_vuids = sizeof(vuid_spec_text) / sizeof(vuid_spec_text_pair);
-        const char *spec_text = nullptr;
-        std::string spec_type;
-        for (uint32_t i = 0; i < num_vuids; i++) {
-            if (0 == strncmp(vuid_text.data(), vuid_spec_text[i].vuid, vuid_text.size())) {
-                spec_text = vuid_spec_text[i].spec_text;
-                spec_type = vuid_spec_text[i].url_id;
-                break;
-            }
-        }
+static bool LogMsgLocked(const debug_report_data *debug_data, VkFlags msg_flags, const LogObjectList &objects,
+                         std::string_view vuid_text, std::string &message) {
+    AppendSpecText(message, vuid_text);
+    std::unique_lock<std::mutex> lock(debug_data->debug_output_mutex);
+    return debug_log_msg(debug_data, msg_flags, objects, "Validation", message.c_str(), vuid_text.data());
+}
 
-        // Construct and append the specification text and link to the appropriate version of the spec
-        if (nullptr != spec_text) {
-            std::string spec_link = "https://www.khronos.org/registry/vulkan/specs/_MAGIC_KHRONOS_SPEC_TYPE_/html/vkspec.html";
-#ifdef ANNOTATED_SPEC_LINK
-            spec_link = ANNOTATED_SPEC_LINK;
-#endif
-            static std::string kAtToken = "_MAGIC_ANNOTATED_SPEC_TYPE_";
-            static std::string kKtToken = "_MAGIC_KHRONOS_SPEC_TYPE_";
-            static std::string kVeToken = "_MAGIC_VERSION_ID_";
-            auto Replace = [](std::string &dest_string, const std::string &to_replace, const std::string &replace_with) {
-                if (dest_string.find(to_replace) != std::string::npos) {
-                    dest_string.replace(dest_string.find(to_replace), to_replace.size(), replace_with);
-                }
-            };
-
-            str_plus_spec_text.append(" The Vulkan spec states: ");
-            str_plus_spec_text.append(spec_text);
-            if (0 == spec_type.compare("default")) {
-                str_plus_spec_text.append(" (https://github.com/KhronosGroup/Vulkan-Docs/search?q=)");
-            } else {
-                str_plus_spec_text.append(" (");
-                str_plus_spec_text.append(spec_link);
-                std::string major_version = std::to_string(VK_VERSION_MAJOR(VK_HEADER_VERSION_COMPLETE));
-                std::string minor_version = std::to_string(VK_VERSION_MINOR(VK_HEADER_VERSION_COMPLETE));
-                std::string patch_version = std::to_string(VK_VERSION_PATCH(VK_HEADER_VERSION_COMPLETE));
-                std::string header_version = major_version + "." + minor_version + "." + patch_version;
-                std::string annotated_spec_type = major_version + "." + minor_version + "-extensions";
-                Replace(str_plus_spec_text, kKtToken, spec_type);
-                Replace(str_plus_spec_text, kAtToken, annotated_spec_type);
-                Replace(str_plus_spec_text, kVeToken, header_version);
-                str_plus_spec_text.append("#");  // CMake hates hashes
-            }
-            str_plus_spec_text.append(vuid_text);
-            str_plus_spec_text.append(")");
-        }
+VKAPI_ATTR bool LogMsg(const debug_report_data *debug_data, VkFlags msg_flags, const LogObjectList &objects,
+                       std::string_view vuid_text, const char *format, va_list argptr) {
+    assert(*(vuid_text.data() + vuid_text.size()) == '\0');
+
+    VkDebugUtilsMessageSeverityFlagsEXT severity;
+    VkDebugUtilsMessageTypeFlagsEXT type;
+    DebugReportFlagsToAnnotFlags(msg_flags, &severity, &type);
+    // Avoid logging cost (and the output lock) if msg is to be ignored
+    if (!LogMsgEnabled(debug_data, vuid_text, severity, type)) {
+        return false;
+    }
+    if (BinaryLogEnabled(debug_data, severity, type)) {
+        va_list arg_copy;
+        va_copy(arg_copy, argptr);
+        debug_data->binary_log->Write(msg_flags, objects, vuid_text, format, arg_copy);
+        va_end(arg_copy);
+    }
+    if (!CallbacksEnabled(debug_data, severity, type)) {
+        return false;
     }
 
-    return debug_log_msg(debug_data, msg_flags, objects, "Validation", str_plus_spec_text.c_str(), vuid_text.data());
+    // Formatting happens outside of the output lock, into a buffer that keeps its capacity between messages.
+    // The callbacks invoked by debug_log_msg() may not call back into the layer, so the buffer cannot be reentered.
+    thread_local std::string str_plus_spec_text;
+    FormatLogMessage(str_plus_spec_text, format, argptr);
+    return LogMsgLocked(debug_data, msg_flags, objects, vuid_text, str_plus_spec_text);
+}
+
+VKAPI_ATTR bool LogMsgText(const debug_report_data *debug_data, VkFlags msg_flags, const LogObjectList &objects,
+                           std::string_view vuid_text, std::string &&message) {
+    assert(*(vuid_text.data() + vuid_text.size()) == '\0');
+    VkDebugUtilsMessageSeverityFlagsEXT severity;
+    VkDebugUtilsMessageTypeFlagsEXT type;
+    DebugReportFlagsToAnnotFlags(msg_flags, &severity, &type);
+    if (BinaryLogEnabled(debug_data, severity, type)) {
+        debug_data->binary_log->WriteText(msg_flags, objects, vuid_text, message);
+    }
+    if (!CallbacksEnabled(debug_data, severity, type)) {
+        return false;
+    }
+    std::string str_plus_spec_text = std::move(message);
+    return LogMsgLocked(debug_data, msg_flags, objects, vuid_text, str_plus_spec_text);
 }
 
 VKAPI_ATTR VkBool32 VKAPI_CALL MessengerBreakCallback([[maybe_unused]] VkDebugUtilsMessageSeverityFlagBitsEXT message_severity,
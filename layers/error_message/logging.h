@@ -17,8 +17,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <cinttypes>
 #include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <memory>
 #include <mutex>
 #include <sstream>
 #include <string>
@@ -159,68 +165,208 @@ struct LoggingLabelState {
     }
 };
 
+// Message ids dropped by the message_id_filter setting. Contains() is checked for every message that passes the severity
+// check, so a bitmap indexed by the low bits of the id answers the common "not filtered" case without searching the list.
+class MessageIdFilter {
+  public:
+    void Insert(uint32_t id) {
+        if (!Contains(id)) {
+            ids_.push_back(id);
+            bits_[(id & kBitMask) >> 6] |= uint64_t(1) << (id & 63);
+        }
+    }
+    bool Contains(uint32_t id) const {
+        if ((bits_[(id & kBitMask) >> 6] & (uint64_t(1) << (id & 63))) == 0) {
+            return false;
+        }
+        return std::find(ids_.begin(), ids_.end(), id) != ids_.end();
+    }
+    bool empty() const { return ids_.empty(); }
+    size_t size() const { return ids_.size(); }
+
+  private:
+    static constexpr uint32_t kBitCount = 1024;
+    static constexpr uint32_t kBitMask = kBitCount - 1;
+    std::array<uint64_t, kBitCount / 64> bits_{};
+    std::vector<uint32_t> ids_;
+};
+
+// Per message id counts for the duplicate_message_limit setting, updated without taking debug_output_mutex.
+//
+// Counts are kept in a fixed open-addressed table of packed (id << 32 | count) atomics. A message that is already over its
+// limit is rejected with a single atomic load, and one that isn't costs a single fetch_add. Ids that don't find a slot
+// within a few probes (or the id 0, which marks an empty slot) fall back to a locked map.
+class DuplicateMessageCounter {
+  public:
+    // Counts the message and returns true if it was already logged limit times
+    bool OverLimit(uint32_t message_id, int32_t limit) {
+        if (message_id != 0) {
+            size_t slot = message_id & (kSlotCount - 1);
+            for (uint32_t probe = 0; probe < kMaxProbes; ++probe, slot = (slot + 1) & (kSlotCount - 1)) {
+                uint64_t value = slots_[slot].load(std::memory_order_acquire);
+                if (value == 0) {
+                    // The first instance counts as 1, as it is logged
+                    if (slots_[slot].compare_exchange_strong(value, (uint64_t(message_id) << 32) | 1)) {
+                        return false;
+                    }
+                }
+                if ((value >> 32) == message_id) {
+                    if (static_cast<int32_t>(value & 0xFFFFFFFF) >= limit) {
+                        return true;
+                    }
+                    const uint64_t prev = slots_[slot].fetch_add(1);
+                    return static_cast<int32_t>(prev & 0xFFFFFFFF) >= limit;
+                }
+            }
+        }
+        std::lock_guard<std::mutex> lock(overflow_mutex_);
+        auto &count = overflow_[message_id];
+        if (count >= limit) {
+            return true;
+        }
+        ++count;
+        return false;
+    }
+
+  private:
+    static constexpr size_t kSlotCount = 4096;
+    static constexpr uint32_t kMaxProbes = 16;
+    std::array<std::atomic<uint64_t>, kSlotCount> slots_{};
+    std::mutex overflow_mutex_;
+    vvl::unordered_map<uint32_t, int32_t> overflow_;
+};
+
+class BinaryMessageLog;
+
+// Debug object names, looked up for every handle in every message.
+// Names are interned and reference counted by the handles using them. A lookup hands out a view of a NUL terminated string
+// that stays valid while the caller holds a ReadGuard, names that are no longer used are freed once no guard can see them.
+// Lookups are wait-free, only Set() takes a lock and it never waits on readers.
+class DebugObjectNames {
+  public:
+    class ReadGuard {
+      public:
+        explicit ReadGuard(const DebugObjectNames &names);
+        ~ReadGuard();
+        ReadGuard(const ReadGuard &) = delete;
+        ReadGuard &operator=(const ReadGuard &) = delete;
+
+      private:
+        const DebugObjectNames &names_;
+        const uint32_t ticket_;
+    };
+
+    DebugObjectNames();
+    ~DebugObjectNames();
+
+    // A null name removes the handle's name
+    void Set(uint64_t handle, const char *name);
+    // Empty if the handle has no name, only valid while a ReadGuard is held
+    std::string_view Get(uint64_t handle) const;
+
+  private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+// Debug utils label stacks of every command buffer, read when a message names the command buffer.
+// Command buffers are externally synchronized, so the label commands only take a wait-free lookup of the command buffer's
+// stack and reuse the storage of earlier labels. A lock is only taken when command buffers are allocated or freed, the
+// first time a command buffer gets a label, and for the pool wide resets. Erased stacks are freed once no ReadGuard can
+// see them.
+class CommandBufferLabels {
+  public:
+    class ReadGuard {
+      public:
+        explicit ReadGuard(const CommandBufferLabels &labels);
+        ~ReadGuard();
+        ReadGuard(const ReadGuard &) = delete;
+        ReadGuard &operator=(const ReadGuard &) = delete;
+
+      private:
+        const CommandBufferLabels &labels_;
+        const uint32_t ticket_;
+    };
+
+    CommandBufferLabels();
+    ~CommandBufferLabels();
+
+    void Begin(VkCommandBuffer command_buffer, const VkDebugUtilsLabelEXT *label_info);
+    void End(VkCommandBuffer command_buffer);
+    void Insert(VkCommandBuffer command_buffer, const VkDebugUtilsLabelEXT *label_info);
+    // Clears the labels but keeps the storage for the next recording
+    void Reset(VkCommandBuffer command_buffer);
+    void Erase(VkCommandBuffer command_buffer);
+
+    // Pool membership, so the pool and device wide calls can reset or erase the pool's command buffers
+    void Allocate(VkDevice device, VkCommandPool pool, uint32_t count, const VkCommandBuffer *command_buffers);
+    void Free(VkCommandPool pool, uint32_t count, const VkCommandBuffer *command_buffers);
+    void ResetPool(VkCommandPool pool);
+    void ErasePool(VkCommandPool pool);
+    void EraseDevice(VkDevice device);
+
+    // Most recent label first. The names stay valid until the command buffer records more labels, or while a ReadGuard is
+    // held if another thread may erase the command buffer.
+    std::vector<VkDebugUtilsLabelEXT> Export(VkCommandBuffer command_buffer) const;
+
+  private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
 typedef struct _debug_report_data {
     std::vector<VkLayerDbgFunctionState> debug_callback_list;
-    VkDebugUtilsMessageSeverityFlagsEXT active_severities{0};
-    VkDebugUtilsMessageTypeFlagsEXT active_types{0};
-    vvl::unordered_map<uint64_t, std::string> debugObjectNameMap;
-    vvl::unordered_map<uint64_t, std::string> debugUtilsObjectNameMap;
+    // Read by LogMsg before debug_output_mutex is taken
+    std::atomic<VkDebugUtilsMessageSeverityFlagsEXT> active_severities{0};
+    std::atomic<VkDebugUtilsMessageTypeFlagsEXT> active_types{0};
+    DebugObjectNames debugObjectNames;
+    DebugObjectNames debugUtilsObjectNames;
     vvl::unordered_map<VkQueue, std::unique_ptr<LoggingLabelState>> debugUtilsQueueLabels;
-    vvl::unordered_map<VkCommandBuffer, std::unique_ptr<LoggingLabelState>> debugUtilsCmdBufLabels;
-    std::vector<uint32_t> filter_message_ids{};
+    CommandBufferLabels debugUtilsCmdBufLabels;
+    // Only written while the instance is created
+    MessageIdFilter filter_message_ids{};
     // This mutex is defined as mutable since the normal usage for a debug report object is as 'const'. The mutable keyword allows
     // the layers to continue this pattern, but also allows them to use/change this specific member for synchronization purposes.
     mutable std::mutex debug_output_mutex;
     int32_t duplicate_message_limit = 0;
-    mutable vvl::unordered_map<uint32_t, int32_t> duplicate_message_count_map{};
+    mutable DuplicateMessageCounter duplicate_message_counts{};
+    // Set while the instance is created when VK_DBG_LAYER_ACTION_LOG_BINARY is enabled
+    std::shared_ptr<BinaryMessageLog> binary_log;
     const void *instance_pnext_chain{};
     bool forceDefaultLogCallback{false};
 
     void DebugReportSetUtilsObjectName(const VkDebugUtilsObjectNameInfoEXT *pNameInfo) {
-        std::unique_lock<std::mutex> lock(debug_output_mutex);
-        if (pNameInfo->pObjectName) {
-            debugUtilsObjectNameMap[pNameInfo->objectHandle] = pNameInfo->pObjectName;
-        } else {
-            debugUtilsObjectNameMap.erase(pNameInfo->objectHandle);
-        }
+        debugUtilsObjectNames.Set(pNameInfo->objectHandle, pNameInfo->pObjectName);
     }
 
     void DebugReportSetMarkerObjectName(const VkDebugMarkerObjectNameInfoEXT *pNameInfo) {
-        std::unique_lock<std::mutex> lock(debug_output_mutex);
-        if (pNameInfo->pObjectName) {
-            debugObjectNameMap[pNameInfo->object] = pNameInfo->pObjectName;
-        } else {
-            debugObjectNameMap.erase(pNameInfo->object);
-        }
+        debugObjectNames.Set(pNameInfo->object, pNameInfo->pObjectName);
     }
 
-    std::string DebugReportGetUtilsObjectName(const uint64_t object) const {
-        std::string label = "";
-        const auto utils_name_iter = debugUtilsObjectNameMap.find(object);
-        if (utils_name_iter != debugUtilsObjectNameMap.end()) {
-            label = utils_name_iter->second;
-        }
-        return label;
-    }
+    std::string_view DebugReportGetUtilsObjectName(const uint64_t object) const { return debugUtilsObjectNames.Get(object); }
 
-    std::string DebugReportGetMarkerObjectName(const uint64_t object) const {
-        std::string label = "";
-        const auto marker_name_iter = debugObjectNameMap.find(object);
-        if (marker_name_iter != debugObjectNameMap.end()) {
-            label = marker_name_iter->second;
-        }
-        return label;
-    }
+    std::string_view DebugReportGetMarkerObjectName(const uint64_t object) const { return debugObjectNames.Get(object); }
 
     std::string FormatHandle(const char *handle_type_name, uint64_t handle) const {
-        std::string handle_name = DebugReportGetUtilsObjectName(handle);
+        const DebugObjectNames::ReadGuard utils_names_guard(debugUtilsObjectNames);
+        const DebugObjectNames::ReadGuard marker_names_guard(debugObjectNames);
+        std::string_view handle_name = DebugReportGetUtilsObjectName(handle);
         if (handle_name.empty()) {
             handle_name = DebugReportGetMarkerObjectName(handle);
         }
 
-        std::ostringstream str;
-        str << handle_type_name << " 0x" << std::hex << handle << "[" << handle_name.c_str() << "]";
-        return str.str();
+        char handle_hex[17];
+        const int hex_length = snprintf(handle_hex, sizeof(handle_hex), "%" PRIx64, handle);
+        const size_t type_length = strlen(handle_type_name);
+        std::string str;
+        str.reserve(type_length + 3 + hex_length + 2 + handle_name.size());
+        str.append(handle_type_name, type_length);
+        str.append(" 0x");
+        str.append(handle_hex, hex_length);
+        str.append("[");
+        str.append(handle_name);
+        str.append("]");
+        return str;
     }
 
     std::string FormatHandle(const VulkanTypedHandle &handle) const {
@@ -287,6 +433,21 @@ static inline LogMessageTypeFlags DebugAnnotFlagsToMsgTypeFlags(VkDebugUtilsMess
 VKAPI_ATTR bool LogMsg(const debug_report_data *debug_data, VkFlags msg_flags, const LogObjectList &objects,
                        std::string_view vuid_text, const char *format, va_list argptr);
 
+// vsnprintf() into buffer, reusing whatever capacity buffer already has
+VKAPI_ATTR void FormatLogMessage(std::string &buffer, const char *format, va_list argptr);
+
+// Returns true if a message with these flags and VUID would reach at least one callback. This counts toward the duplicate
+// message limit, so it must be called exactly once per message, followed by LogMsgText() if it passed.
+VKAPI_ATTR bool LogMsgEnabled(const debug_report_data *debug_data, VkFlags msg_flags, std::string_view vuid_text);
+
+// Number of messages the calling thread tried to log, including the ones that were filtered out. The Log*() helpers only
+// return whether the application asked to skip the call, comparing the count tells whether a check reported anything.
+VKAPI_ATTR uint64_t LogMsgAttemptCount();
+
+// Logs an already formatted message without checking the filters again, see LogMsgEnabled()
+VKAPI_ATTR bool LogMsgText(const debug_report_data *debug_data, VkFlags msg_flags, const LogObjectList &objects,
+                           std::string_view vuid_text, std::string &&message);
+
 VKAPI_ATTR VkResult LayerCreateMessengerCallback(debug_report_data *debug_data, bool default_callback,
                                                  const VkDebugUtilsMessengerCreateInfoEXT *create_info,
                                                  VkDebugUtilsMessengerEXT *messenger);
@@ -381,54 +542,44 @@ static inline void InsertQueueDebugUtilsLabel(debug_report_data *report_data, Vk
 
 static inline void BeginCmdDebugUtilsLabel(debug_report_data *report_data, VkCommandBuffer command_buffer,
                                            const VkDebugUtilsLabelEXT *label_info) {
-    std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
-    if (nullptr != label_info && nullptr != label_info->pLabelName) {
-        auto *label_state = GetLoggingLabelState(&report_data->debugUtilsCmdBufLabels, command_buffer, /* insert */ true);
-        assert(label_state);
-        label_state->labels.push_back(LoggingLabel(label_info));
-
-        // TODO: Determine if this is the correct semantics for insert label vs. begin/end, perserving existing semantics for now
-        label_state->insert_label.Reset();
-    }
+    report_data->debugUtilsCmdBufLabels.Begin(command_buffer, label_info);
 }
 
 static inline void EndCmdDebugUtilsLabel(debug_report_data *report_data, VkCommandBuffer command_buffer) {
-    std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
-    auto *label_state = GetLoggingLabelState(&report_data->debugUtilsCmdBufLabels, command_buffer, /* insert */ false);
-    if (label_state) {
-        // Pop the normal item
-        if (!label_state->labels.empty()) {
-            label_state->labels.pop_back();
-        }
-
-        // TODO: Determine if this is the correct semantics for insert label vs. begin/end, perserving existing semantics for now
-        label_state->insert_label.Reset();
-    }
+    report_data->debugUtilsCmdBufLabels.End(command_buffer);
 }
 
 static inline void InsertCmdDebugUtilsLabel(debug_report_data *report_data, VkCommandBuffer command_buffer,
                                             const VkDebugUtilsLabelEXT *label_info) {
-    std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
-    auto *label_state = GetLoggingLabelState(&report_data->debugUtilsCmdBufLabels, command_buffer, /* insert */ true);
-    assert(label_state);
-
-    // TODO: Determine if this is the correct semantics for insert label vs. begin/end, perserving existing semantics for now
-    label_state->insert_label = LoggingLabel(label_info);
+    report_data->debugUtilsCmdBufLabels.Insert(command_buffer, label_info);
 }
 
-// Current tracking beyond a single command buffer scope is incorrect, and even when it is we need to be able to clean up
 static inline void ResetCmdDebugUtilsLabel(debug_report_data *report_data, VkCommandBuffer command_buffer) {
-    std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
-    auto *label_state = GetLoggingLabelState(&report_data->debugUtilsCmdBufLabels, command_buffer, /* insert */ false);
-    if (label_state) {
-        label_state->labels.clear();
-        label_state->insert_label.Reset();
-    }
+    report_data->debugUtilsCmdBufLabels.Reset(command_buffer);
 }
 
-static inline void EraseCmdDebugUtilsLabel(debug_report_data *report_data, VkCommandBuffer command_buffer) {
-    std::unique_lock<std::mutex> lock(report_data->debug_output_mutex);
-    report_data->debugUtilsCmdBufLabels.erase(command_buffer);
+static inline void AllocateCmdDebugUtilsLabels(debug_report_data *report_data, VkDevice device,
+                                               const VkCommandBufferAllocateInfo *allocate_info,
+                                               const VkCommandBuffer *command_buffers) {
+    report_data->debugUtilsCmdBufLabels.Allocate(device, allocate_info->commandPool, allocate_info->commandBufferCount,
+                                                 command_buffers);
+}
+
+static inline void FreeCmdDebugUtilsLabels(debug_report_data *report_data, VkCommandPool pool, uint32_t count,
+                                           const VkCommandBuffer *command_buffers) {
+    report_data->debugUtilsCmdBufLabels.Free(pool, count, command_buffers);
+}
+
+static inline void ResetPoolCmdDebugUtilsLabels(debug_report_data *report_data, VkCommandPool pool) {
+    report_data->debugUtilsCmdBufLabels.ResetPool(pool);
+}
+
+static inline void ErasePoolCmdDebugUtilsLabels(debug_report_data *report_data, VkCommandPool pool) {
+    report_data->debugUtilsCmdBufLabels.ErasePool(pool);
+}
+
+static inline void EraseDeviceCmdDebugUtilsLabels(debug_report_data *report_data, VkDevice device) {
+    report_data->debugUtilsCmdBufLabels.EraseDevice(device);
 }
 
 uint32_t vvl_vuid_hash(std::string_view vuid);
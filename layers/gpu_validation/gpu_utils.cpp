@@ -1059,7 +1059,8 @@ void UtilGenerateStageMessage(const uint32_t *debug_record, std::string &msg) {
 }
 
 std::string LookupDebugUtilsName(const debug_report_data *report_data, const uint64_t object) {
-    auto object_label = report_data->DebugReportGetUtilsObjectName(object);
+    const DebugObjectNames::ReadGuard names_guard(report_data->debugUtilsObjectNames);
+    std::string object_label(report_data->DebugReportGetUtilsObjectName(object));
     if (object_label != "") {
         object_label = "(" + object_label + ")";
     }
@@ -53,6 +53,9 @@ const char *SETTING_MESSAGE_ID_FILTER = "message_id_filter";
 const char *SETTING_CUSTOM_STYPE_LIST = "custom_stype_list";
 const char *SETTING_DUPLICATE_MESSAGE_LIMIT = "duplicate_message_limit";
 const char *SETTING_FINE_GRAINED_LOCKING = "fine_grained_locking";
+const char *SETTING_REPORT_STATS = "report_stats";
+const char *SETTING_SYNCVAL_ASYNC_BACKLOG = "syncval_async_backlog";
+const char *SETTING_SYNCVAL_SUBMIT_THREADS = "syncval_submit_threads";
 
 // Set the local disable flag for the appropriate VALIDATION_CHECK_DISABLE enum
 void SetValidationDisable(CHECK_DISABLED &disable_data, const ValidationCheckDisables disable_id) {
@@ -273,7 +276,7 @@ uint32_t TokenToUint(std::string &token) {
     return int_id;
 }
 
-void CreateFilterMessageIdList(std::string raw_id_list, const std::string &delimiter, std::vector<uint32_t> &filter_list) {
+void CreateFilterMessageIdList(std::string raw_id_list, const std::string &delimiter, MessageIdFilter &filter_list) {
     size_t pos = 0;
     std::string token;
     while (raw_id_list.length() != 0) {
@@ -285,8 +288,8 @@ void CreateFilterMessageIdList(std::string raw_id_list, const std::string &delim
                 int_id = id_hash;
             }
         }
-        if ((int_id != 0) && (std::find(filter_list.begin(), filter_list.end(), int_id)) == filter_list.end()) {
-            filter_list.push_back(int_id);
+        if (int_id != 0) {
+            filter_list.Insert(int_id);
         }
     }
 }
@@ -439,6 +442,10 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
                 CreateFilterMessageIdList(data, ",", settings_data->message_filter_list);
             } else if (name == SETTING_DUPLICATE_MESSAGE_LIMIT) {
                 *settings_data->duplicate_message_limit = cur_setting.data.value32;
+            } else if (name == SETTING_SYNCVAL_ASYNC_BACKLOG) {
+                *settings_data->syncval_async_backlog = std::min(cur_setting.data.value32, 1024u);
+            } else if (name == SETTING_SYNCVAL_SUBMIT_THREADS) {
+                *settings_data->syncval_submit_threads = std::min(cur_setting.data.value32, 64u);
             } else if (name == SETTING_CUSTOM_STYPE_LIST) {
                 if (cur_setting.type == VK_LAYER_SETTING_VALUE_TYPE_STRING_ARRAY_EXT) {
                     std::string data(cur_setting.data.arrayString.pCharArray);
@@ -541,4 +548,19 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings *settings_data) {
     // Fine Grained Locking
     *settings_data->fine_grained_locking =
         SetBool(GetConfigValue(SETTING_FINE_GRAINED_LOCKING), GetConfigValue(SETTING_FINE_GRAINED_LOCKING), true);
+
+    // Statistics reported at vkDestroyDevice
+    *settings_data->report_stats = SetBool(GetConfigValue(SETTING_REPORT_STATS), GetEnvVarValue(SETTING_REPORT_STATS), false);
+
+    // Asynchronous queue submit synchronization validation, the layer settings structure is used unless set here
+    const std::optional<std::string> async_backlog_setting = GetSettingValue(SETTING_SYNCVAL_ASYNC_BACKLOG);
+    if (async_backlog_setting) {
+        *settings_data->syncval_async_backlog =
+            static_cast<uint32_t>(std::clamp(atoi(async_backlog_setting->c_str()), 0, 1024));
+    }
+    const std::optional<std::string> submit_threads_setting = GetSettingValue(SETTING_SYNCVAL_SUBMIT_THREADS);
+    if (submit_threads_setting) {
+        *settings_data->syncval_submit_threads =
+            static_cast<uint32_t>(std::clamp(atoi(submit_threads_setting->c_str()), 0, 64));
+    }
 }
@@ -27,9 +27,12 @@ typedef struct {
     const void *pnext_chain;
     CHECK_ENABLED &enables;
     CHECK_DISABLED &disables;
-    std::vector<uint32_t> &message_filter_list;
+    MessageIdFilter &message_filter_list;
     int32_t *duplicate_message_limit;
     bool *fine_grained_locking;
+    bool *report_stats;
+    uint32_t *syncval_async_backlog;
+    uint32_t *syncval_submit_threads;
 } ConfigAndEnvSettings;
 
 static const vvl::unordered_map<std::string, VkValidationFeatureDisableEXT> VkValFeatureDisableLookup = {
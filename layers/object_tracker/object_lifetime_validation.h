@@ -42,7 +42,12 @@ struct ObjTrackState {
     std::unique_ptr<vvl::unordered_set<uint64_t> > child_objects;  // Child objects (used for VkDescriptorPool only)
 };
 
+// CheckObjectValidity() runs for every handle parameter of every call, and only needs to know if the handle exists
+#ifdef VVL_LOCKFREE_HANDLE_MAPS
+typedef vl_concurrent_indexed_map<uint64_t, std::shared_ptr<ObjTrackState>, 6> object_map_type;
+#else
 typedef vl_concurrent_unordered_map<uint64_t, std::shared_ptr<ObjTrackState>, 6> object_map_type;
+#endif
 
 class ObjectLifetimes : public ValidationObject {
   public:
@@ -130,18 +135,16 @@ class ObjectLifetimes : public ValidationObject {
         // Look for object in object map
         if (!object_map[object_type].contains(object_handle)) {
             // If object is an image, also look for it in the swapchain image map
-            if ((object_type != kVulkanObjectTypeImage) || (swapchainImageMap.find(object_handle) == swapchainImageMap.end())) {
+            if ((object_type != kVulkanObjectTypeImage) || !swapchainImageMap.contains(object_handle)) {
                 // Object not found, look for it in other device object maps
                 for (const auto &other_device_data : layer_data_map) {
                     for (auto *layer_object_data : other_device_data.second->object_dispatch) {
                         if (layer_object_data->container_type == LayerObjectTypeObjectTracker) {
                             auto object_lifetime_data = reinterpret_cast<ObjectLifetimes *>(layer_object_data);
                             if (object_lifetime_data && (object_lifetime_data != this)) {
-                                if (object_lifetime_data->object_map[object_type].find(object_handle) !=
-                                        object_lifetime_data->object_map[object_type].end() ||
+                                if (object_lifetime_data->object_map[object_type].contains(object_handle) ||
                                     (object_type == kVulkanObjectTypeImage &&
-                                     object_lifetime_data->swapchainImageMap.find(object_handle) !=
-                                         object_lifetime_data->swapchainImageMap.end())) {
+                                     object_lifetime_data->swapchainImageMap.contains(object_handle))) {
                                     // Object found on other device, report an error if object has a device parent error code
                                     if ((wrong_device_code != kVUIDUndefined) && (object_type != kVulkanObjectTypeSurfaceKHR)) {
                                         const LogObjectList objlist(instance, device, layer_object_data->device);
@@ -203,9 +203,6 @@ void CMD_BUFFER_STATE::ResetCBState() {
     small_indexed_draw_call_count = 0;
 
     transform_feedback_active = false;
-
-    // Clean up the label data
-    ResetCmdDebugUtilsLabel(dev_data->report_data, commandBuffer());
 }
 
 void CMD_BUFFER_STATE::Reset() {
@@ -253,8 +250,6 @@ void CMD_BUFFER_STATE::ResetPushConstantDataIfIncompatible(const PIPELINE_LAYOUT
 }
 
 void CMD_BUFFER_STATE::Destroy() {
-    // Remove the cb debug labels
-    EraseCmdDebugUtilsLabel(dev_data->report_data, commandBuffer());
     {
         auto guard = WriteLock();
         ResetCBState();
@@ -1038,7 +1033,8 @@ void CMD_BUFFER_STATE::UpdateTraceRayCmd(CMD_TYPE cmd_type) {
 
 // Generic function to handle state update for all Provoking functions calls (draw/dispatch/traceray/etc)
 void CMD_BUFFER_STATE::UpdatePipelineState(CMD_TYPE cmd_type, const VkPipelineBindPoint bind_point) {
-    RecordCmd(cmd_type);
+    // Not RecordCmd(), a draw does not change the draw time state the next draw depends on
+    command_count++;
 
     const auto lv_bind_point = ConvertToLvlBindPoint(bind_point);
     auto &last_bound = lastBound[lv_bind_point];
@@ -1158,6 +1154,7 @@ void CMD_BUFFER_STATE::UpdateLastBoundDescriptorSets(VkPipelineBindPoint pipelin
     uint32_t required_size = first_set + set_count;
     const uint32_t last_binding_index = required_size - 1;
     assert(last_binding_index < pipeline_layout.set_compat_ids.size());
+    MarkDrawStateDirty(DRAW_STATE_DIRTY_DESCRIPTOR_SETS);
 
     // Some useful shorthand
     const auto lv_bind_point = ConvertToLvlBindPoint(pipeline_bind_point);
@@ -1239,6 +1236,7 @@ void CMD_BUFFER_STATE::UpdateLastBoundDescriptorBuffers(VkPipelineBindPoint pipe
     uint32_t required_size = first_set + set_count;
     const uint32_t last_binding_index = required_size - 1;
     assert(last_binding_index < pipeline_layout.set_compat_ids.size());
+    MarkDrawStateDirty(DRAW_STATE_DIRTY_DESCRIPTOR_SETS);
 
     // Some useful shorthand
     const auto lv_bind_point = ConvertToLvlBindPoint(pipeline_bind_point);
@@ -1346,7 +1344,38 @@ void CMD_BUFFER_STATE::SetImageViewLayout(const IMAGE_VIEW_STATE &view_state, Vk
     }
 }
 
-void CMD_BUFFER_STATE::RecordCmd(CMD_TYPE cmd_type) { command_count++; }
+// The draw time state a command changes, commands that are not listed may change any of it
+static DrawStateDirtyFlags GetDrawStateDirtyFlags(CMD_TYPE cmd_type) {
+    switch (cmd_type) {
+        case CMD_BINDPIPELINE:
+            return DRAW_STATE_DIRTY_PIPELINE;
+        case CMD_BINDDESCRIPTORSETS:
+        case CMD_PUSHDESCRIPTORSETKHR:
+        case CMD_PUSHDESCRIPTORSETWITHTEMPLATEKHR:
+            // Binding an incompatible layout also disturbs the push constants
+            return DRAW_STATE_DIRTY_DESCRIPTOR_SETS | DRAW_STATE_DIRTY_PUSH_CONSTANTS;
+        case CMD_PUSHCONSTANTS:
+            return DRAW_STATE_DIRTY_PUSH_CONSTANTS;
+        case CMD_BINDVERTEXBUFFERS:
+        case CMD_BINDVERTEXBUFFERS2:
+        case CMD_BINDVERTEXBUFFERS2EXT:
+            return DRAW_STATE_DIRTY_VERTEX_INPUT;
+        case CMD_BEGINDEBUGUTILSLABELEXT:
+        case CMD_ENDDEBUGUTILSLABELEXT:
+        case CMD_INSERTDEBUGUTILSLABELEXT:
+        case CMD_DEBUGMARKERBEGINEXT:
+        case CMD_DEBUGMARKERENDEXT:
+        case CMD_DEBUGMARKERINSERTEXT:
+            return 0;
+        default:
+            return DRAW_STATE_DIRTY_ALL;
+    }
+}
+
+void CMD_BUFFER_STATE::RecordCmd(CMD_TYPE cmd_type) {
+    command_count++;
+    MarkDrawStateDirty(GetDrawStateDirtyFlags(cmd_type));
+}
 
 void CMD_BUFFER_STATE::RecordStateCmd(CMD_TYPE cmd_type, CBDynamicState state) {
     CBDynamicFlags state_bits;
@@ -1355,7 +1384,9 @@ void CMD_BUFFER_STATE::RecordStateCmd(CMD_TYPE cmd_type, CBDynamicState state) {
 }
 
 void CMD_BUFFER_STATE::RecordStateCmd(CMD_TYPE cmd_type, CBDynamicFlags const &state_bits) {
-    RecordCmd(cmd_type);
+    command_count++;
+    // vkCmdBindVertexBuffers2 with strides also changes the vertex bindings
+    MarkDrawStateDirty(DRAW_STATE_DIRTY_DYNAMIC_STATE | (GetDrawStateDirtyFlags(cmd_type) & DRAW_STATE_DIRTY_VERTEX_INPUT));
     dynamic_state_status.cb |= state_bits;
     dynamic_state_status.pipeline |= state_bits;
 }
@@ -116,6 +116,20 @@ enum CB_STATE {
     CB_INVALID_INCOMPLETE,  // fouled before recording was completed
 };
 
+// Inputs of the draw time checks. A command that may change one marks it with CMD_BUFFER_STATE::MarkDrawStateDirty(), so checks
+// whose inputs did not change since the previous draw can be skipped.
+enum DrawStateDirtyFlagBits : uint32_t {
+    DRAW_STATE_DIRTY_PIPELINE = 0x1,
+    DRAW_STATE_DIRTY_DESCRIPTOR_SETS = 0x2,  // descriptor sets, dynamic offsets and descriptor buffers
+    DRAW_STATE_DIRTY_DYNAMIC_STATE = 0x4,
+    DRAW_STATE_DIRTY_VERTEX_INPUT = 0x8,  // vertex and index buffer bindings
+    DRAW_STATE_DIRTY_RENDER_PASS = 0x10,  // render pass, subpass and attachments
+    DRAW_STATE_DIRTY_PUSH_CONSTANTS = 0x20,
+    DRAW_STATE_DIRTY_OTHER = 0x40,  // anything else a command changes: image layouts, queries, conditional rendering...
+    DRAW_STATE_DIRTY_ALL = 0x7f,
+};
+typedef uint32_t DrawStateDirtyFlags;
+
 struct BufferBinding {
     std::shared_ptr<BUFFER_STATE> buffer_state;
     VkDeviceSize size;
@@ -254,6 +268,9 @@ class CMD_BUFFER_STATE : public REFCOUNTED_NODE {
         VkFramebuffer framebuffer;
         std::shared_ptr<std::vector<SUBPASS_INFO>> subpasses;
         std::shared_ptr<std::vector<IMAGE_VIEW_STATE *>> attachments;
+        // Per binding_infos entry, one past the set change count the binding was last validated against without
+        // messages at submit time, or 0 if it never was
+        std::unique_ptr<std::atomic<uint64_t>[]> validated_versions;
     };
     vvl::unordered_map<VkDescriptorSet, std::vector<CmdDrawDispatchInfo>> validate_descriptorsets_in_queuesubmit;
 
@@ -585,6 +602,13 @@ class CMD_BUFFER_STATE : public REFCOUNTED_NODE {
     bool RasterizationDisabled() const;
     inline void BindPipeline(LvlBindPoint bind_point, PIPELINE_STATE *pipe_state) {
         lastBound[bind_point].pipeline_state = pipe_state;
+        MarkDrawStateDirty(DRAW_STATE_DIRTY_PIPELINE);
+    }
+    // Draw time state is tracked for all bind points, so a command does not need to know which ones it affects
+    void MarkDrawStateDirty(DrawStateDirtyFlags flags) {
+        for (auto &last_bound : lastBound) {
+            last_bound.draw_state_cache.dirty |= flags;
+        }
     }
 
     bool IsPrimary() const { return createInfo.level == VK_COMMAND_BUFFER_LEVEL_PRIMARY; }
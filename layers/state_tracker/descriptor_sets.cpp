@@ -381,7 +381,8 @@ cvdescriptorset::DescriptorSet::DescriptorSet(const VkDescriptorSet set, DESCRIP
       layout_(layout),
       state_data_(state_data),
       variable_count_(variable_count),
-      change_count_(0) {
+      change_count_(0),
+      invalidated_version_(0) {
     // Foreach binding, create default descriptors of given type
     auto binding_count = layout_->GetBindingCount();
     bindings_.reserve(binding_count);
@@ -482,6 +483,13 @@ void cvdescriptorset::DescriptorSet::Destroy() {
     }
     BASE_NODE::Destroy();
 }
+
+void cvdescriptorset::DescriptorSet::NotifyInvalidate(const NodeList &invalid_nodes, bool unlink) {
+    // A resource used by one of the descriptors was destroyed or lost its memory, which the per descriptor versions
+    // don't capture, so every descriptor must be validated again.
+    invalidated_version_ = ++change_count_;
+    BASE_NODE::NotifyInvalidate(invalid_nodes, unlink);
+}
 // Loop through the write updates to do for a push descriptor set, ignoring dstSet
 void cvdescriptorset::DescriptorSet::PerformPushDescriptorsUpdate(uint32_t write_count, const VkWriteDescriptorSet *write_descs) {
     assert(IsPushDescriptor());
@@ -505,12 +513,14 @@ void cvdescriptorset::DescriptorSet::PerformWriteUpdate(const VkWriteDescriptorS
     auto &orig_binding = iter.CurrentBinding();
 
     // Verify next consecutive binding matches type, stage flags & immutable sampler use and if AtEnd
+    const uint64_t version = change_count_ + 1;
     for (uint32_t i = 0; i < descriptors_remaining; ++i, ++iter) {
         if (iter.AtEnd() || !orig_binding.IsConsistent(iter.CurrentBinding())) {
             break;
         }
         iter->WriteUpdate(*this, *state_data_, update, i, iter.CurrentBinding().IsBindless());
         iter.updated(true);
+        iter.version(version);
     }
     if (update.descriptorCount) {
         some_update_ = true;
@@ -533,10 +543,12 @@ void cvdescriptorset::DescriptorSet::PerformCopyUpdate(const VkCopyDescriptorSet
         if (src_iter.updated()) {
             dst.CopyUpdate(*this, *state_data_, src, src_iter.CurrentBinding().IsBindless());
             some_update_ = true;
+            dst_iter.version(change_count_ + 1);
             ++change_count_;
             dst_iter.updated(true);
         } else {
             dst_iter.updated(false);
+            dst_iter.version(++change_count_);
         }
     }
 
@@ -609,7 +621,8 @@ void cvdescriptorset::DescriptorSet::UpdateDrawState(ValidationStateTracker *dev
             cmd_info.attachments = cb_state->active_attachments;
             cmd_info.subpasses = cb_state->active_subpasses;
         }
-        cb_state->validate_descriptorsets_in_queuesubmit[GetSet()].emplace_back(cmd_info);
+        cmd_info.validated_versions = std::make_unique<std::atomic<uint64_t>[]>(cmd_info.binding_infos.size());
+        cb_state->validate_descriptorsets_in_queuesubmit[GetSet()].emplace_back(std::move(cmd_info));
     }
 }
 
@@ -31,6 +31,8 @@
 #include "vulkan/vk_layer.h"
 #include "generated/vk_object_types.h"
 #include "generated/command_validation.h"
+#include <atomic>
+#include <limits>
 #include <map>
 #include <memory>
 #include <set>
@@ -726,7 +728,11 @@ class DescriptorBinding {
           binding_flags(binding_flags_),
           count(count_),
           has_immutable_samplers(create_info.pImmutableSamplers != nullptr),
-          updated(count_, false) {}
+          updated(count_, false) {
+        if (IsBindless() && count_ > 0) {
+            block_versions = std::make_unique<std::atomic<uint64_t>[]>((count_ + kVersionBlockSize - 1) / kVersionBlockSize);
+        }
+    }
     virtual ~DescriptorBinding() {}
 
     virtual void AddParent(DescriptorSet *ds) = 0;
@@ -751,6 +757,19 @@ class DescriptorBinding {
                has_immutable_samplers == other.has_immutable_samplers;
     }
 
+    // Bindless bindings remember the set change count of the last write to each block of kVersionBlockSize
+    // descriptors, so that submit time validation of large arrays only revisits the blocks written since it last ran.
+    // Other bindings are not versioned and always report the newest version.
+    static constexpr uint32_t kVersionBlockSize = 64;
+    uint64_t GetVersion(uint32_t index) const {
+        return block_versions ? block_versions[index / kVersionBlockSize].load() : std::numeric_limits<uint64_t>::max();
+    }
+    void SetVersion(uint32_t index, uint64_t version) {
+        if (block_versions) {
+            block_versions[index / kVersionBlockSize] = version;
+        }
+    }
+
     const uint32_t binding;
     const VkDescriptorType type;
     const DescriptorClass descriptor_class;
@@ -759,6 +778,7 @@ class DescriptorBinding {
     const uint32_t count;
     const bool has_immutable_samplers;
     small_vector<bool, 1, uint32_t> updated;
+    std::unique_ptr<std::atomic<uint64_t>[]> block_versions;
 };
 
 template <typename T>
@@ -939,10 +959,13 @@ class DescriptorSet : public BASE_NODE {
         return bindings_[pos.first]->GetDescriptor(pos.second);
     }
     uint64_t GetChangeCount() const { return change_count_; }
+    // Change count at which a resource used by one of the descriptors was last invalidated
+    uint64_t GetInvalidatedVersion() const { return invalidated_version_; }
 
     const std::vector<safe_VkWriteDescriptorSet> &GetWrites() const { return push_descriptor_set_writes; }
 
     void Destroy() override;
+    void NotifyInvalidate(const NodeList &invalid_nodes, bool unlink) override;
 
     // Cached binding and validation support:
     //
@@ -1025,6 +1048,8 @@ class DescriptorSet : public BASE_NODE {
 
         void updated(bool val) { CurrentBinding().updated[index_] = static_cast<uint32_t>(val); }
 
+        void version(uint64_t val) { CurrentBinding().SetVersion(index_, val); }
+
       private:
         Iter iter_;
         Iter end_;
@@ -1071,6 +1096,7 @@ class DescriptorSet : public BASE_NODE {
     StateTracker *state_data_;
     uint32_t variable_count_;
     std::atomic<uint64_t> change_count_;
+    std::atomic<uint64_t> invalidated_version_;
 
     // For a given dynamic offset index in the set, map to associated index of the descriptors in the set
     std::vector<std::pair<uint32_t, uint32_t>> dynamic_offset_idx_to_descriptor_list_;
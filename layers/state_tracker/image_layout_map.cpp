@@ -76,6 +76,23 @@ static bool UpdateLayoutStateImpl(LayoutsMap& layouts, InitialLayoutStates& init
     return updated_current;
 }
 
+// Ranges covering the whole image skip the range generator, which matters for the common single mip, layer and aspect
+// images where every range is the whole image. If the whole image is already a single entry it is updated in place.
+template <typename LayoutsMap>
+static bool UpdateFullRangeLayoutStateImpl(LayoutsMap& layouts, InitialLayoutStates& initial_layout_states, IndexType count,
+                                           LayoutEntry& new_entry, const CMD_BUFFER_STATE& cb_state,
+                                           const IMAGE_VIEW_STATE* view_state) {
+    const IndexRange full_range(0, count);
+    auto it = layouts.begin();
+    if (it != layouts.end() && it->first == full_range) {
+        if (!it->second.CurrentWillChange(new_entry.current_layout)) {
+            return false;
+        }
+        return it->second.Update(new_entry);
+    }
+    return UpdateLayoutStateImpl(layouts, initial_layout_states, full_range, new_entry, cb_state, view_state);
+}
+
 InitialLayoutState::InitialLayoutState(const CMD_BUFFER_STATE& cb_state_, const IMAGE_VIEW_STATE* view_state_)
     : image_view(VK_NULL_HANDLE), aspect_mask(0), label(cb_state_.debug_label) {
     if (view_state_) {
@@ -114,6 +131,10 @@ bool ImageSubresourceLayoutMap::SetSubresourceRangeLayout(const CMD_BUFFER_STATE
     }
     if (!InRange(range)) return false;  // Don't even try to track bogus subreources
 
+    if (encoder_.IsFullRange(range)) {
+        LayoutEntry entry(expected_layout, layout);
+        return UpdateFullRangeLayoutState(entry, cb_state, nullptr);
+    }
     RangeGenerator range_gen(encoder_, range);
     if (layouts_.SmallMode()) {
         return SetSubresourceRangeLayoutImpl(layouts_.GetSmallMap(), initial_layout_states_, range_gen, cb_state, layout,
@@ -141,6 +162,11 @@ void ImageSubresourceLayoutMap::SetSubresourceRangeInitialLayout(const CMD_BUFFE
                                                                  const VkImageSubresourceRange& range, VkImageLayout layout) {
     if (!InRange(range)) return;  // Don't even try to track bogus subreources
 
+    if (encoder_.IsFullRange(range)) {
+        LayoutEntry entry(layout);
+        UpdateFullRangeLayoutState(entry, cb_state, nullptr);
+        return;
+    }
     RangeGenerator range_gen(encoder_, range);
     if (layouts_.SmallMode()) {
         SetSubresourceRangeInitialLayoutImpl(layouts_.GetSmallMap(), initial_layout_states_, range_gen, cb_state, layout, nullptr);
@@ -153,6 +179,11 @@ void ImageSubresourceLayoutMap::SetSubresourceRangeInitialLayout(const CMD_BUFFE
 // Unwrap the BothMaps entry here as this is a performance hotspot.
 void ImageSubresourceLayoutMap::SetSubresourceRangeInitialLayout(const CMD_BUFFER_STATE& cb_state, VkImageLayout layout,
                                                                  const IMAGE_VIEW_STATE& view_state) {
+    if (encoder_.IsFullRange(view_state.normalized_subresource_range)) {
+        LayoutEntry entry(layout);
+        UpdateFullRangeLayoutState(entry, cb_state, &view_state);
+        return;
+    }
     RangeGenerator range_gen(view_state.range_generator);
     if (layouts_.SmallMode()) {
         SetSubresourceRangeInitialLayoutImpl(layouts_.GetSmallMap(), initial_layout_states_, range_gen, cb_state, layout,
@@ -164,6 +195,18 @@ void ImageSubresourceLayoutMap::SetSubresourceRangeInitialLayout(const CMD_BUFFE
     }
 }
 
+bool ImageSubresourceLayoutMap::UpdateFullRangeLayoutState(LayoutEntry& new_entry, const CMD_BUFFER_STATE& cb_state,
+                                                           const IMAGE_VIEW_STATE* view_state) {
+    if (layouts_.SmallMode()) {
+        return UpdateFullRangeLayoutStateImpl(layouts_.GetSmallMap(), initial_layout_states_, encoder_.SubresourceCount(),
+                                              new_entry, cb_state, view_state);
+    } else {
+        assert(!layouts_.Tristate());
+        return UpdateFullRangeLayoutStateImpl(layouts_.GetBigMap(), initial_layout_states_, encoder_.SubresourceCount(),
+                                              new_entry, cb_state, view_state);
+    }
+}
+
 // TODO: make sure this paranoia check is sufficient and not too much.
 uintptr_t ImageSubresourceLayoutMap::CompatibilityKey() const {
     return (reinterpret_cast<uintptr_t>(&image_state_) ^ encoder_.AspectMask());
@@ -20,6 +20,7 @@
  */
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <vector>
@@ -125,6 +126,11 @@ class ImageSubresourceLayoutMap {
     ~ImageSubresourceLayoutMap() {}
     const IMAGE_STATE* GetImageView() const { return &image_state_; };
 
+    // Epoch of the image's global layout map the initial layouts were last verified against without messages, 0 if never.
+    // Only set by submit time validation, once recording has ended and the map can no longer change.
+    uint64_t GetValidatedEpoch() const { return validated_epoch_; }
+    void SetValidatedEpoch(uint64_t epoch) const { validated_epoch_ = epoch; }
+
     // This looks a bit ponderous but kAspectCount is a compile time constant
     VkImageSubresource Decode(IndexType index) const {
         const auto subres = encoder_.Decode(index);
@@ -164,9 +170,12 @@ class ImageSubresourceLayoutMap {
     bool InRange(const VkImageSubresourceRange& range) const { return encoder_.InRange(range); }
 
   private:
+    bool UpdateFullRangeLayoutState(LayoutEntry& new_entry, const CMD_BUFFER_STATE& cb_state, const IMAGE_VIEW_STATE* view_state);
+
     const IMAGE_STATE& image_state_;
     const Encoder& encoder_;
     LayoutMap layouts_;
     InitialLayoutStates initial_layout_states_;
+    mutable std::atomic<uint64_t> validated_epoch_{0};
 };
 }  // namespace image_layout_map
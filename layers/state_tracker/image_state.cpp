@@ -23,6 +23,8 @@
 #include <limits>
 #include <string_view>
 
+std::atomic<uint64_t> GlobalImageLayoutRangeMap::epoch_counter_{0};
+
 static VkImageSubresourceRange MakeImageFullRange(const VkImageCreateInfo &create_info) {
     const auto format = create_info.format;
     VkImageSubresourceRange init_range{0, 0, VK_REMAINING_MIP_LEVELS, 0, VK_REMAINING_ARRAY_LAYERS};
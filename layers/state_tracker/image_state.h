@@ -60,12 +60,20 @@ static inline VkImageSubresourceRange RangeFromLayers(const VkImageSubresourceLa
 
 class GlobalImageLayoutRangeMap : public subresource_adapter::BothRangeMap<VkImageLayout, 16> {
   public:
-    GlobalImageLayoutRangeMap(index_type index) : BothRangeMap<VkImageLayout, 16>(index) {}
+    GlobalImageLayoutRangeMap(index_type index) : BothRangeMap<VkImageLayout, 16>(index), epoch_(++epoch_counter_) {}
     ReadLockGuard ReadLock() const { return ReadLockGuard(lock_); }
     WriteLockGuard WriteLock() { return WriteLockGuard(lock_); }
 
+    // The epoch changes every time the layouts in the map change and is never reused, not even by other maps. Validation
+    // that only depends on the layouts can be skipped while the epoch it last ran against is current.
+    // Both must be called under the map's lock.
+    uint64_t GetEpoch() const { return epoch_; }
+    void NextEpoch() { epoch_ = ++epoch_counter_; }
+
   private:
+    static std::atomic<uint64_t> epoch_counter_;
     mutable std::shared_mutex lock_;
+    uint64_t epoch_;
 };
 
 // State for VkImage objects.
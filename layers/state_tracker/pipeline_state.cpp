@@ -857,6 +857,7 @@ void LAST_BOUND_STATE::Reset() {
     }
     push_descriptor_set.reset();
     per_set.clear();
+    draw_state_cache = {};
 }
 
 bool LAST_BOUND_STATE::IsDepthTestEnable() const {
@@ -26,6 +26,7 @@
 #include "state_tracker/pipeline_layout_state.h"
 #include "state_tracker/pipeline_sub_state.h"
 #include "generated/dynamic_state_helper.h"
+#include "generated/command_validation.h"
 
 // Fwd declarations -- including descriptor_set.h creates an ugly include loop
 namespace cvdescriptorset {
@@ -811,6 +812,16 @@ struct LAST_BOUND_STATE {
 
     std::vector<PER_SET> per_set;
 
+    // Cache of the draw time checks of CoreChecks::ValidateCmdBufDrawState that passed without a message.
+    // Written while validating, which is safe as command buffers are externally synchronized.
+    struct DrawStateCache {
+        uint32_t dirty{~0U};        // DrawStateDirtyFlagBits set since the last validated draw, see MarkDrawStateDirty()
+        uint32_t passed_checks{0};  // checks that passed and whose inputs have not changed since, defined by CoreChecks
+        CMD_TYPE cmd_type{CMD_NONE};
+        uint64_t descriptor_change_count{0};  // the bound sets' change counts and the image layout change count, summed
+    };
+    mutable DrawStateCache draw_state_cache;
+
     void Reset();
 
     void UnbindAndResetPushDescriptorSet(std::shared_ptr<cvdescriptorset::DescriptorSet> &&ds);
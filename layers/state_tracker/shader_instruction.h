@@ -16,12 +16,11 @@
  */
 #pragma once
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
 #include <string>
-#include <vector>
-#include "containers/custom_containers.h"
 #include <spirv/unified1/spirv.hpp>
 
 struct SHADER_MODULE_STATE;
@@ -36,11 +35,14 @@ struct AtomicInstructionInfo {
 // Provides easy access to len, opcode, and content words without the caller needing to care too much about the physical SPIRV
 // module layout.
 //
+// The words are not copied, the Instruction is a view into the SPIR-V words of the SHADER_MODULE_STATE it was parsed from and
+// must not outlive it.
+//
 // For more information of the physical module layout to help understand this struct:
 // https://github.com/KhronosGroup/SPIRV-Guide/blob/main/chapters/parsing_instructions.md
 class Instruction {
   public:
-    Instruction(std::vector<uint32_t>::const_iterator it);
+    explicit Instruction(const uint32_t* words);
     ~Instruction() = default;
 
     // The word used to define the Instruction
@@ -80,19 +82,14 @@ class Instruction {
     // Auto-generated helper functions
     spv::StorageClass StorageClass() const;
 
-    bool operator==(Instruction const& other) const { return words_ == other.words_; }
-    bool operator!=(Instruction const& other) const { return words_ != other.words_; }
+    bool operator==(Instruction const& other) const {
+        return Length() == other.Length() && std::equal(words_, words_ + Length(), other.words_);
+    }
+    bool operator!=(Instruction const& other) const { return !(*this == other); }
 
   private:
-    // When this class was created, for SPIR-V Instructions that could be used in Vulkan,
-    //   414 of 423 had 6 or less operands
-    //   361 of 423 had 5 or less operands
-    //   287 of 423 had 4 or less operands
-    // An extra word is still needed because each insturction has one word prior to the operands
-    static constexpr uint32_t word_vector_length = 7;
-
-    // Max capacity needs to be uint32_t because an instruction can have a string operand that is (2^16)-1 bytes long
-    small_vector<uint32_t, word_vector_length, uint32_t> words_;
+    // First word of the instruction inside SHADER_MODULE_STATE::words_
+    const uint32_t* words_;
     uint32_t result_id_index_ = 0;
     uint32_t type_id_index_ = 0;
 };
@@ -15,12 +15,14 @@
 
 #include "state_tracker/shader_module.h"
 
+#include <algorithm>
 #include <sstream>
 #include <string>
 
 #include "state_tracker/pipeline_state.h"
 #include "state_tracker/descriptor_sets.h"
 #include "generated/spirv_grammar_helper.h"
+#include "external/xxhash.h"
 
 void DecorationBase::Add(uint32_t decoration, uint32_t value) {
     switch (decoration) {
@@ -735,12 +737,13 @@ std::optional<VkPrimitiveTopology> SHADER_MODULE_STATE::GetTopology(const EntryP
     return result;
 }
 
-SHADER_MODULE_STATE::StaticData::StaticData(const SHADER_MODULE_STATE& module_state) {
+void SHADER_MODULE_STATE::StaticData::Parse(const SHADER_MODULE_STATE& module_state) {
     // Parse the words first so we have instruction class objects to use
     {
-        std::vector<uint32_t>::const_iterator it = module_state.words_.cbegin();
+        const uint32_t* it = module_state.words_.data();
+        const uint32_t* end = it + module_state.words_.size();
         it += 5;  // skip first 5 word of header
-        while (it != module_state.words_.cend()) {
+        while (it < end) {
             Instruction insn(it);
             const uint32_t opcode = insn.Opcode();
 
@@ -758,17 +761,19 @@ SHADER_MODULE_STATE::StaticData::StaticData(const SHADER_MODULE_STATE& module_st
     }
 
     // These have their own object class, but need entire module parsed first
+    std::vector<const Instruction*> execution_mode_instructions;
     std::vector<const Instruction*> entry_point_instructions;
     std::vector<const Instruction*> type_struct_instructions;
     std::vector<const Instruction*> image_instructions;
 
     // Loop through once and build up the static data
     // Also process the entry points
+    definitions.reserve(instructions.size());
     for (const Instruction& insn : instructions) {
         // Build definition list
         const uint32_t result_id = insn.ResultId();
         if (result_id != 0) {
-            definitions[result_id] = &insn;
+            definitions.emplace_back(result_id, &insn);
         }
 
         switch (insn.Opcode()) {
@@ -784,7 +789,6 @@ SHADER_MODULE_STATE::StaticData::StaticData(const SHADER_MODULE_STATE& module_st
             // Decorations
             case spv::OpDecorate: {
                 const uint32_t target_id = insn.Word(1);
-                decorations[target_id].Add(insn.Word(2), insn.Length() > 3u ? insn.Word(3) : 0u);
                 decoration_inst.push_back(&insn);
                 if (insn.Word(2) == spv::DecorationBuiltIn) {
                     builtin_decoration_inst.push_back(&insn);
@@ -793,9 +797,6 @@ SHADER_MODULE_STATE::StaticData::StaticData(const SHADER_MODULE_STATE& module_st
                 }
             } break;
             case spv::OpMemberDecorate: {
-                const uint32_t target_id = insn.Word(1);
-                const uint32_t member_index = insn.Word(2);
-                decorations[target_id].member_decorations[member_index].Add(insn.Word(3), insn.Length() > 4u ? insn.Word(4) : 0u);
                 member_decoration_inst.push_back(&insn);
                 if (insn.Word(3) == spv::DecorationBuiltIn) {
                     builtin_decoration_inst.push_back(&insn);
@@ -818,7 +819,7 @@ SHADER_MODULE_STATE::StaticData::StaticData(const SHADER_MODULE_STATE& module_st
             // Execution Mode
             case spv::OpExecutionMode:
             case spv::OpExecutionModeId: {
-                execution_modes[insn.Word(1)].Add(insn);
+                execution_mode_instructions.push_back(&insn);
             } break;
             // Listed from vkspec.html#ray-tracing-repack
             case spv::OpTraceRayKHR:
@@ -936,6 +937,63 @@ SHADER_MODULE_STATE::StaticData::StaticData(const SHADER_MODULE_STATE& module_st
         }
     }
 
+    // Sort the <id> indexes now that every instruction is known, nothing is added to them after this.
+    // An <id> defined more than once (invalid SPIR-V) keeps its last definition. The sort is stable, and the duplicates are
+    // removed from the back, so that is the one that stays.
+    using IdDefinition = std::pair<uint32_t, const Instruction*>;
+    std::stable_sort(definitions.begin(), definitions.end(),
+                     [](const IdDefinition& a, const IdDefinition& b) { return a.first < b.first; });
+    const auto last_definitions = std::unique(definitions.rbegin(), definitions.rend(),
+                                              [](const IdDefinition& a, const IdDefinition& b) { return a.first == b.first; });
+    definitions.erase(definitions.begin(), last_definitions.base());
+    definitions.shrink_to_fit();
+    {
+        std::vector<uint32_t> decorated_ids;
+        decorated_ids.reserve(decoration_inst.size() + member_decoration_inst.size());
+        for (const Instruction* insn : decoration_inst) {
+            decorated_ids.push_back(insn->Word(1));
+        }
+        for (const Instruction* insn : member_decoration_inst) {
+            decorated_ids.push_back(insn->Word(1));
+        }
+        std::sort(decorated_ids.begin(), decorated_ids.end());
+        decorated_ids.erase(std::unique(decorated_ids.begin(), decorated_ids.end()), decorated_ids.end());
+        decorations.reserve(decorated_ids.size());
+        for (const uint32_t id : decorated_ids) {
+            decorations.emplace_back(id, DecorationSet());
+        }
+
+        // decorations has the same order as decorated_ids
+        auto get_decoration_set = [this, &decorated_ids](uint32_t id) -> DecorationSet& {
+            return decorations[std::lower_bound(decorated_ids.begin(), decorated_ids.end(), id) - decorated_ids.begin()].second;
+        };
+        for (const Instruction* insn : decoration_inst) {
+            get_decoration_set(insn->Word(1)).Add(insn->Word(2), insn->Length() > 3u ? insn->Word(3) : 0u);
+        }
+        for (const Instruction* insn : member_decoration_inst) {
+            const uint32_t member_index = insn->Word(2);
+            get_decoration_set(insn->Word(1)).member_decorations[member_index].Add(insn->Word(3),
+                                                                                   insn->Length() > 4u ? insn->Word(4) : 0u);
+        }
+    }
+    {
+        std::vector<uint32_t> function_ids;
+        function_ids.reserve(execution_mode_instructions.size());
+        for (const Instruction* insn : execution_mode_instructions) {
+            function_ids.push_back(insn->Word(1));
+        }
+        std::sort(function_ids.begin(), function_ids.end());
+        function_ids.erase(std::unique(function_ids.begin(), function_ids.end()), function_ids.end());
+        execution_modes.reserve(function_ids.size());
+        for (const uint32_t id : function_ids) {
+            execution_modes.emplace_back(id, ExecutionModeSet());
+        }
+        for (const Instruction* insn : execution_mode_instructions) {
+            const auto index = std::lower_bound(function_ids.begin(), function_ids.end(), insn->Word(1)) - function_ids.begin();
+            execution_modes[index].second.Add(*insn);
+        }
+    }
+
     for (const Instruction* decoration_inst : builtin_decoration_inst) {
         if (decoration_inst->GetBuiltIn() == spv::BuiltInLayer) {
             has_builtin_layer = true;
@@ -1993,3 +2051,34 @@ uint32_t SHADER_MODULE_STATE::GetTexelComponentCount(const Instruction& insn) co
     }
     return texel_component_count;
 }
+
+uint32_t SpirvDataCache::Hash(vvl::span<const uint32_t> code) {
+    return XXH32(code.data(), code.size() * sizeof(uint32_t), 0);
+}
+
+std::shared_ptr<const SHADER_MODULE_STATE::SpirvData> SpirvDataCache::Find(uint32_t hash, vvl::span<const uint32_t> code) {
+    std::shared_ptr<const SHADER_MODULE_STATE::SpirvData> spirv_data;
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        auto it = map_.find(hash);
+        if (it != map_.end()) {
+            spirv_data = it->second.lock();
+            if (!spirv_data) {
+                map_.erase(it);  // every module using it was destroyed
+            }
+        }
+    }
+    // The hash only narrows it down, the SPIR-V has to be the same to share what was parsed from it
+    if (spirv_data && spirv_data->words.size() == code.size() && std::equal(code.begin(), code.end(), spirv_data->words.begin())) {
+        hits_++;
+        return spirv_data;
+    }
+    misses_++;
+    return nullptr;
+}
+
+void SpirvDataCache::Add(uint32_t hash, const std::shared_ptr<const SHADER_MODULE_STATE::SpirvData>& spirv_data) {
+    std::lock_guard<std::mutex> guard(lock_);
+    // On a hash collision the newest module wins, the other one still works but is parsed again next time
+    map_[hash] = spirv_data;
+}
@@ -17,9 +17,13 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cstdlib>
 #include <cstring>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -413,23 +417,34 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
     // The goal of this struct is to move everything that is ready only into here
     struct StaticData {
         StaticData() = default;
-        StaticData(const SHADER_MODULE_STATE &module_state);
         StaticData &operator=(StaticData &&) = default;
         StaticData(StaticData &&) = default;
 
+        // Builds everything in place, the helpers of module_state used while parsing read back from this StaticData
+        void Parse(const SHADER_MODULE_STATE &module_state);
+
+        // Binary search in one of the <id> indexes below, they are flat vectors sorted by <id> once the module is parsed
+        template <typename T>
+        static const T *FindById(const std::vector<std::pair<uint32_t, T>> &index, uint32_t id) {
+            const auto it = std::lower_bound(index.begin(), index.end(), id, [](const std::pair<uint32_t, T> &entry, uint32_t value) {
+                return entry.first < value;
+            });
+            return (it != index.end() && it->first == id) ? &it->second : nullptr;
+        }
+
         // List of all instructions in the order they appear in the binary
         std::vector<Instruction> instructions;
         // Instructions that can be referenced by Ids
         // A mapping of <id> to the first word of its def. this is useful because walking type
         // trees, constant expressions, etc requires jumping all over the instruction stream.
-        vvl::unordered_map<uint32_t, const Instruction *> definitions;
+        std::vector<std::pair<uint32_t, const Instruction *>> definitions;
 
-        vvl::unordered_map<uint32_t, DecorationSet> decorations;
+        std::vector<std::pair<uint32_t, DecorationSet>> decorations;
         DecorationSet empty_decoration;  // all zero values, allows use to return a reference and not a copy each time
 
         // Execution Modes are tied to a Function <id>, multiple EntryPoints can point to the same Funciton <id>
         // Keep a mapping so each EntryPoint can grab a reference to it
-        vvl::unordered_map<uint32_t, ExecutionModeSet> execution_modes;
+        std::vector<std::pair<uint32_t, ExecutionModeSet>> execution_modes;
         ExecutionModeSet empty_execution_mode;  // all zero values, allows use to return a reference and not a copy each time
 
         // <Specialization constant ID -> target ID> mapping
@@ -481,32 +496,55 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
         vvl::unordered_map<uint32_t, uint32_t> image_texel_pointer_members;               // <result id, image>
     };
 
+    // The SPIR-V words and everything parsed from them. Never changes once parsed, so every SHADER_MODULE_STATE created from the
+    // same SPIR-V can share it (see SpirvDataCache)
+    struct SpirvData {
+        SpirvData() = default;
+        explicit SpirvData(vvl::span<const uint32_t> code) : words(code.begin(), code.end()) {}
+
+        std::vector<uint32_t> words;
+        StaticData static_data;
+    };
+
+    // Owns what words_ and static_data_ refer to
+    const std::shared_ptr<const SpirvData> spirv_data_;
+
     // This is the SPIR-V module data content
-    const std::vector<uint32_t> words_;
+    const std::vector<uint32_t> &words_;
 
     const bool has_valid_spirv{false};
-    const StaticData static_data_;
+    const StaticData &static_data_;
 
     uint32_t gpu_validation_shader_id{std::numeric_limits<uint32_t>::max()};
 
     explicit SHADER_MODULE_STATE(vvl::span<const uint32_t> code)
-        : BASE_NODE(static_cast<VkShaderModule>(VK_NULL_HANDLE), kVulkanObjectTypeShaderModule),
-          words_(code.begin(), code.end()),
-          static_data_(*this) {}
+        : SHADER_MODULE_STATE(std::make_shared<SpirvData>(code), static_cast<VkShaderModule>(VK_NULL_HANDLE), false,
+                              std::numeric_limits<uint32_t>::max()) {}
 
+    // Not make_shared, SpirvDataCache keeps a weak_ptr to it which would keep the whole SpirvData allocated after it expires
     SHADER_MODULE_STATE(const VkShaderModuleCreateInfo &create_info, VkShaderModule shaderModule, uint32_t unique_shader_id)
+        : SHADER_MODULE_STATE(
+              std::shared_ptr<SpirvData>(new SpirvData(vvl::make_span(create_info.pCode, create_info.codeSize / sizeof(uint32_t)))),
+              shaderModule, true, unique_shader_id) {}
+
+    // Shares the SpirvData already parsed for another SHADER_MODULE_STATE with the same SPIR-V
+    SHADER_MODULE_STATE(std::shared_ptr<const SpirvData> spirv_data, VkShaderModule shaderModule, uint32_t unique_shader_id)
         : BASE_NODE(shaderModule, kVulkanObjectTypeShaderModule),
-          words_(create_info.pCode, create_info.pCode + create_info.codeSize / sizeof(uint32_t)),
+          spirv_data_(std::move(spirv_data)),
+          words_(spirv_data_->words),
           has_valid_spirv(true),
-          static_data_(*this),
+          static_data_(spirv_data_->static_data),
           gpu_validation_shader_id(unique_shader_id) {}
 
-    SHADER_MODULE_STATE() : BASE_NODE(static_cast<VkShaderModule>(VK_NULL_HANDLE), kVulkanObjectTypeShaderModule) {}
+    SHADER_MODULE_STATE()
+        : BASE_NODE(static_cast<VkShaderModule>(VK_NULL_HANDLE), kVulkanObjectTypeShaderModule),
+          spirv_data_(std::make_shared<SpirvData>()),
+          words_(spirv_data_->words),
+          static_data_(spirv_data_->static_data) {}
 
     const Instruction *FindDef(uint32_t id) const {
-        auto it = static_data_.definitions.find(id);
-        if (it == static_data_.definitions.end()) return nullptr;
-        return it->second;
+        const auto def = StaticData::FindById(static_data_.definitions, id);
+        return def ? *def : nullptr;
     }
 
     const std::vector<Instruction> &GetInstructions() const { return static_data_.instructions; }
@@ -518,14 +556,14 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
 
     const DecorationSet &GetDecorationSet(uint32_t id) const {
         // return the actual decorations for this id, or a default empty set.
-        const auto it = static_data_.decorations.find(id);
-        return (it != static_data_.decorations.end()) ? it->second : static_data_.empty_decoration;
+        const auto decoration_set = StaticData::FindById(static_data_.decorations, id);
+        return decoration_set ? *decoration_set : static_data_.empty_decoration;
     }
 
     const ExecutionModeSet &GetExecutionModeSet(uint32_t function_id) const {
         // return the actual execution modes for this id, or a default empty set.
-        const auto it = static_data_.execution_modes.find(function_id);
-        return (it != static_data_.execution_modes.end()) ? it->second : static_data_.empty_execution_mode;
+        const auto execution_mode = StaticData::FindById(static_data_.execution_modes, function_id);
+        return execution_mode ? *execution_mode : static_data_.empty_execution_mode;
     }
 
     std::shared_ptr<const TypeStructInfo> GetTypeStructInfo(uint32_t struct_id) const {
@@ -582,4 +620,38 @@ struct SHADER_MODULE_STATE : public BASE_NODE {
         return std::any_of(static_data_.capability_list.begin(), static_data_.capability_list.end(),
                            [find_capability](const spv::Capability &capability) { return capability == find_capability; });
     }
+
+  private:
+    // Parses the new spirv_data, which nothing else can see yet
+    SHADER_MODULE_STATE(std::shared_ptr<SpirvData> &&spirv_data, VkShaderModule shaderModule, bool valid_spirv,
+                        uint32_t unique_shader_id)
+        : BASE_NODE(shaderModule, kVulkanObjectTypeShaderModule),
+          spirv_data_(spirv_data),
+          words_(spirv_data_->words),
+          has_valid_spirv(valid_spirv),
+          static_data_(spirv_data_->static_data),
+          gpu_validation_shader_id(unique_shader_id) {
+        spirv_data->static_data.Parse(*this);
+    }
+};
+
+// Device level cache of SHADER_MODULE_STATE::SpirvData keyed by the hash of the SPIR-V, so creating a shader module (or an inline
+// VkShaderModuleCreateInfo) with SPIR-V already seen only costs a hash and a lookup instead of parsing it again.
+// Only holds weak references, the SpirvData is freed with the last SHADER_MODULE_STATE using it.
+// Hits and misses are reported at vkDestroyDevice with report_stats.
+class SpirvDataCache {
+  public:
+    static uint32_t Hash(vvl::span<const uint32_t> code);
+
+    std::shared_ptr<const SHADER_MODULE_STATE::SpirvData> Find(uint32_t hash, vvl::span<const uint32_t> code);
+    void Add(uint32_t hash, const std::shared_ptr<const SHADER_MODULE_STATE::SpirvData> &spirv_data);
+
+    uint64_t Hits() const { return hits_.load(); }
+    uint64_t Misses() const { return misses_.load(); }
+
+  private:
+    std::mutex lock_;
+    vvl::unordered_map<uint32_t, std::weak_ptr<const SHADER_MODULE_STATE::SpirvData>> map_;
+    std::atomic<uint64_t> hits_{0};
+    std::atomic<uint64_t> misses_{0};
 };
@@ -19,6 +19,7 @@
  */
 
 #include <algorithm>
+#include <cinttypes>
 
 #include "generated/vk_format_utils.h"
 #include "containers/custom_containers.h"
@@ -1705,6 +1706,12 @@ void ValidationStateTracker::CreateDevice(const VkDeviceCreateInfo *pCreateInfo)
 void ValidationStateTracker::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator) {
     if (!device) return;
 
+    if (report_stats && (spirv_data_cache_.Hits() || spirv_data_cache_.Misses())) {
+        LogInfo(device, "UNASSIGNED-DestroyDevice-spirv-data-cache-stats",
+                "Shader module SPIR-V cache: %" PRIu64 " hits (SPIR-V not parsed again), %" PRIu64 " misses.",
+                spirv_data_cache_.Hits(), spirv_data_cache_.Misses());
+    }
+
     command_pool_map_.clear();
     assert(command_buffer_map_.empty());
     pipeline_map_.clear();
@@ -3238,6 +3245,7 @@ void ValidationStateTracker::PreCallRecordCmdBindDescriptorBuffersEXT(VkCommandB
     cb_state->descriptor_buffer_binding_info.resize(bufferCount);
 
     std::copy(pBindingInfos, pBindingInfos + bufferCount, cb_state->descriptor_buffer_binding_info.data());
+    cb_state->MarkDrawStateDirty(DRAW_STATE_DIRTY_DESCRIPTOR_SETS);
 }
 
 void ValidationStateTracker::PreCallRecordCmdSetDescriptorBufferOffsetsEXT(VkCommandBuffer commandBuffer,
@@ -3271,6 +3279,7 @@ void ValidationStateTracker::PreCallRecordCmdBindIndexBuffer(VkCommandBuffer com
     auto cb_state = GetWrite<CMD_BUFFER_STATE>(commandBuffer);
 
     cb_state->index_buffer_binding = IndexBufferBinding(Get<BUFFER_STATE>(buffer), offset, indexType);
+    cb_state->MarkDrawStateDirty(DRAW_STATE_DIRTY_VERTEX_INPUT);
 
     // Add binding for this index buffer to this commandbuffer
     if (!disabled[command_buffer_state]) {
@@ -3694,6 +3703,7 @@ void ValidationStateTracker::RecordCmdEndRenderingRenderPassState(VkCommandBuffe
     auto cb_state = GetWrite<CMD_BUFFER_STATE>(commandBuffer);
     cb_state->activeRenderPass = nullptr;
     cb_state->active_color_attachments_index.clear();
+    cb_state->MarkDrawStateDirty(DRAW_STATE_DIRTY_RENDER_PASS);
 }
 
 void ValidationStateTracker::PreCallRecordCmdBeginRenderingKHR(VkCommandBuffer commandBuffer,
@@ -4477,19 +4487,15 @@ void ValidationStateTracker::PreCallRecordCmdBeginDebugUtilsLabelEXT(VkCommandBu
                                                                      const VkDebugUtilsLabelEXT *pLabelInfo) {
     auto cb_state = GetWrite<CMD_BUFFER_STATE>(commandBuffer);
     cb_state->RecordCmd(CMD_BEGINDEBUGUTILSLABELEXT);
-    BeginCmdDebugUtilsLabel(report_data, commandBuffer, pLabelInfo);
 }
 
 void ValidationStateTracker::PostCallRecordCmdEndDebugUtilsLabelEXT(VkCommandBuffer commandBuffer) {
     auto cb_state = GetWrite<CMD_BUFFER_STATE>(commandBuffer);
     cb_state->RecordCmd(CMD_ENDDEBUGUTILSLABELEXT);
-    EndCmdDebugUtilsLabel(report_data, commandBuffer);
 }
 
 void ValidationStateTracker::PreCallRecordCmdInsertDebugUtilsLabelEXT(VkCommandBuffer commandBuffer,
                                                                       const VkDebugUtilsLabelEXT *pLabelInfo) {
-    InsertCmdDebugUtilsLabel(report_data, commandBuffer, pLabelInfo);
-
     auto cb_state = GetWrite<CMD_BUFFER_STATE>(commandBuffer);
     cb_state->RecordCmd(CMD_INSERTDEBUGUTILSLABELEXT);
     // Squirrel away an easily accessible copy.
@@ -5009,6 +5015,12 @@ std::shared_ptr<SHADER_MODULE_STATE> ValidationStateTracker::CreateShaderModuleS
     if ((create_info.pCode[0] != spv::MagicNumber)) {
         return std::make_shared<SHADER_MODULE_STATE>();  // not valid SPIR-V
     }
+    // Engines often create the same SPIR-V many times, only parse it once
+    const auto code = vvl::make_span(create_info.pCode, create_info.codeSize / sizeof(uint32_t));
+    const uint32_t hash = SpirvDataCache::Hash(code);
+    if (auto spirv_data = spirv_data_cache_.Find(hash, code)) {
+        return std::make_shared<SHADER_MODULE_STATE>(std::move(spirv_data), handle, unique_shader_id);
+    }
     const auto module_state = std::make_shared<SHADER_MODULE_STATE>(create_info, handle, unique_shader_id);
     if (module_state->static_data_.has_group_decoration) {
         spvtools::Optimizer optimizer(spirv_environment);
@@ -5028,6 +5040,7 @@ std::shared_ptr<SHADER_MODULE_STATE> ValidationStateTracker::CreateShaderModuleS
             return std::make_shared<SHADER_MODULE_STATE>(new_create_info, handle, unique_shader_id);
         }
     }
+    spirv_data_cache_.Add(hash, module_state->spirv_data_);
     return module_state;
 }
 
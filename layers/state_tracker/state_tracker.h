@@ -26,6 +26,7 @@
 #include "state_tracker/query_state.h"
 #include "state_tracker/ray_tracing_state.h"
 #include "state_tracker/video_session_state.h"
+#include "state_tracker/shader_module.h"
 #include "generated/command_validation.h"
 #include "generated/layer_chassis_dispatch.h"
 #include "error_message/logging.h"
@@ -1625,6 +1626,9 @@ class ValidationStateTracker : public ValidationObject {
     vvl::unordered_map<VkShaderModuleIdentifierEXT, std::shared_ptr<SHADER_MODULE_STATE>> shader_identifier_map_;
     mutable std::shared_mutex shader_identifier_map_lock_;
 
+    // Parsed SPIR-V shared by all shader modules created with the same code
+    mutable SpirvDataCache spirv_data_cache_;
+
     // If vkGetMemoryFdKHR is called, keep track of fd handle -> allocation info
     vvl::unordered_map<int, VkMemoryAllocateInfo> fd_handle_map_;
     mutable std::shared_mutex fd_handle_map_lock_;
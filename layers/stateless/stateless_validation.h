@@ -511,9 +511,6 @@ class StatelessValidation : public ValidationObject {
         bool skip_call = false;
 
         if (next != nullptr) {
-            vvl::unordered_set<const void *> cycle_check;
-            vvl::unordered_set<VkStructureType, vvl::hash<int>> unique_stype_check;
-
             const char *disclaimer =
                 "This error is based on the Valid Usage documentation for version %d of the Vulkan header.  It is possible that "
                 "you are using a struct from a private extension or an extension that was added to a later version of the Vulkan "
@@ -529,21 +526,43 @@ class StatelessValidation : public ValidationObject {
                 const VkStructureType *end = allowed_types + allowed_type_count;
                 const VkBaseOutStructure *current = reinterpret_cast<const VkBaseOutStructure *>(next);
 
+                // This runs for every pNext chain of every call (including per-frame ones like vkQueueSubmit2), so a well-formed
+                // chain must not allocate.  Chains are short, so linear searches of the structures already visited check for
+                // both duplicate sTypes and cycles, and the visited list only spills to the heap for unusually long chains.
+                struct VisitedStruct {
+                    const void *address;
+                    VkStructureType s_type;
+                };
+                small_vector<VisitedStruct, 32, uint32_t> visited;
+
                 while (current != nullptr) {
-                    if (((strncmp(api_name, "vkCreateInstance", strlen(api_name)) != 0) ||
-                         (current->sType != VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO)) &&
-                        ((strncmp(api_name, "vkCreateDevice", strlen(api_name)) != 0) ||
-                         (current->sType != VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO))) {
-                        std::string type_name = string_VkStructureType(current->sType);
-                        if (unique_stype_check.find(current->sType) != unique_stype_check.end() &&
-                            !IsDuplicatePnext(current->sType)) {
+                    bool duplicate = false;
+                    for (const auto &prior : visited) {
+                        if (prior.address == current) {
+                            skip_call |= LogError(device, pnext_vuid,
+                                                  "%s: %s chain contains a cycle, %s at address %p is linked more than once.",
+                                                  api_name, parameter_name.get_name().c_str(),
+                                                  string_VkStructureType(current->sType), static_cast<const void *>(current));
+                            return skip_call;
+                        }
+                        duplicate |= prior.s_type == current->sType;
+                    }
+
+                    // The loader's own structures are only chained into vkCreateInstance and vkCreateDevice, test the sType
+                    // first so the API name is only compared for those
+                    const bool loader_struct = (current->sType == VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO &&
+                                                strcmp(api_name, "vkCreateInstance") == 0) ||
+                                               (current->sType == VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO &&
+                                                strcmp(api_name, "vkCreateDevice") == 0);
+                    if (!loader_struct) {
+                        if (duplicate && !IsDuplicatePnext(current->sType)) {
                             // stype_vuid will only be null if there are no listed pNext and will hit disclaimer check
-                            std::string message = "%s: %s chain contains duplicate structure types: %s appears multiple times.";
-                            skip_call |= LogError(device, stype_vuid, message.c_str(), api_name, parameter_name.get_name().c_str(),
-                                                  type_name.c_str());
-                        } else {
-                            unique_stype_check.insert(current->sType);
+                            skip_call |= LogError(device, stype_vuid,
+                                                  "%s: %s chain contains duplicate structure types: %s appears multiple times.",
+                                                  api_name, parameter_name.get_name().c_str(),
+                                                  string_VkStructureType(current->sType));
                         }
+                        visited.emplace_back(VisitedStruct{current, current->sType});
 
                         // Search custom stype list -- if sType found, skip this entirely
                         bool custom = false;
@@ -555,7 +574,8 @@ class StatelessValidation : public ValidationObject {
                         }
                         if (!custom) {
                             if (std::find(start, end, current->sType) == end) {
-                                if (type_name.compare(UnsupportedStructureTypeString) == 0) {
+                                const char *type_name = string_VkStructureType(current->sType);
+                                if (UnsupportedStructureTypeString == type_name) {
                                     std::string message =
                                         "%s: %s chain includes a structure with unknown VkStructureType (%d); Allowed structures "
                                         "are [%s]. ";
@@ -569,13 +589,16 @@ class StatelessValidation : public ValidationObject {
                                         "are [%s]. ";
                                     message += disclaimer;
                                     skip_call |= LogError(device, pnext_vuid, message.c_str(), api_name,
-                                                          parameter_name.get_name().c_str(), type_name.c_str(),
-                                                          allowed_struct_names, header_version, parameter_name.get_name().c_str());
+                                                          parameter_name.get_name().c_str(), type_name, allowed_struct_names,
+                                                          header_version, parameter_name.get_name().c_str());
                                 }
                             }
                             skip_call |= ValidatePnextStructContents(api_name, parameter_name, current, pnext_vuid, is_physdev_api,
                                                                      is_const_param);
                         }
+                    } else {
+                        // Still tracked for the cycle check, but the loader structures are never reported as duplicates
+                        visited.emplace_back(VisitedStruct{current, VK_STRUCTURE_TYPE_MAX_ENUM});
                     }
                     current = reinterpret_cast<const VkBaseOutStructure *>(current->pNext);
                 }
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2023 Valve Corporation
+ * Copyright (c) 2023 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+// Fixed size 128 bit mask of stage/access combinations.
+//
+// Replaces std::bitset<128>, whose word count and operators are opaque to the optimizer on some standard libraries.  The two
+// 64-bit words are stored as plain members, so the bitwise operators compile to straight-line (and vectorizable) code, any()
+// and none() are a single OR + compare without a loop or branch, and the whole type is usable in constant expressions, which
+// lets the generated per-stage/access masks be constexpr.
+//
+// The interface is the subset of std::bitset used by synchronization validation.
+class SyncStageAccessFlags {
+  public:
+    static constexpr size_t kBitsPerWord = 64;
+    static constexpr size_t kWordCount = 2;
+
+    constexpr SyncStageAccessFlags() : lo_(0), hi_(0) {}
+    // Implicit for parity with std::bitset(unsigned long long), e.g. "flags != 0"
+    constexpr SyncStageAccessFlags(uint64_t lo) : lo_(lo), hi_(0) {}
+    constexpr SyncStageAccessFlags(uint64_t lo, uint64_t hi) : lo_(lo), hi_(hi) {}
+
+    static constexpr SyncStageAccessFlags Bit(size_t index) {
+        return (index < kBitsPerWord) ? SyncStageAccessFlags(uint64_t(1) << index, 0)
+                                      : SyncStageAccessFlags(0, uint64_t(1) << (index - kBitsPerWord));
+    }
+
+    static constexpr size_t size() { return kBitsPerWord * kWordCount; }
+    constexpr uint64_t Word(size_t word) const { return word == 0 ? lo_ : hi_; }
+
+    constexpr bool any() const { return (lo_ | hi_) != 0; }
+    constexpr bool none() const { return (lo_ | hi_) == 0; }
+    constexpr bool test(size_t index) const {
+        return index < kBitsPerWord ? ((lo_ >> index) & 1) != 0 : ((hi_ >> (index - kBitsPerWord)) & 1) != 0;
+    }
+    size_t count() const { return PopCount(lo_) + PopCount(hi_); }
+
+    SyncStageAccessFlags &set(size_t index) { return *this |= Bit(index); }
+    SyncStageAccessFlags &reset(size_t index) { return *this &= ~Bit(index); }
+    SyncStageAccessFlags &reset() {
+        lo_ = 0;
+        hi_ = 0;
+        return *this;
+    }
+
+    constexpr SyncStageAccessFlags operator~() const { return SyncStageAccessFlags(~lo_, ~hi_); }
+    constexpr SyncStageAccessFlags operator<<(size_t shift) const {
+        return (shift == 0)                ? *this
+               : (shift >= size())         ? SyncStageAccessFlags()
+               : (shift >= kBitsPerWord)   ? SyncStageAccessFlags(0, lo_ << (shift - kBitsPerWord))
+                                           : SyncStageAccessFlags(lo_ << shift, (hi_ << shift) | (lo_ >> (kBitsPerWord - shift)));
+    }
+    constexpr SyncStageAccessFlags operator>>(size_t shift) const {
+        return (shift == 0)                ? *this
+               : (shift >= size())         ? SyncStageAccessFlags()
+               : (shift >= kBitsPerWord)   ? SyncStageAccessFlags(hi_ >> (shift - kBitsPerWord), 0)
+                                           : SyncStageAccessFlags((lo_ >> shift) | (hi_ << (kBitsPerWord - shift)), hi_ >> shift);
+    }
+
+    SyncStageAccessFlags &operator&=(const SyncStageAccessFlags &rhs) {
+        lo_ &= rhs.lo_;
+        hi_ &= rhs.hi_;
+        return *this;
+    }
+    SyncStageAccessFlags &operator|=(const SyncStageAccessFlags &rhs) {
+        lo_ |= rhs.lo_;
+        hi_ |= rhs.hi_;
+        return *this;
+    }
+    SyncStageAccessFlags &operator^=(const SyncStageAccessFlags &rhs) {
+        lo_ ^= rhs.lo_;
+        hi_ ^= rhs.hi_;
+        return *this;
+    }
+
+    friend constexpr SyncStageAccessFlags operator&(const SyncStageAccessFlags &lhs, const SyncStageAccessFlags &rhs) {
+        return SyncStageAccessFlags(lhs.lo_ & rhs.lo_, lhs.hi_ & rhs.hi_);
+    }
+    friend constexpr SyncStageAccessFlags operator|(const SyncStageAccessFlags &lhs, const SyncStageAccessFlags &rhs) {
+        return SyncStageAccessFlags(lhs.lo_ | rhs.lo_, lhs.hi_ | rhs.hi_);
+    }
+    friend constexpr SyncStageAccessFlags operator^(const SyncStageAccessFlags &lhs, const SyncStageAccessFlags &rhs) {
+        return SyncStageAccessFlags(lhs.lo_ ^ rhs.lo_, lhs.hi_ ^ rhs.hi_);
+    }
+    friend constexpr bool operator==(const SyncStageAccessFlags &lhs, const SyncStageAccessFlags &rhs) {
+        return ((lhs.lo_ ^ rhs.lo_) | (lhs.hi_ ^ rhs.hi_)) == 0;
+    }
+    friend constexpr bool operator!=(const SyncStageAccessFlags &lhs, const SyncStageAccessFlags &rhs) { return !(lhs == rhs); }
+
+    // Intersection test without materializing the intermediate mask
+    constexpr bool Intersects(const SyncStageAccessFlags &rhs) const { return ((lo_ & rhs.lo_) | (hi_ & rhs.hi_)) != 0; }
+
+  private:
+    static size_t PopCount(uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<size_t>(__builtin_popcountll(value));
+#else
+        size_t result = 0;
+        for (; value; value &= value - 1) ++result;
+        return result;
+#endif
+    }
+
+    uint64_t lo_;
+    uint64_t hi_;
+};
+
+namespace std {
+template <>
+struct hash<SyncStageAccessFlags> {
+    size_t operator()(const SyncStageAccessFlags &flags) const noexcept {
+        const uint64_t lo = flags.Word(0);
+        const uint64_t hi = flags.Word(1);
+        // Stage/access masks used as keys are almost always single bits, so a cheap mix of the two words is sufficient
+        return std::hash<uint64_t>()(lo ^ (hi * 0x9E3779B97F4A7C15ULL) ^ (hi >> 29));
+    }
+};
+}  // namespace std
@@ -18,6 +18,8 @@
 #include "state_tracker/state_tracker.h"
 #include "generated/enum_flag_bits.h"
 
+#include <algorithm>
+
 namespace sync_utils {
 static constexpr uint32_t kNumPipelineStageBits = sizeof(VkPipelineStageFlags2KHR) * 8;
 
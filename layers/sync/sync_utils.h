@@ -18,7 +18,19 @@
 #pragma once
 #include "generated/sync_validation_types.h"
 #include <vulkan/vulkan.h>
+#include <cstddef>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
 #include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 struct DeviceFeatures;
 
@@ -59,4 +71,157 @@ struct ShaderStageAccesses {
 };
 ShaderStageAccesses GetShaderStageAccesses(VkShaderStageFlagBits shader_stage);
 
+// Bump pointer arena for objects that all die together, such as the state recorded into a command buffer.
+//
+// Nothing is freed individually.  Reset() rewinds to the start of the first block in constant time, keeping the storage for
+// the next recording, so once a command buffer has been recorded a few times it no longer hits the heap for arena objects.
+// All objects must be destroyed before Reset() or destruction of the arena.
+class MonotonicArena {
+  public:
+    static constexpr size_t kInitialBlockSize = 4 * 1024;
+    static constexpr size_t kMaxBlockSize = 256 * 1024;
+
+    MonotonicArena() = default;
+    MonotonicArena(const MonotonicArena &) = delete;
+    MonotonicArena &operator=(const MonotonicArena &) = delete;
+
+    void *Allocate(size_t size, size_t alignment);
+    void Reset();
+
+    // Bytes handed out since the last Reset, the most handed out between any two Resets, and the total block storage held
+    size_t BytesUsed() const { return used_; }
+    size_t PeakBytesUsed() const { return used_ > peak_used_ ? used_ : peak_used_; }
+    size_t BytesReserved() const { return reserved_; }
+
+  private:
+    struct Block {
+        std::unique_ptr<uint8_t[]> data;
+        size_t size;
+    };
+    void AddBlock(size_t min_size);
+
+    std::vector<Block> blocks_;
+    size_t current_ = 0;  // index into blocks_ of the block being allocated from
+    size_t offset_ = 0;   // first free byte in the current block
+    size_t used_ = 0;
+    size_t peak_used_ = 0;
+    size_t reserved_ = 0;
+};
+
+// Standard allocator adapter, e.g. for std::allocate_shared.  Deallocation is a no-op, the storage is reclaimed by Reset()
+template <typename T>
+class ArenaAllocator {
+  public:
+    using value_type = T;
+
+    explicit ArenaAllocator(MonotonicArena *arena) noexcept : arena_(arena) {}
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U> &other) noexcept : arena_(other.arena_) {}
+
+    T *allocate(size_t n) { return static_cast<T *>(arena_->Allocate(n * sizeof(T), alignof(T))); }
+    void deallocate(T *, size_t) noexcept {}
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U> &rhs) const noexcept {
+        return arena_ == rhs.arena_;
+    }
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U> &rhs) const noexcept {
+        return arena_ != rhs.arena_;
+    }
+
+  private:
+    template <typename U>
+    friend class ArenaAllocator;
+    MonotonicArena *arena_;
+};
+
+// unique_ptr for arena constructed objects, runs the destructor only
+struct ArenaDelete {
+    template <typename T>
+    void operator()(T *object) const {
+        object->~T();
+    }
+};
+template <typename T>
+using ArenaUniquePtr = std::unique_ptr<T, ArenaDelete>;
+
+template <typename T, typename... Args>
+ArenaUniquePtr<T> MakeArenaUnique(MonotonicArena &arena, Args &&...args) {
+    void *storage = arena.Allocate(sizeof(T), alignof(T));
+    return ArenaUniquePtr<T>(new (storage) T(std::forward<Args>(args)...));
+}
+
+// Small fixed size pool of worker threads for splitting read-mostly validation work into independent partitions.
+//
+// ParallelFor is the only entry point.  The calling thread takes part in the work, and the call returns only once every
+// index has been processed, so the callback may safely reference the caller's stack.  Several threads may call ParallelFor
+// concurrently, their jobs are queued and the workers drain them in order.
+class WorkerPool {
+  public:
+    explicit WorkerPool(uint32_t thread_count);
+    ~WorkerPool();
+    WorkerPool(const WorkerPool &) = delete;
+    WorkerPool &operator=(const WorkerPool &) = delete;
+
+    uint32_t ThreadCount() const { return static_cast<uint32_t>(threads_.size()); }
+
+    // Calls func(i) for every i in [0, count), in no particular order and from any thread of the pool or the caller
+    void ParallelFor(size_t count, const std::function<void(size_t)> &func);
+
+  private:
+    struct Job {
+        Job(size_t count_, const std::function<void(size_t)> *func_) : count(count_), func(func_) {}
+        const size_t count;
+        const std::function<void(size_t)> *func;  // only dereferenced for claimed indices, which the caller waits for
+        std::atomic<size_t> next{0};
+        std::atomic<size_t> done{0};
+    };
+    void WorkerMain();
+    void RunJob(Job &job);
+
+    std::mutex lock_;
+    std::condition_variable wake_;
+    std::condition_variable finished_;
+    std::deque<std::shared_ptr<Job>> jobs_;
+    bool stop_ = false;
+    std::vector<std::thread> threads_;
+};
+
+// Single background thread running jobs in the order they were queued.
+//
+// At most max_backlog jobs may be waiting, Enqueue blocks until the worker catches up when more are queued, which bounds how
+// far the work can lag behind the queueing thread.  Drain blocks until everything queued so far has run.
+class SerialWorker {
+  public:
+    explicit SerialWorker(size_t max_backlog);
+    ~SerialWorker();  // Runs any remaining jobs before returning
+    SerialWorker(const SerialWorker &) = delete;
+    SerialWorker &operator=(const SerialWorker &) = delete;
+
+    void Enqueue(std::function<void()> &&job);
+    // Must not be called from a job, as it would wait for itself (and so is a no-op there)
+    void Drain();
+
+    size_t MaxBacklog() const { return max_backlog_; }
+    // Jobs run, and the number of times Enqueue or Drain had to wait for the worker
+    uint64_t JobCount() const { return job_count_.load(); }
+    uint64_t StallCount() const { return stall_count_.load(); }
+
+  private:
+    void WorkerMain();
+
+    const size_t max_backlog_;
+    std::mutex lock_;
+    std::condition_variable work_;   // jobs_ became non-empty, or stop_
+    std::condition_variable space_;  // a job was taken off jobs_
+    std::condition_variable idle_;   // a job completed
+    std::deque<std::function<void()>> jobs_;
+    bool running_ = false;
+    bool stop_ = false;
+    std::atomic<uint64_t> job_count_{0};
+    std::atomic<uint64_t> stall_count_{0};
+    std::thread thread_;  // last, so everything above is constructed before the worker starts
+};
+
 }  // namespace sync_utils
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2023 Valve Corporation
+ * Copyright (c) 2023 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+// The sync_utils helpers that don't depend on the state tracker. They are built into VkLayer_utils rather than the layer,
+// so the layer utils tests can link them.
+#include "sync/sync_utils.h"
+
+#include <algorithm>
+
+namespace sync_utils {
+
+void MonotonicArena::AddBlock(size_t min_size) {
+    size_t size = blocks_.empty() ? kInitialBlockSize : std::min(blocks_.back().size * 2, kMaxBlockSize);
+    size = std::max(size, min_size);
+    blocks_.emplace_back(Block{std::make_unique<uint8_t[]>(size), size});
+    reserved_ += size;
+}
+
+void *MonotonicArena::Allocate(size_t size, size_t alignment) {
+    // Worst case padding needed to align within a block
+    const size_t worst_case = size + alignment - 1;
+    while (true) {
+        if (current_ < blocks_.size()) {
+            Block &block = blocks_[current_];
+            const auto base = reinterpret_cast<uintptr_t>(block.data.get());
+            const uintptr_t aligned = (base + offset_ + alignment - 1) & ~(uintptr_t(alignment) - 1);
+            const size_t end = static_cast<size_t>(aligned - base) + size;
+            if (end <= block.size) {
+                used_ += end - offset_;
+                offset_ = end;
+                return reinterpret_cast<void *>(aligned);
+            }
+            if (current_ + 1 < blocks_.size()) {
+                // Move on to the next block kept from an earlier recording
+                ++current_;
+                offset_ = 0;
+                continue;
+            }
+        }
+        AddBlock(worst_case);
+        current_ = blocks_.size() - 1;
+        offset_ = 0;
+    }
+}
+
+void MonotonicArena::Reset() {
+    peak_used_ = PeakBytesUsed();
+    if (blocks_.size() > 1) {
+        // Still warming up, replace the chain with a single block big enough for everything seen so far
+        const size_t size = reserved_;
+        blocks_.clear();
+        reserved_ = 0;
+        AddBlock(size);
+    }
+    current_ = 0;
+    offset_ = 0;
+    used_ = 0;
+}
+
+WorkerPool::WorkerPool(uint32_t thread_count) {
+    threads_.reserve(thread_count);
+    for (uint32_t i = 0; i < thread_count; ++i) {
+        threads_.emplace_back(&WorkerPool::WorkerMain, this);
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto &thread : threads_) {
+        thread.join();
+    }
+}
+
+void WorkerPool::ParallelFor(size_t count, const std::function<void(size_t)> &func) {
+    if (count == 0) return;
+    if (count == 1 || threads_.empty()) {
+        for (size_t i = 0; i < count; ++i) func(i);
+        return;
+    }
+
+    auto job = std::make_shared<Job>(count, &func);
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        jobs_.push_back(job);
+    }
+    wake_.notify_all();
+
+    RunJob(*job);
+
+    std::unique_lock<std::mutex> guard(lock_);
+    finished_.wait(guard, [&job]() { return job->done.load() == job->count; });
+    // A worker may already have retired the job from the queue
+    auto it = std::find(jobs_.begin(), jobs_.end(), job);
+    if (it != jobs_.end()) jobs_.erase(it);
+}
+
+void WorkerPool::RunJob(Job &job) {
+    for (size_t index = job.next.fetch_add(1); index < job.count; index = job.next.fetch_add(1)) {
+        (*job.func)(index);
+        if (job.done.fetch_add(1) + 1 == job.count) {
+            // Take the lock so the notify can't slip in between the caller's predicate check and its wait
+            std::lock_guard<std::mutex> guard(lock_);
+            finished_.notify_all();
+        }
+    }
+}
+
+void WorkerPool::WorkerMain() {
+    std::unique_lock<std::mutex> guard(lock_);
+    while (true) {
+        wake_.wait(guard, [this]() { return stop_ || !jobs_.empty(); });
+        if (stop_) return;
+        std::shared_ptr<Job> job = jobs_.front();
+        if (job->next.load() >= job->count) {
+            // Every index is claimed, the remaining work is in flight on other threads
+            jobs_.pop_front();
+            continue;
+        }
+        guard.unlock();
+        RunJob(*job);
+        guard.lock();
+    }
+}
+
+SerialWorker::SerialWorker(size_t max_backlog)
+    : max_backlog_(std::max<size_t>(max_backlog, 1)), thread_(&SerialWorker::WorkerMain, this) {}
+
+SerialWorker::~SerialWorker() {
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        stop_ = true;
+    }
+    work_.notify_all();
+    thread_.join();
+}
+
+void SerialWorker::Enqueue(std::function<void()> &&job) {
+    {
+        std::unique_lock<std::mutex> guard(lock_);
+        if (jobs_.size() >= max_backlog_) {
+            stall_count_++;
+            space_.wait(guard, [this]() { return jobs_.size() < max_backlog_; });
+        }
+        jobs_.emplace_back(std::move(job));
+    }
+    work_.notify_one();
+}
+
+void SerialWorker::Drain() {
+    if (std::this_thread::get_id() == thread_.get_id()) return;
+    std::unique_lock<std::mutex> guard(lock_);
+    if (jobs_.empty() && !running_) return;
+    stall_count_++;
+    idle_.wait(guard, [this]() { return jobs_.empty() && !running_; });
+}
+
+void SerialWorker::WorkerMain() {
+    std::unique_lock<std::mutex> guard(lock_);
+    while (true) {
+        work_.wait(guard, [this]() { return stop_ || !jobs_.empty(); });
+        // Finish the queued work even when stopping, the jobs may carry state updates
+        if (jobs_.empty()) return;
+        std::function<void()> job = std::move(jobs_.front());
+        jobs_.pop_front();
+        running_ = true;
+        guard.unlock();
+        space_.notify_one();
+
+        job();
+        job = nullptr;  // anything the job holds is released before it counts as complete
+        job_count_++;
+
+        guard.lock();
+        running_ = false;
+        idle_.notify_all();
+    }
+}
+
+}  // namespace sync_utils
@@ -16,6 +16,7 @@
  */
 
 #include <algorithm>
+#include <cinttypes>
 #include <limits>
 #include <memory>
 #include <vector>
@@ -186,7 +187,7 @@ static std::string string_SyncStageAccessFlags(const SyncStageAccessFlags &flags
     } else {
         for (size_t i = 0; i < syncStageAccessInfoByStageAccessIndex().size(); i++) {
             const auto &info = syncStageAccessInfoByStageAccessIndex()[i];
-            if ((flags & info.stage_access_bit).any()) {
+            if (flags.Intersects(info.stage_access_bit)) {
                 if (!out_str.empty()) {
                     out_str.append(sep);
                 }
@@ -1180,6 +1181,14 @@ void AccessContext::ResolveFromContext(ResolveOp &&resolve_op, const AccessConte
     }
 }
 
+template <typename ResolveOp>
+void AccessContext::ResolveFromContext(ResolveOp &&resolve_op, const AccessContext &from_context, sync_utils::WorkerPool &workers) {
+    workers.ParallelFor(kAddressTypes.size(), [&](size_t index) {
+        const AccessAddressType address_type = kAddressTypes[index];
+        from_context.ResolveAccessRange(address_type, kFullRange, resolve_op, &GetAccessStateMap(address_type), nullptr, false);
+    });
+}
+
 template <typename ResolveOp, typename RangeGenerator>
 void AccessContext::ResolveFromContext(ResolveOp &&resolve_op, const AccessContext &from_context, AccessAddressType address_type,
                                        RangeGenerator range_gen, const ResourceAccessState *infill_state, bool recur_to_infill) {
@@ -2090,17 +2099,19 @@ bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBin
                         }
 
                         if (hazard.hazard && !sync_state_->SupressedBoundDescriptorWAW(hazard)) {
-                            skip |= sync_state_->LogError(
-                                img_view_state->image_view(), string_SyncHazardVUID(hazard.hazard),
-                                "%s: Hazard %s for %s, in %s, and %s, %s, type: %s, imageLayout: %s, binding #%" PRIu32
-                                ", index %" PRIu32 ". Access info %s.",
-                                caller_name, string_SyncHazard(hazard.hazard),
-                                sync_state_->report_data->FormatHandle(img_view_state->image_view()).c_str(),
-                                sync_state_->report_data->FormatHandle(cb_state_->commandBuffer()).c_str(),
-                                sync_state_->report_data->FormatHandle(pipe->pipeline()).c_str(),
-                                sync_state_->report_data->FormatHandle(descriptor_set->GetSet()).c_str(),
-                                string_VkDescriptorType(descriptor_type), string_VkImageLayout(image_layout),
-                                variable.decorations.binding, index, FormatHazard(hazard).c_str());
+                            skip |= sync_state_->LogErrorDeferred(
+                                img_view_state->image_view(), string_SyncHazardVUID(hazard.hazard), [&]() {
+                                    return sync_state_->FormatString(
+                                        "%s: Hazard %s for %s, in %s, and %s, %s, type: %s, imageLayout: %s, binding #%" PRIu32
+                                        ", index %" PRIu32 ". Access info %s.",
+                                        caller_name, string_SyncHazard(hazard.hazard),
+                                        sync_state_->report_data->FormatHandle(img_view_state->image_view()).c_str(),
+                                        sync_state_->report_data->FormatHandle(cb_state_->commandBuffer()).c_str(),
+                                        sync_state_->report_data->FormatHandle(pipe->pipeline()).c_str(),
+                                        sync_state_->report_data->FormatHandle(descriptor_set->GetSet()).c_str(),
+                                        string_VkDescriptorType(descriptor_type), string_VkImageLayout(image_layout),
+                                        variable.decorations.binding, index, FormatHazard(hazard).c_str());
+                                });
                         }
                         break;
                     }
@@ -2114,16 +2125,18 @@ bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBin
                         const ResourceAccessRange range = MakeRange(*buf_view_state);
                         auto hazard = current_context_->DetectHazard(*buf_state, sync_index, range);
                         if (hazard.hazard && !sync_state_->SupressedBoundDescriptorWAW(hazard)) {
-                            skip |= sync_state_->LogError(
-                                buf_view_state->buffer_view(), string_SyncHazardVUID(hazard.hazard),
-                                "%s: Hazard %s for %s in %s, %s, and %s, type: %s, binding #%d index %d. Access info %s.",
-                                caller_name, string_SyncHazard(hazard.hazard),
-                                sync_state_->report_data->FormatHandle(buf_view_state->buffer_view()).c_str(),
-                                sync_state_->report_data->FormatHandle(cb_state_->commandBuffer()).c_str(),
-                                sync_state_->report_data->FormatHandle(pipe->pipeline()).c_str(),
-                                sync_state_->report_data->FormatHandle(descriptor_set->GetSet()).c_str(),
-                                string_VkDescriptorType(descriptor_type), variable.decorations.binding, index,
-                                FormatHazard(hazard).c_str());
+                            skip |= sync_state_->LogErrorDeferred(
+                                buf_view_state->buffer_view(), string_SyncHazardVUID(hazard.hazard), [&]() {
+                                    return sync_state_->FormatString(
+                                        "%s: Hazard %s for %s in %s, %s, and %s, type: %s, binding #%d index %d. Access info %s.",
+                                        caller_name, string_SyncHazard(hazard.hazard),
+                                        sync_state_->report_data->FormatHandle(buf_view_state->buffer_view()).c_str(),
+                                        sync_state_->report_data->FormatHandle(cb_state_->commandBuffer()).c_str(),
+                                        sync_state_->report_data->FormatHandle(pipe->pipeline()).c_str(),
+                                        sync_state_->report_data->FormatHandle(descriptor_set->GetSet()).c_str(),
+                                        string_VkDescriptorType(descriptor_type), variable.decorations.binding, index,
+                                        FormatHazard(hazard).c_str());
+                                });
                         }
                         break;
                     }
@@ -2137,16 +2150,18 @@ bool CommandBufferAccessContext::ValidateDispatchDrawDescriptorSet(VkPipelineBin
                             MakeRange(*buf_state, buffer_descriptor->GetOffset(), buffer_descriptor->GetRange());
                         auto hazard = current_context_->DetectHazard(*buf_state, sync_index, range);
                         if (hazard.hazard && !sync_state_->SupressedBoundDescriptorWAW(hazard)) {
-                            skip |= sync_state_->LogError(
-                                buf_state->buffer(), string_SyncHazardVUID(hazard.hazard),
-                                "%s: Hazard %s for %s in %s, %s, and %s, type: %s, binding #%d index %d. Access info %s.",
-                                caller_name, string_SyncHazard(hazard.hazard),
-                                sync_state_->report_data->FormatHandle(buf_state->buffer()).c_str(),
-                                sync_state_->report_data->FormatHandle(cb_state_->commandBuffer()).c_str(),
-                                sync_state_->report_data->FormatHandle(pipe->pipeline()).c_str(),
-                                sync_state_->report_data->FormatHandle(descriptor_set->GetSet()).c_str(),
-                                string_VkDescriptorType(descriptor_type), variable.decorations.binding, index,
-                                FormatHazard(hazard).c_str());
+                            skip |= sync_state_->LogErrorDeferred(
+                                buf_state->buffer(), string_SyncHazardVUID(hazard.hazard), [&]() {
+                                    return sync_state_->FormatString(
+                                        "%s: Hazard %s for %s in %s, %s, and %s, type: %s, binding #%d index %d. Access info %s.",
+                                        caller_name, string_SyncHazard(hazard.hazard),
+                                        sync_state_->report_data->FormatHandle(buf_state->buffer()).c_str(),
+                                        sync_state_->report_data->FormatHandle(cb_state_->commandBuffer()).c_str(),
+                                        sync_state_->report_data->FormatHandle(pipe->pipeline()).c_str(),
+                                        sync_state_->report_data->FormatHandle(descriptor_set->GetSet()).c_str(),
+                                        string_VkDescriptorType(descriptor_type), variable.decorations.binding, index,
+                                        FormatHazard(hazard).c_str());
+                                });
                         }
                         break;
                     }
@@ -2272,11 +2287,13 @@ bool CommandBufferAccessContext::ValidateDrawVertex(const std::optional<uint32_t
             const ResourceAccessRange range = MakeRange(binding_buffer, firstVertex, vertexCount, binding_description.stride);
             auto hazard = current_context_->DetectHazard(*buf_state, SYNC_VERTEX_ATTRIBUTE_INPUT_VERTEX_ATTRIBUTE_READ, range);
             if (hazard.hazard) {
-                skip |= sync_state_->LogError(
-                    buf_state->buffer(), string_SyncHazardVUID(hazard.hazard), "%s: Hazard %s for vertex %s in %s. Access info %s.",
-                    CommandTypeString(cmd_type), string_SyncHazard(hazard.hazard),
-                    sync_state_->report_data->FormatHandle(buf_state->buffer()).c_str(),
-                    sync_state_->report_data->FormatHandle(cb_state_->commandBuffer()).c_str(), FormatHazard(hazard).c_str());
+                skip |= sync_state_->LogErrorDeferred(buf_state->buffer(), string_SyncHazardVUID(hazard.hazard), [&]() {
+                    return sync_state_->FormatString("%s: Hazard %s for vertex %s in %s. Access info %s.",
+                                                     CommandTypeString(cmd_type), string_SyncHazard(hazard.hazard),
+                                                     sync_state_->report_data->FormatHandle(buf_state->buffer()).c_str(),
+                                                     sync_state_->report_data->FormatHandle(cb_state_->commandBuffer()).c_str(),
+                                                     FormatHazard(hazard).c_str());
+                });
             }
         }
     }
@@ -2321,11 +2338,13 @@ bool CommandBufferAccessContext::ValidateDrawVertexIndex(const std::optional<uin
 
     auto hazard = current_context_->DetectHazard(*index_buf_state, SYNC_INDEX_INPUT_INDEX_READ, range);
     if (hazard.hazard) {
-        skip |= sync_state_->LogError(
-            index_buf_state->buffer(), string_SyncHazardVUID(hazard.hazard), "%s: Hazard %s for index %s in %s. Access info %s.",
-            CommandTypeString(cmd_type), string_SyncHazard(hazard.hazard),
-            sync_state_->report_data->FormatHandle(index_buf_state->buffer()).c_str(),
-            sync_state_->report_data->FormatHandle(cb_state_->commandBuffer()).c_str(), FormatHazard(hazard).c_str());
+        skip |= sync_state_->LogErrorDeferred(index_buf_state->buffer(), string_SyncHazardVUID(hazard.hazard), [&]() {
+            return sync_state_->FormatString("%s: Hazard %s for index %s in %s. Access info %s.", CommandTypeString(cmd_type),
+                                             string_SyncHazard(hazard.hazard),
+                                             sync_state_->report_data->FormatHandle(index_buf_state->buffer()).c_str(),
+                                             sync_state_->report_data->FormatHandle(cb_state_->commandBuffer()).c_str(),
+                                             FormatHazard(hazard).c_str());
+        });
     }
 
     // TODO: For now, we detect the whole vertex buffer. Index buffer could be changed until SubmitQueue.
@@ -2364,6 +2383,45 @@ void CommandBufferAccessContext::RecordDrawSubpassAttachment(const ResourceUsage
 
 QueueId CommandBufferAccessContext::GetQueueId() const { return QueueSyncState::kQueueIdInvalid; }
 
+void CommandBufferAccessContext::Destroy() {
+    if (cb_state_ && sync_state_) {
+        sync_state_->RecordCommandBufferArenaStats(arena_);
+    }
+    // the cb self reference must be cleared or the command buffer reference count will never go to 0
+    cbs_referenced_.reset();
+    cb_state_ = nullptr;
+}
+
+void CommandBufferAccessContext::Reset() {
+    // Reuse the log storage unless a submitted batch still holds a reference to it
+    if (access_log_.use_count() == 1) {
+        access_log_->clear();
+    } else {
+        access_log_ = std::make_shared<AccessLog>();
+    }
+    if (cbs_referenced_ && cbs_referenced_.use_count() == 1) {
+        cbs_referenced_->clear();
+    } else {
+        cbs_referenced_ = std::make_shared<CommandBufferSet>();
+    }
+    if (cb_state_) {
+        cbs_referenced_->insert(cb_state_->shared_from_this());
+    }
+    command_number_ = 0;
+    subcommand_number_ = 0;
+    reset_count_++;
+    command_handles_.clear();
+    cb_access_context_.Reset();
+    current_context_ = &cb_access_context_;
+    current_renderpass_context_ = nullptr;
+    events_context_.Clear();
+
+    // The arena objects must be gone before the arena is rewound
+    sync_ops_.clear();
+    render_pass_contexts_.clear();
+    arena_.Reset();
+}
+
 ResourceUsageTag CommandBufferAccessContext::RecordBeginRenderPass(CMD_TYPE cmd_type, const RENDER_PASS_STATE &rp_state,
                                                                    const VkRect2D &render_area,
                                                                    const std::vector<const IMAGE_VIEW_STATE *> &attachment_views) {
@@ -2371,8 +2429,8 @@ ResourceUsageTag CommandBufferAccessContext::RecordBeginRenderPass(CMD_TYPE cmd_
     const auto barrier_tag = NextCommandTag(cmd_type, NamedHandle("renderpass", rp_state.Handle()),
                                             ResourceUsageRecord::SubcommandType::kSubpassTransition);
     const auto load_tag = NextSubcommandTag(cmd_type, ResourceUsageRecord::SubcommandType::kLoadOp);
-    render_pass_contexts_.emplace_back(
-        std::make_unique<RenderPassAccessContext>(rp_state, render_area, GetQueueFlags(), attachment_views, &cb_access_context_));
+    render_pass_contexts_.emplace_back(sync_utils::MakeArenaUnique<RenderPassAccessContext>(
+        arena_, rp_state, render_area, GetQueueFlags(), attachment_views, &cb_access_context_));
     current_renderpass_context_ = render_pass_contexts_.back().get();
     current_renderpass_context_->RecordBeginRenderPass(barrier_tag, load_tag);
     current_context_ = &current_renderpass_context_->CurrentContext();
@@ -2455,7 +2513,8 @@ bool CommandBufferAccessContext::ValidateFirstUse(CommandExecutionContext &exec_
 
     // and anything after the last syncop
     tag_range.end = ResourceUsageRecord::kMaxIndex;
-    hazard = recorded_context->DetectFirstUseHazard(queue_id, tag_range, *exec_context.GetCurrentAccessContext());
+    hazard = recorded_context->DetectFirstUseHazard(queue_id, tag_range, *exec_context.GetCurrentAccessContext(),
+                                                    sync_state_->GetSubmitWorkers());
     if (hazard.hazard) {
         skip |= log_msg(hazard, exec_context, func_name, index);
     }
@@ -2570,21 +2629,78 @@ class HazardDetectFirstUse {
 
 // This is called with the *recorded* command buffers access context, with the *active* access context pass in, againsts which
 // hazards will be detected
+//
+// With a worker pool the recorded accesses are split into partitions of consecutive address ranges (in address type, then
+// address order), which are checked concurrently.  Checking is read only for both contexts.  The hazard reported is the one
+// from the lowest partition, i.e. the same one the serial walk finds first, so the output doesn't depend on thread timing.
 HazardResult AccessContext::DetectFirstUseHazard(QueueId queue_id, const ResourceUsageRange &tag_range,
-                                                 const AccessContext &access_context) const {
-    HazardResult hazard;
-    for (const auto address_type : kAddressTypes) {
-        const auto &recorded_access_map = GetAccessStateMap(address_type);
-        for (const auto &recorded_access : recorded_access_map) {
+                                                 const AccessContext &access_context, sync_utils::WorkerPool *workers) const {
+    using ConstIterator = ResourceAccessRangeMap::const_iterator;
+    auto detect = [queue_id, &tag_range, &access_context](AccessAddressType address_type, ConstIterator pos,
+                                                          const ConstIterator &end, const auto &stop) {
+        HazardResult hazard;
+        for (; pos != end && !stop(); ++pos) {
             // Cull any entries not in the current tag range
-            if (!recorded_access.second.FirstAccessInTagRange(tag_range)) continue;
-            HazardDetectFirstUse detector(recorded_access.second, queue_id, tag_range);
-            hazard = access_context.DetectHazard(address_type, detector, recorded_access.first, DetectOptions::kDetectAll);
+            if (!pos->second.FirstAccessInTagRange(tag_range)) continue;
+            HazardDetectFirstUse detector(pos->second, queue_id, tag_range);
+            hazard = access_context.DetectHazard(address_type, detector, pos->first, DetectOptions::kDetectAll);
             if (hazard.hazard) break;
         }
+        return hazard;
+    };
+
+    size_t entry_count = 0;
+    for (const auto address_type : kAddressTypes) {
+        entry_count += GetAccessStateMap(address_type).size();
+    }
+
+    if (!workers || workers->ThreadCount() == 0 || entry_count < 2 * kFirstUsePartitionSize) {
+        auto never = []() { return false; };
+        for (const auto address_type : kAddressTypes) {
+            const auto &recorded_access_map = GetAccessStateMap(address_type);
+            HazardResult hazard = detect(address_type, recorded_access_map.cbegin(), recorded_access_map.cend(), never);
+            if (hazard.hazard) return hazard;
+        }
+        return HazardResult();
     }
 
-    return hazard;
+    struct Partition {
+        AccessAddressType address_type;
+        ConstIterator begin;
+        ConstIterator end;
+    };
+    std::vector<Partition> partitions;
+    partitions.reserve(entry_count / kFirstUsePartitionSize + kAddressTypes.size());
+    for (const auto address_type : kAddressTypes) {
+        const auto &recorded_access_map = GetAccessStateMap(address_type);
+        auto pos = recorded_access_map.cbegin();
+        const auto end = recorded_access_map.cend();
+        while (pos != end) {
+            Partition partition{address_type, pos, end};
+            for (size_t count = 0; pos != end && count < kFirstUsePartitionSize; ++count) ++pos;
+            partition.end = pos;
+            partitions.emplace_back(partition);
+        }
+    }
+
+    std::vector<HazardResult> results(partitions.size());
+    std::atomic<size_t> first_hazard{partitions.size()};
+    workers->ParallelFor(partitions.size(), [&](size_t index) {
+        // Once a lower partition has a hazard, nothing found here could be reported
+        auto superseded = [&first_hazard, index]() { return first_hazard.load(std::memory_order_relaxed) < index; };
+        const Partition &partition = partitions[index];
+        results[index] = detect(partition.address_type, partition.begin, partition.end, superseded);
+        if (results[index].hazard) {
+            size_t current = first_hazard.load();
+            while (index < current && !first_hazard.compare_exchange_weak(current, index)) {
+            }
+        }
+    });
+
+    for (auto &result : results) {
+        if (result.hazard) return std::move(result);
+    }
+    return HazardResult();
 }
 
 bool RenderPassAccessContext::ValidateDrawSubpassAttachment(const CommandExecutionContext &exec_context,
@@ -2621,12 +2737,13 @@ bool RenderPassAccessContext::ValidateDrawSubpassAttachment(const CommandExecuti
                                              SYNC_COLOR_ATTACHMENT_OUTPUT_COLOR_ATTACHMENT_WRITE, SyncOrdering::kColorAttachment);
             if (hazard.hazard) {
                 const VkImageView view_handle = view_gen.GetViewState()->image_view();
-                skip |= sync_state.LogError(view_handle, string_SyncHazardVUID(hazard.hazard),
-                                            "%s: Hazard %s for %s in %s, Subpass #%d, and pColorAttachments #%d. Access info %s.",
-                                            caller_name, string_SyncHazard(hazard.hazard),
-                                            sync_state.report_data->FormatHandle(view_handle).c_str(),
-                                            sync_state.report_data->FormatHandle(cmd_buffer.commandBuffer()).c_str(),
-                                            cmd_buffer.GetActiveSubpass(), location, exec_context.FormatHazard(hazard).c_str());
+                skip |= sync_state.LogErrorDeferred(view_handle, string_SyncHazardVUID(hazard.hazard), [&]() {
+                    return sync_state.FormatString(
+                        "%s: Hazard %s for %s in %s, Subpass #%d, and pColorAttachments #%d. Access info %s.", caller_name,
+                        string_SyncHazard(hazard.hazard), sync_state.report_data->FormatHandle(view_handle).c_str(),
+                        sync_state.report_data->FormatHandle(cmd_buffer.commandBuffer()).c_str(), cmd_buffer.GetActiveSubpass(),
+                        location, exec_context.FormatHazard(hazard).c_str());
+                });
             }
         }
     }
@@ -2664,13 +2781,14 @@ bool RenderPassAccessContext::ValidateDrawSubpassAttachment(const CommandExecuti
                                                                SYNC_LATE_FRAGMENT_TESTS_DEPTH_STENCIL_ATTACHMENT_WRITE,
                                                                SyncOrdering::kDepthStencilAttachment);
             if (hazard.hazard) {
-                skip |= sync_state.LogError(
-                    view_state.image_view(), string_SyncHazardVUID(hazard.hazard),
-                    "%s: Hazard %s for %s in %s, Subpass #%d, and depth part of pDepthStencilAttachment. Access info %s.",
-                    caller_name, string_SyncHazard(hazard.hazard),
-                    sync_state.report_data->FormatHandle(view_state.image_view()).c_str(),
-                    sync_state.report_data->FormatHandle(cmd_buffer.commandBuffer()).c_str(), cmd_buffer.GetActiveSubpass(),
-                    exec_context.FormatHazard(hazard).c_str());
+                skip |= sync_state.LogErrorDeferred(view_state.image_view(), string_SyncHazardVUID(hazard.hazard), [&]() {
+                    return sync_state.FormatString(
+                        "%s: Hazard %s for %s in %s, Subpass #%d, and depth part of pDepthStencilAttachment. Access info %s.",
+                        caller_name, string_SyncHazard(hazard.hazard),
+                        sync_state.report_data->FormatHandle(view_state.image_view()).c_str(),
+                        sync_state.report_data->FormatHandle(cmd_buffer.commandBuffer()).c_str(), cmd_buffer.GetActiveSubpass(),
+                        exec_context.FormatHazard(hazard).c_str());
+                });
             }
         }
         if (stencil_write) {
@@ -2678,13 +2796,14 @@ bool RenderPassAccessContext::ValidateDrawSubpassAttachment(const CommandExecuti
                                                                SYNC_LATE_FRAGMENT_TESTS_DEPTH_STENCIL_ATTACHMENT_WRITE,
                                                                SyncOrdering::kDepthStencilAttachment);
             if (hazard.hazard) {
-                skip |= sync_state.LogError(
-                    view_state.image_view(), string_SyncHazardVUID(hazard.hazard),
-                    "%s: Hazard %s for %s in %s, Subpass #%d, and stencil part of pDepthStencilAttachment. Access info %s.",
-                    caller_name, string_SyncHazard(hazard.hazard),
-                    sync_state.report_data->FormatHandle(view_state.image_view()).c_str(),
-                    sync_state.report_data->FormatHandle(cmd_buffer.commandBuffer()).c_str(), cmd_buffer.GetActiveSubpass(),
-                    exec_context.FormatHazard(hazard).c_str());
+                skip |= sync_state.LogErrorDeferred(view_state.image_view(), string_SyncHazardVUID(hazard.hazard), [&]() {
+                    return sync_state.FormatString(
+                        "%s: Hazard %s for %s in %s, Subpass #%d, and stencil part of pDepthStencilAttachment. Access info %s.",
+                        caller_name, string_SyncHazard(hazard.hazard),
+                        sync_state.report_data->FormatHandle(view_state.image_view()).c_str(),
+                        sync_state.report_data->FormatHandle(cmd_buffer.commandBuffer()).c_str(), cmd_buffer.GetActiveSubpass(),
+                        exec_context.FormatHazard(hazard).c_str());
+                });
             }
         }
     }
@@ -3247,7 +3366,7 @@ HazardResult ResourceAccessState::DetectHazard(SyncStageAccessIndex usage_index)
         if (last_reads.size()) {
             for (const auto &read_access : last_reads) {
                 if (IsReadHazard(usage_stage, read_access)) {
-                    hazard.Set(this, usage_index, WRITE_AFTER_READ, read_access.access, read_access.tag);
+                    hazard.Set(this, usage_index, WRITE_AFTER_READ, read_access.AccessBit(), read_access.tag);
                     break;
                 }
             }
@@ -3271,8 +3390,8 @@ HazardResult ResourceAccessState::DetectHazard(SyncStageAccessIndex usage_index,
     HazardResult hazard;
     const auto usage_bit = FlagBit(usage_index);
     const auto usage_stage = PipelineStageBit(usage_index);
-    const bool input_attachment_ordering = (ordering.access_scope & SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ_BIT).any();
-    const bool last_write_is_ordered = (last_write & ordering.access_scope).any() && (write_queue == queue_id);
+    const bool input_attachment_ordering = ordering.access_scope.Intersects(SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ_BIT);
+    const bool last_write_is_ordered = last_write.Intersects(ordering.access_scope) && (write_queue == queue_id);
     if (IsRead(usage_bit)) {
         // Exclude RAW if no write, or write not most "most recent" operation w.r.t. usage;
         bool is_raw_hazard = IsRAWHazard(usage_stage, usage_bit);
@@ -3297,7 +3416,7 @@ HazardResult ResourceAccessState::DetectHazard(SyncStageAccessIndex usage_index,
         return DetectBarrierHazard(usage_index, queue_id, ordering.exec_scope, ordering.access_scope);
     } else {
         // Only check for WAW if there are no reads since last_write
-        const bool usage_write_is_ordered = (usage_bit & ordering.access_scope).any();
+        const bool usage_write_is_ordered = usage_bit.Intersects(ordering.access_scope);
         if (last_reads.size()) {
             // Look for any WAR hazards outside the ordered set of stages
             VkPipelineStageFlags2KHR ordered_stages = 0;
@@ -3310,7 +3429,7 @@ HazardResult ResourceAccessState::DetectHazard(SyncStageAccessIndex usage_index,
                 for (const auto &read_access : last_reads) {
                     if (read_access.stage & ordered_stages) continue;  // but we can skip the ordered ones
                     if (IsReadHazard(usage_stage, read_access)) {
-                        hazard.Set(this, usage_index, WRITE_AFTER_READ, read_access.access, read_access.tag);
+                        hazard.Set(this, usage_index, WRITE_AFTER_READ, read_access.AccessBit(), read_access.tag);
                         break;
                     }
                 }
@@ -3320,7 +3439,7 @@ HazardResult ResourceAccessState::DetectHazard(SyncStageAccessIndex usage_index,
             if ((usage_index == SYNC_IMAGE_LAYOUT_TRANSITION) && (usage_bit == last_write)) {
                 // ILT after ILT is a special case where we check the 2nd access scope of the first ILT against the first access
                 // scope of the second ILT, which has been passed (smuggled?) in the ordering barrier
-                ilt_ilt_hazard = !(write_barriers & ordering.access_scope).any();
+                ilt_ilt_hazard = !write_barriers.Intersects(ordering.access_scope);
             }
             if (ilt_ilt_hazard || IsWriteHazard(usage_bit)) {
                 hazard.Set(this, usage_index, WRITE_AFTER_WRITE, last_write, write_tag);
@@ -3404,7 +3523,7 @@ HazardResult ResourceAccessState::DetectAsyncHazard(SyncStageAccessIndex usage_i
             // Any reads during the other subpass will conflict with this write, so we need to check them all.
             for (const auto &read_access : last_reads) {
                 if (read_access.tag >= start_tag) {
-                    hazard.Set(this, usage_index, WRITE_RACING_READ, read_access.access, read_access.tag);
+                    hazard.Set(this, usage_index, WRITE_RACING_READ, read_access.AccessBit(), read_access.tag);
                     break;
                 }
             }
@@ -3442,7 +3561,7 @@ HazardResult ResourceAccessState::DetectBarrierHazard(SyncStageAccessIndex usage
         // Look at the reads if any
         for (const auto &read_access : last_reads) {
             if (read_access.IsReadBarrierHazard(queue_id, src_exec_scope)) {
-                hazard.Set(this, usage_index, WRITE_AFTER_READ, read_access.access, read_access.tag);
+                hazard.Set(this, usage_index, WRITE_AFTER_READ, read_access.AccessBit(), read_access.tag);
                 break;
             }
         }
@@ -3482,21 +3601,21 @@ HazardResult ResourceAccessState::DetectBarrierHazard(SyncStageAccessIndex usage
                 assert(scope_read.stage == current_read.stage);
                 if (current_read.tag > event_tag) {
                     // The read is more recent than the set event scope, thus no barrier from the wait/ILT.
-                    hazard.Set(this, usage_index, WRITE_AFTER_READ, current_read.access, current_read.tag);
+                    hazard.Set(this, usage_index, WRITE_AFTER_READ, current_read.AccessBit(), current_read.tag);
                 } else {
                     // The read is in the events first synchronization scope, so we use a barrier hazard check
                     // If the read stage is not in the src sync scope
                     // *AND* not execution chained with an existing sync barrier (that's the or)
                     // then the barrier access is unsafe (R/W after R)
                     if (scope_read.IsReadBarrierHazard(event_queue, src_exec_scope)) {
-                        hazard.Set(this, usage_index, WRITE_AFTER_READ, scope_read.access, scope_read.tag);
+                        hazard.Set(this, usage_index, WRITE_AFTER_READ, scope_read.AccessBit(), scope_read.tag);
                         break;
                     }
                 }
             }
             if (!hazard.IsHazard() && (last_reads.size() > scope_read_count)) {
                 const ReadState &current_read = last_reads[scope_read_count];
-                hazard.Set(this, usage_index, WRITE_AFTER_READ, current_read.access, current_read.tag);
+                hazard.Set(this, usage_index, WRITE_AFTER_READ, current_read.AccessBit(), current_read.tag);
             }
         } else if (last_write.any()) {
             // if there are no reads, the write is either the reason the access is in the event scope... they are a hazard
@@ -3613,7 +3732,7 @@ void ResourceAccessState::Update(SyncStageAccessIndex usage_index, SyncOrdering
             const auto not_usage_stage = ~usage_stage;
             for (auto &read_access : last_reads) {
                 if (read_access.stage == usage_stage) {
-                    read_access.Set(usage_stage, usage_bit, 0, tag);
+                    read_access.Set(usage_stage, usage_index, 0, tag);
                 } else if (read_access.barriers & usage_stage) {
                     // If the current access is barriered to this stage, mark it as "known to happen after"
                     read_access.sync_stages |= usage_stage;
@@ -3630,7 +3749,7 @@ void ResourceAccessState::Update(SyncStageAccessIndex usage_index, SyncOrdering
                     read_access.sync_stages |= usage_stage;
                 }
             }
-            last_reads.emplace_back(usage_stage, usage_bit, 0, tag);
+            last_reads.emplace_back(usage_stage, usage_index, 0, tag);
             last_read_stages |= usage_stage;
         }
 
@@ -3886,29 +4005,32 @@ void ResourceAccessState::OffsetTag(ResourceUsageTag offset) {
     }
 }
 
+// Every access map entry holds up to three of these inline, keep them from growing back
+static_assert(sizeof(ResourceAccessState::ReadState) <= 6 * sizeof(uint64_t), "ReadState size regression");
+
 ResourceAccessState::ResourceAccessState()
     : write_barriers(~SyncStageAccessFlags(0)),
       write_dependency_chain(0),
       write_tag(),
-      write_queue(QueueSyncState::kQueueIdInvalid),
       last_write(0),
-      input_attachment_read(false),
       last_read_stages(0),
       read_execution_barriers(0),
       pending_write_dep_chain(0),
-      pending_layout_transition(false),
       pending_write_barriers(0),
       pending_layout_ordering_(),
       first_accesses_(),
       first_read_stages_(0U),
-      first_write_layout_ordering_() {}
+      first_write_layout_ordering_(),
+      write_queue(QueueSyncState::kQueueIdInvalid),
+      input_attachment_read(false),
+      pending_layout_transition(false) {}
 
 // This should be just Bits or Index, but we don't have an invalid state for Index
 VkPipelineStageFlags2KHR ResourceAccessState::GetReadBarriers(const SyncStageAccessFlags &usage_bit) const {
     VkPipelineStageFlags2KHR barriers = 0U;
 
     for (const auto &read_access : last_reads) {
-        if ((read_access.access & usage_bit).any()) {
+        if (usage_bit.Intersects(read_access.AccessBit())) {
             barriers = read_access.barriers;
             break;
         }
@@ -3933,11 +4055,11 @@ bool ResourceAccessState::WriteInChain(VkPipelineStageFlags2KHR src_exec_scope)
 }
 
 bool ResourceAccessState::WriteInScope(const SyncStageAccessFlags &src_access_scope) const {
-    return (src_access_scope & last_write).any();
+    return src_access_scope.Intersects(last_write);
 }
 
 bool ResourceAccessState::WriteBarrierInScope(const SyncStageAccessFlags &src_access_scope) const {
-    return (write_barriers & src_access_scope).any();
+    return write_barriers.Intersects(src_access_scope);
 }
 
 bool ResourceAccessState::WriteInSourceScopeOrChain(VkPipelineStageFlags2KHR src_exec_scope,
@@ -4020,7 +4142,7 @@ VkPipelineStageFlags2 ResourceAccessState::GetOrderedStages(QueueId queue_id, co
     const VkPipelineStageFlags2 read_stages_in_qso = last_read_stages & ~non_qso_stages;
     VkPipelineStageFlags2 ordered_stages = read_stages_in_qso & ordering.exec_scope;
     // Special input attachment handling as always (not encoded in exec_scop)
-    const bool input_attachment_ordering = (ordering.access_scope & SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ_BIT).any();
+    const bool input_attachment_ordering = ordering.access_scope.Intersects(SYNC_FRAGMENT_SHADER_INPUT_ATTACHMENT_READ_BIT);
     if (input_attachment_ordering && input_attachment_read) {
         // If we have an input attachment in last_reads and input attachments are ordered we all that stage
         ordered_stages |= VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT_KHR;
@@ -4055,17 +4177,17 @@ void ResourceAccessState::TouchupFirstForLayoutTransition(ResourceUsageTag tag,
     }
 }
 
-ResourceAccessState::ReadState::ReadState(VkPipelineStageFlags2KHR stage_, SyncStageAccessFlags access_,
+ResourceAccessState::ReadState::ReadState(VkPipelineStageFlags2KHR stage_, SyncStageAccessIndex access_,
                                           VkPipelineStageFlags2KHR barriers_, ResourceUsageTag tag_)
     : stage(stage_),
-      access(access_),
       barriers(barriers_),
       sync_stages(VK_PIPELINE_STAGE_2_NONE),
+      pending_dep_chain(VK_PIPELINE_STAGE_2_NONE),
       tag(tag_),
-      queue(QueueSyncState::kQueueIdInvalid),
-      pending_dep_chain(VK_PIPELINE_STAGE_2_NONE) {}
+      access(access_),
+      queue(QueueSyncState::kQueueIdInvalid) {}
 
-void ResourceAccessState::ReadState::Set(VkPipelineStageFlags2KHR stage_, const SyncStageAccessFlags &access_,
+void ResourceAccessState::ReadState::Set(VkPipelineStageFlags2KHR stage_, SyncStageAccessIndex access_,
                                          VkPipelineStageFlags2KHR barriers_, ResourceUsageTag tag_) {
     stage = stage_;
     access = access_;
@@ -4096,6 +4218,16 @@ ResourceUsageRange SyncValidator::ReserveGlobalTagRange(size_t tag_count) const
     return reserve;
 }
 
+void SyncValidator::RecordCommandBufferArenaStats(const sync_utils::MonotonicArena &arena) const {
+    if (!report_stats) return;
+    const uint64_t peak = arena.PeakBytesUsed();
+    cb_arena_stats_.command_buffers++;
+    cb_arena_stats_.total_peak_bytes += peak;
+    uint64_t max_peak = cb_arena_stats_.max_peak_bytes.load();
+    while (peak > max_peak && !cb_arena_stats_.max_peak_bytes.compare_exchange_weak(max_peak, peak)) {
+    }
+}
+
 void SyncValidator::ApplyTaggedWait(QueueId queue_id, ResourceUsageTag tag) {
     auto tagged_wait_op = [queue_id, tag](const std::shared_ptr<QueueBatchContext> &batch) {
         batch->ApplyTaggedWait(queue_id, tag);
@@ -4357,11 +4489,13 @@ syncval_state::CommandBuffer::CommandBuffer(SyncValidator *dev, VkCommandBuffer
     : CMD_BUFFER_STATE(dev, cb, pCreateInfo, pool), access_context(*dev, this) {}
 
 void syncval_state::CommandBuffer::Destroy() {
+    if (async_submits_pending.load()) access_context.GetSyncState().WaitForAsyncValidation();
     access_context.Destroy();  // must be first to clean up self references correctly.
     CMD_BUFFER_STATE::Destroy();
 }
 
 void syncval_state::CommandBuffer::Reset() {
+    if (async_submits_pending.load()) access_context.GetSyncState().WaitForAsyncValidation();
     CMD_BUFFER_STATE::Reset();
     access_context.Reset();
 }
@@ -4791,6 +4925,13 @@ void SyncValidator::CreateDevice(const VkDeviceCreateInfo *pCreateInfo) {
     // The state tracker sets up the device state
     StateTracker::CreateDevice(pCreateInfo);
 
+    if (syncval_submit_threads > 0) {
+        submit_workers_ = std::make_unique<sync_utils::WorkerPool>(syncval_submit_threads);
+    }
+    if (enabled[sync_validation_queue_submit] && syncval_async_backlog > 0) {
+        async_worker_ = std::make_unique<sync_utils::SerialWorker>(static_cast<size_t>(syncval_async_backlog));
+    }
+
     ForEachShared<QUEUE_STATE>([this](const std::shared_ptr<QUEUE_STATE> &queue_state) {
         auto queue_flags = physical_device_state->queue_family_properties[queue_state->queueFamilyIndex].queueFlags;
         std::shared_ptr<QueueSyncState> queue_sync_state =
@@ -4799,6 +4940,36 @@ void SyncValidator::CreateDevice(const VkDeviceCreateInfo *pCreateInfo) {
     });
 }
 
+void SyncValidator::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator) {
+    if (async_worker_) {
+        const uint64_t stalls = async_worker_->StallCount();
+        async_worker_->Drain();
+        const uint64_t jobs = async_worker_->JobCount();
+        async_worker_.reset();
+        if (device && report_stats && jobs) {
+            LogInfo(device, "UNASSIGNED-SYNC-AsyncValidation-stats",
+                    "Asynchronous queue validation: %" PRIu64 " queue operations, the application waited for validation %" PRIu64
+                    " times.",
+                    jobs, stalls);
+        }
+    }
+    // Destroys any remaining command buffers, which adds them to the arena stats
+    StateTracker::PreCallRecordDestroyDevice(device, pAllocator);
+
+    const uint64_t command_buffers = cb_arena_stats_.command_buffers.load();
+    if (device && report_stats && command_buffers) {
+        LogInfo(device, "UNASSIGNED-SYNC-CommandBufferArena-stats",
+                "Command buffer sync state arenas: %" PRIu64 " command buffers, %" PRIu64 " bytes average peak, %" PRIu64
+                " bytes max peak.",
+                command_buffers, cb_arena_stats_.total_peak_bytes.load() / command_buffers, cb_arena_stats_.max_peak_bytes.load());
+    }
+    if (device && report_stats && peak_batch_access_states_) {
+        LogInfo(device, "UNASSIGNED-SYNC-ResourceAccessState-stats",
+                "Resource access states: %zu peak in a queue batch, %zu bytes each (excluding read and first access spill).",
+                peak_batch_access_states_, sizeof(ResourceAccessState));
+    }
+}
+
 bool SyncValidator::ValidateBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
                                             const VkSubpassBeginInfo *pSubpassBeginInfo, CMD_TYPE cmd_type) const {
     bool skip = false;
@@ -5407,20 +5578,22 @@ bool SyncValidator::ValidateIndirectBuffer(const CommandBufferAccessContext &cb_
         const ResourceAccessRange range = MakeRange(offset, size);
         auto hazard = context.DetectHazard(*buf_state, SYNC_DRAW_INDIRECT_INDIRECT_COMMAND_READ, range);
         if (hazard.hazard) {
-            skip |= LogError(buf_state->buffer(), string_SyncHazardVUID(hazard.hazard),
-                             "%s: Hazard %s for indirect %s in %s. Access info %s.", caller_name, string_SyncHazard(hazard.hazard),
-                             report_data->FormatHandle(buffer).c_str(), report_data->FormatHandle(commandBuffer).c_str(),
-                             cb_context.FormatHazard(hazard).c_str());
+            skip |= LogErrorDeferred(buf_state->buffer(), string_SyncHazardVUID(hazard.hazard), [&]() {
+                return FormatString("%s: Hazard %s for indirect %s in %s. Access info %s.", caller_name,
+                                    string_SyncHazard(hazard.hazard), report_data->FormatHandle(buffer).c_str(),
+                                    report_data->FormatHandle(commandBuffer).c_str(), cb_context.FormatHazard(hazard).c_str());
+            });
         }
     } else {
         for (uint32_t i = 0; i < drawCount; ++i) {
             const ResourceAccessRange range = MakeRange(offset + i * stride, size);
             auto hazard = context.DetectHazard(*buf_state, SYNC_DRAW_INDIRECT_INDIRECT_COMMAND_READ, range);
             if (hazard.hazard) {
-                skip |= LogError(buf_state->buffer(), string_SyncHazardVUID(hazard.hazard),
-                                 "%s: Hazard %s for indirect %s in %s. Access info %s.", caller_name,
-                                 string_SyncHazard(hazard.hazard), report_data->FormatHandle(buffer).c_str(),
-                                 report_data->FormatHandle(commandBuffer).c_str(), cb_context.FormatHazard(hazard).c_str());
+                skip |= LogErrorDeferred(buf_state->buffer(), string_SyncHazardVUID(hazard.hazard), [&]() {
+                    return FormatString("%s: Hazard %s for indirect %s in %s. Access info %s.", caller_name,
+                                        string_SyncHazard(hazard.hazard), report_data->FormatHandle(buffer).c_str(),
+                                        report_data->FormatHandle(commandBuffer).c_str(), cb_context.FormatHazard(hazard).c_str());
+                });
                 break;
             }
         }
@@ -5455,10 +5628,11 @@ bool SyncValidator::ValidateCountBuffer(const CommandBufferAccessContext &cb_con
     const ResourceAccessRange range = MakeRange(offset, 4);
     auto hazard = context.DetectHazard(*count_buf_state, SYNC_DRAW_INDIRECT_INDIRECT_COMMAND_READ, range);
     if (hazard.hazard) {
-        skip |= LogError(count_buf_state->buffer(), string_SyncHazardVUID(hazard.hazard),
-                         "%s: Hazard %s for countBuffer %s in %s. Access info %s.", CommandTypeString(cmd_type),
-                         string_SyncHazard(hazard.hazard), report_data->FormatHandle(buffer).c_str(),
-                         report_data->FormatHandle(commandBuffer).c_str(), cb_context.FormatHazard(hazard).c_str());
+        skip |= LogErrorDeferred(count_buf_state->buffer(), string_SyncHazardVUID(hazard.hazard), [&]() {
+            return FormatString("%s: Hazard %s for countBuffer %s in %s. Access info %s.", CommandTypeString(cmd_type),
+                                string_SyncHazard(hazard.hazard), report_data->FormatHandle(buffer).c_str(),
+                                report_data->FormatHandle(commandBuffer).c_str(), cb_context.FormatHazard(hazard).c_str());
+        });
     }
     return skip;
 }
@@ -7720,6 +7894,7 @@ void SyncValidator::PreCallRecordCmdExecuteCommands(VkCommandBuffer commandBuffe
 void SyncValidator::PostCallRecordQueueWaitIdle(VkQueue queue, VkResult result) {
     StateTracker::PostCallRecordQueueWaitIdle(queue, result);
     if ((result != VK_SUCCESS) || (!enabled[sync_validation_queue_submit]) || (queue == VK_NULL_HANDLE)) return;
+    WaitForAsyncValidation();
 
     const auto queue_state = GetQueueSyncStateShared(queue);
     if (!queue_state) return;  // Invalid queue
@@ -7732,6 +7907,7 @@ void SyncValidator::PostCallRecordQueueWaitIdle(VkQueue queue, VkResult result)
 
 void SyncValidator::PostCallRecordDeviceWaitIdle(VkDevice device, VkResult result) {
     StateTracker::PostCallRecordDeviceWaitIdle(device, result);
+    WaitForAsyncValidation();
 
     // We need to treat this a fence waits for all queues... noting that present engine ops will be preserved.
     ForAllQueueBatchContexts([](const std::shared_ptr<QueueBatchContext> &batch) {
@@ -7754,34 +7930,40 @@ bool SyncValidator::PreCallValidateQueuePresentKHR(VkQueue queue, const VkPresen
     bool skip = false;
 
     // Since this early return is above the TlsGuard, the Record phase must also be.
-    if (!enabled[sync_validation_queue_submit]) return skip;
+    if (!enabled[sync_validation_queue_submit] || async_worker_) return skip;
 
     vvl::TlsGuard<QueuePresentCmdState> cmd_state(&skip, signaled_semaphores_);
     cmd_state->queue = GetQueueSyncStateShared(queue);
     if (!cmd_state->queue) return skip;  // Invalid Queue
 
+    skip |= ValidateQueuePresent(*cmd_state, *pPresentInfo);
+    if (skip) {
+        cmd_state->present_batch.reset();
+    }
+    return skip;
+}
+
+bool SyncValidator::ValidateQueuePresent(QueuePresentCmdState &cmd_state, const VkPresentInfoKHR &present_info) const {
     // The submit id is a mutable automic which is not recoverable on a skip == true condition
-    uint64_t submit_id = cmd_state->queue->ReserveSubmitId();
+    uint64_t submit_id = cmd_state.queue->ReserveSubmitId();
 
-    std::shared_ptr<const QueueBatchContext> last_batch = cmd_state->queue->LastBatch();
-    std::shared_ptr<QueueBatchContext> batch(std::make_shared<QueueBatchContext>(*this, *cmd_state->queue, submit_id, 0));
+    std::shared_ptr<const QueueBatchContext> last_batch = cmd_state.queue->LastBatch();
+    std::shared_ptr<QueueBatchContext> batch(std::make_shared<QueueBatchContext>(*this, *cmd_state.queue, submit_id, 0));
 
-    ResourceUsageRange tag_range = SetupPresentInfo(*pPresentInfo, batch, cmd_state->presented_images);
-    batch->SetupAccessContext(last_batch, *pPresentInfo, cmd_state->presented_images, cmd_state->signaled);
+    ResourceUsageRange tag_range = SetupPresentInfo(present_info, batch, cmd_state.presented_images);
+    batch->SetupAccessContext(last_batch, present_info, cmd_state.presented_images, cmd_state.signaled);
     batch->SetupBatchTags(tag_range);
     // Update the present tags
-    for (auto &presented : cmd_state->presented_images) {
+    for (auto &presented : cmd_state.presented_images) {
         presented.tag += batch->GetTagRange().begin;
     }
 
-    skip |= batch->DoQueuePresentValidate("vkQueuePresentKHR", cmd_state->presented_images);
-    batch->DoPresentOperations(cmd_state->presented_images);
-    batch->LogPresentOperations(cmd_state->presented_images);
+    const bool skip = batch->DoQueuePresentValidate("vkQueuePresentKHR", cmd_state.presented_images);
+    batch->DoPresentOperations(cmd_state.presented_images);
+    batch->LogPresentOperations(cmd_state.presented_images);
     batch->Cleanup();
 
-    if (!skip) {
-        cmd_state->present_batch = std::move(batch);
-    }
+    cmd_state.present_batch = std::move(batch);
     return skip;
 }
 
@@ -7806,10 +7988,47 @@ ResourceUsageRange SyncValidator::SetupPresentInfo(const VkPresentInfoKHR &prese
     return ResourceUsageRange(0, presented_images.size());
 }
 
+// Copy of the parts of VkPresentInfoKHR used by sync validation, for use after the application's arrays are out of scope
+struct PresentInfoStore {
+    explicit PresentInfoStore(const VkPresentInfoKHR &info)
+        : wait_semaphores(info.pWaitSemaphores, info.pWaitSemaphores + info.waitSemaphoreCount),
+          swapchains(info.pSwapchains, info.pSwapchains + info.swapchainCount),
+          image_indices(info.pImageIndices, info.pImageIndices + info.swapchainCount),
+          present_info(LvlInitStruct<VkPresentInfoKHR>()) {
+        present_info.waitSemaphoreCount = info.waitSemaphoreCount;
+        present_info.pWaitSemaphores = wait_semaphores.data();
+        present_info.swapchainCount = info.swapchainCount;
+        present_info.pSwapchains = swapchains.data();
+        present_info.pImageIndices = image_indices.data();
+    }
+    PresentInfoStore(const PresentInfoStore &) = delete;
+
+    std::vector<VkSemaphore> wait_semaphores;
+    std::vector<VkSwapchainKHR> swapchains;
+    std::vector<uint32_t> image_indices;
+    VkPresentInfoKHR present_info;
+};
+
 void SyncValidator::PostCallRecordQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR *pPresentInfo, VkResult result) {
     StateTracker::PostCallRecordQueuePresentKHR(queue, pPresentInfo, result);
     if (!enabled[sync_validation_queue_submit]) return;
 
+    if (async_worker_) {
+        if (result == VK_ERROR_OUT_OF_HOST_MEMORY || result == VK_ERROR_OUT_OF_DEVICE_MEMORY || result == VK_ERROR_DEVICE_LOST) {
+            return;
+        }
+        std::shared_ptr<const QueueSyncState> queue_state = GetQueueSyncStateShared(queue);
+        if (!queue_state) return;
+        auto present_info = std::make_shared<const PresentInfoStore>(*pPresentInfo);
+        async_worker_->Enqueue([this, queue_state, present_info]() {
+            QueuePresentCmdState cmd_state(signaled_semaphores_);
+            cmd_state.queue = queue_state;
+            ValidateQueuePresent(cmd_state, present_info->present_info);
+            RecordQueuePresent(cmd_state);
+        });
+        return;
+    }
+
     // The earliest return (when enabled), must be *after* the TlsGuard, as it is the TlsGuard that cleans up the cmd_state
     // static payload
     vvl::TlsGuard<QueuePresentCmdState> cmd_state;
@@ -7819,13 +8038,17 @@ void SyncValidator::PostCallRecordQueuePresentKHR(VkQueue queue, const VkPresent
         return;
     }
 
+    RecordQueuePresent(*cmd_state);
+}
+
+void SyncValidator::RecordQueuePresent(QueuePresentCmdState &cmd_state) {
     // Update the state with the data from the validate phase
-    cmd_state->signaled.Resolve(signaled_semaphores_, cmd_state->present_batch);
-    std::shared_ptr<QueueSyncState> queue_state = std::const_pointer_cast<QueueSyncState>(std::move(cmd_state->queue));
-    for (auto &presented : cmd_state->presented_images) {
+    cmd_state.signaled.Resolve(signaled_semaphores_, cmd_state.present_batch);
+    std::shared_ptr<QueueSyncState> queue_state = std::const_pointer_cast<QueueSyncState>(std::move(cmd_state.queue));
+    for (auto &presented : cmd_state.presented_images) {
         presented.ExportToSwapchain(*this);
     }
-    queue_state->UpdateLastBatch(std::move(cmd_state->present_batch));
+    queue_state->UpdateLastBatch(std::move(cmd_state.present_batch));
 }
 
 void SyncValidator::PostCallRecordAcquireNextImageKHR(VkDevice device, VkSwapchainKHR swapchain, uint64_t timeout,
@@ -7833,6 +8056,14 @@ void SyncValidator::PostCallRecordAcquireNextImageKHR(VkDevice device, VkSwapcha
                                                       VkResult result) {
     StateTracker::PostCallRecordAcquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex, result);
     if (!enabled[sync_validation_queue_submit]) return;
+    if (async_worker_) {
+        if ((VK_SUCCESS != result) && (VK_SUBOPTIMAL_KHR != result)) return;
+        async_worker_->Enqueue([this, device, swapchain, timeout, semaphore, fence, image_index = *pImageIndex, result]() mutable {
+            RecordAcquireNextImageState(device, swapchain, timeout, semaphore, fence, &image_index, result,
+                                        "vkAcquireNextImageKHR");
+        });
+        return;
+    }
     RecordAcquireNextImageState(device, swapchain, timeout, semaphore, fence, pImageIndex, result, "vkAcquireNextImageKHR");
 }
 
@@ -7840,6 +8071,14 @@ void SyncValidator::PostCallRecordAcquireNextImage2KHR(VkDevice device, const Vk
                                                        uint32_t *pImageIndex, VkResult result) {
     StateTracker::PostCallRecordAcquireNextImage2KHR(device, pAcquireInfo, pImageIndex, result);
     if (!enabled[sync_validation_queue_submit]) return;
+    if (async_worker_) {
+        if ((VK_SUCCESS != result) && (VK_SUBOPTIMAL_KHR != result)) return;
+        async_worker_->Enqueue([this, device, acquire_info = *pAcquireInfo, image_index = *pImageIndex, result]() mutable {
+            RecordAcquireNextImageState(device, acquire_info.swapchain, acquire_info.timeout, acquire_info.semaphore,
+                                        acquire_info.fence, &image_index, result, "vkAcquireNextImage2KHR");
+        });
+        return;
+    }
     RecordAcquireNextImageState(device, pAcquireInfo->swapchain, pAcquireInfo->timeout, pAcquireInfo->semaphore,
                                 pAcquireInfo->fence, pImageIndex, result, "vkAcquireNextImage2KHR");
 }
@@ -7889,6 +8128,7 @@ void SyncValidator::RecordAcquireNextImageState(VkDevice device, VkSwapchainKHR
 
 bool SyncValidator::PreCallValidateQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits,
                                                VkFence fence) const {
+    if (async_worker_) return false;  // Validated when recorded, see EnqueueQueueSubmit
     auto queue_state = GetQueueSyncStateShared(queue);
     if (!bool(queue_state)) return false;
     SubmitInfoConverter submit_info(submitCount, pSubmits, queue_state->GetQueueFlags());
@@ -7900,30 +8140,39 @@ bool SyncValidator::ValidateQueueSubmit(VkQueue queue, uint32_t submitCount, con
     bool skip = false;
 
     // Since this early return is above the TlsGuard, the Record phase must also be.
-    if (!enabled[sync_validation_queue_submit]) return skip;
+    if (!enabled[sync_validation_queue_submit] || async_worker_) return skip;
 
     vvl::TlsGuard<QueueSubmitCmdState> cmd_state(&skip, func_name, signaled_semaphores_);
     cmd_state->queue = GetQueueSyncStateShared(queue);
     if (!cmd_state->queue) return skip;  // Invalid Queue
 
+    skip |= ValidateQueueSubmit(*cmd_state, submitCount, pSubmits);
+
+    // Note that if we skip, guard cleans up for us, but cannot release the reserved tag range
+    return skip;
+}
+
+bool SyncValidator::ValidateQueueSubmit(QueueSubmitCmdState &cmd_state, uint32_t submitCount, const VkSubmitInfo2 *pSubmits) const {
+    bool skip = false;
+
     // The submit id is a mutable automic which is not recoverable on a skip == true condition
-    uint64_t submit_id = cmd_state->queue->ReserveSubmitId();
+    uint64_t submit_id = cmd_state.queue->ReserveSubmitId();
 
     // verify each submit batch
     // Since the last batch from the queue state is const, we need to track the last_batch separately from the
     // most recently created batch
-    std::shared_ptr<const QueueBatchContext> last_batch = cmd_state->queue->LastBatch();
+    std::shared_ptr<const QueueBatchContext> last_batch = cmd_state.queue->LastBatch();
     std::shared_ptr<QueueBatchContext> batch;
     for (uint32_t batch_idx = 0; batch_idx < submitCount; batch_idx++) {
         const VkSubmitInfo2 &submit = pSubmits[batch_idx];
-        batch = std::make_shared<QueueBatchContext>(*this, *cmd_state->queue, submit_id, batch_idx);
+        batch = std::make_shared<QueueBatchContext>(*this, *cmd_state.queue, submit_id, batch_idx);
         batch->SetupCommandBufferInfo(submit);
-        batch->SetupAccessContext(last_batch, submit, cmd_state->signaled);
+        batch->SetupAccessContext(last_batch, submit, cmd_state.signaled);
 
         // Skip import and validation of empty batches
         if (batch->GetTagRange().size()) {
             batch->SetupBatchTags();
-            skip |= batch->DoQueueSubmitValidate(*this, *cmd_state, submit);
+            skip |= batch->DoQueueSubmitValidate(*this, cmd_state, submit);
         }
 
         // Empty batches could have semaphores, though.
@@ -7932,7 +8181,7 @@ bool SyncValidator::ValidateQueueSubmit(VkQueue queue, uint32_t submitCount, con
             // Make a copy of the state, signal the copy and pend it...
             auto sem_state = Get<SEMAPHORE_STATE>(semaphore_info.semaphore);
             if (!sem_state) continue;
-            cmd_state->signaled.SignalSemaphore(sem_state, batch, semaphore_info);
+            cmd_state.signaled.SignalSemaphore(sem_state, batch, semaphore_info);
         }
         // Unless the previous batch was referenced by a signal, the QueueBatchContext will self destruct, but as
         // we ResolvePrevious as we can let any contexts we've fully referenced go.
@@ -7941,10 +8190,8 @@ bool SyncValidator::ValidateQueueSubmit(VkQueue queue, uint32_t submitCount, con
     }
     // The most recently created batch will become the queue's "last batch" in the record phase
     if (batch) {
-        cmd_state->last_batch = std::move(batch);
+        cmd_state.last_batch = std::move(batch);
     }
-
-    // Note that if we skip, guard cleans up for us, but cannot release the reserved tag range
     return skip;
 }
 
@@ -7952,12 +8199,19 @@ void SyncValidator::PostCallRecordQueueSubmit(VkQueue queue, uint32_t submitCoun
                                               VkResult result) {
     StateTracker::PostCallRecordQueueSubmit(queue, submitCount, pSubmits, fence, result);
 
+    if (async_worker_) {
+        auto queue_state = GetQueueSyncStateShared(queue);
+        if (!queue_state) return;
+        EnqueueQueueSubmit(queue, std::make_shared<SubmitInfoConverter>(submitCount, pSubmits, queue_state->GetQueueFlags()),
+                           fence, result, "vkQueueSubmit");
+        return;
+    }
     RecordQueueSubmit(queue, fence, result);
 }
 
 void SyncValidator::RecordQueueSubmit(VkQueue queue, VkFence fence, VkResult result) {
     // If this return is above the TlsGuard, then the Validate phase return must also be.
-    if (!enabled[sync_validation_queue_submit]) return;  // Queue submit validation must be affirmatively enabled
+    if (!enabled[sync_validation_queue_submit] || async_worker_) return;  // Queue submit validation must be affirmatively enabled
 
     // The earliest return (when enabled), must be *after* the TlsGuard, as it is the TlsGuard that cleans up the cmd_state
     // static payload
@@ -7966,14 +8220,58 @@ void SyncValidator::RecordQueueSubmit(VkQueue queue, VkFence fence, VkResult res
     if (VK_SUCCESS != result) return;  // dispatched QueueSubmit failed
     if (!cmd_state->queue) return;     // Validation couldn't find a valid queue object
 
+    RecordQueueSubmit(*cmd_state, fence);
+}
+
+void SyncValidator::RecordQueueSubmit(QueueSubmitCmdState &cmd_state, VkFence fence) {
     // Don't need to look up the queue state again, but we need a non-const version
-    std::shared_ptr<QueueSyncState> queue_state = std::const_pointer_cast<QueueSyncState>(std::move(cmd_state->queue));
+    std::shared_ptr<QueueSyncState> queue_state = std::const_pointer_cast<QueueSyncState>(std::move(cmd_state.queue));
 
-    cmd_state->signaled.Resolve(signaled_semaphores_, cmd_state->last_batch);
-    queue_state->UpdateLastBatch(std::move(cmd_state->last_batch));
+    cmd_state.signaled.Resolve(signaled_semaphores_, cmd_state.last_batch);
+    queue_state->UpdateLastBatch(std::move(cmd_state.last_batch));
 
     ResourceUsageRange fence_tag_range = ReserveGlobalTagRange(1U);
     UpdateFenceWaitInfo(fence, queue_state->GetQueueId(), fence_tag_range.begin);
+
+    // Submit time is when the queue access states are at their largest.  Counting the entries of one context is cheap, unlike
+    // tracking every ResourceAccessState as it is copied and destroyed.
+    if (report_stats) {
+        const auto last_batch = queue_state->LastBatch();
+        if (last_batch) {
+            peak_batch_access_states_ =
+                std::max(peak_batch_access_states_, last_batch->GetCurrentAccessContext()->AccessStateCount());
+        }
+    }
+}
+
+// Asynchronous mode: the submit has already been handed to the driver, so hazards can only be reported, not skipped.  The
+// validate and record phases both run on the worker, in submission order with the other queue operations.
+void SyncValidator::EnqueueQueueSubmit(VkQueue queue, std::shared_ptr<const SubmitInfoConverter> &&submit_info, VkFence fence,
+                                       VkResult result, const char *func_name) {
+    if (VK_SUCCESS != result) return;  // dispatched QueueSubmit failed
+    std::shared_ptr<const QueueSyncState> queue_state = GetQueueSyncStateShared(queue);
+    if (!queue_state) return;
+
+    // Hold the command buffers, and keep them from being reset until the worker is done reading their access contexts
+    std::vector<std::shared_ptr<syncval_state::CommandBuffer>> cbs;
+    for (const auto &submit : submit_info->info2s) {
+        for (uint32_t cb_index = 0; cb_index < submit.commandBufferInfoCount; ++cb_index) {
+            auto cb_state = Get<syncval_state::CommandBuffer>(submit.pCommandBufferInfos[cb_index].commandBuffer);
+            if (!cb_state) continue;
+            cb_state->async_submits_pending++;
+            cbs.emplace_back(std::move(cb_state));
+        }
+    }
+
+    async_worker_->Enqueue([this, queue_state, submit_info, fence, func_name, cbs]() {
+        QueueSubmitCmdState cmd_state(func_name, signaled_semaphores_);
+        cmd_state.queue = queue_state;
+        ValidateQueueSubmit(cmd_state, static_cast<uint32_t>(submit_info->info2s.size()), submit_info->info2s.data());
+        RecordQueueSubmit(cmd_state, fence);
+        for (const auto &cb_state : cbs) {
+            cb_state->async_submits_pending--;
+        }
+    });
 }
 
 bool SyncValidator::PreCallValidateQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR *pSubmits,
@@ -7988,11 +8286,19 @@ bool SyncValidator::PreCallValidateQueueSubmit2(VkQueue queue, uint32_t submitCo
 void SyncValidator::PostCallRecordQueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR *pSubmits,
                                                   VkFence fence, VkResult result) {
     StateTracker::PostCallRecordQueueSubmit2KHR(queue, submitCount, pSubmits, fence, result);
+    if (async_worker_) {
+        EnqueueQueueSubmit(queue, std::make_shared<SubmitInfoConverter>(submitCount, pSubmits), fence, result, "vkQueueSubmit2KHR");
+        return;
+    }
     RecordQueueSubmit(queue, fence, result);
 }
 void SyncValidator::PostCallRecordQueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2KHR *pSubmits, VkFence fence,
                                                VkResult result) {
     StateTracker::PostCallRecordQueueSubmit2(queue, submitCount, pSubmits, fence, result);
+    if (async_worker_) {
+        EnqueueQueueSubmit(queue, std::make_shared<SubmitInfoConverter>(submitCount, pSubmits), fence, result, "vkQueueSubmit2");
+        return;
+    }
     RecordQueueSubmit(queue, fence, result);
 }
 
@@ -8001,7 +8307,11 @@ void SyncValidator::PostCallRecordGetFenceStatus(VkDevice device, VkFence fence,
     if (!enabled[sync_validation_queue_submit]) return;
     if (result == VK_SUCCESS) {
         // fence is signalled, mark it as waited for
-        WaitForFence(fence);
+        if (async_worker_) {
+            async_worker_->Enqueue([this, fence]() { WaitForFence(fence); });
+        } else {
+            WaitForFence(fence);
+        }
     }
 }
 
@@ -8011,12 +8321,41 @@ void SyncValidator::PostCallRecordWaitForFences(VkDevice device, uint32_t fenceC
     if (!enabled[sync_validation_queue_submit]) return;
     if ((result == VK_SUCCESS) && ((VK_TRUE == waitAll) || (1 == fenceCount))) {
         // We can only know the pFences have signal if we waited for all of them, or there was only one of them
+        if (async_worker_) {
+            async_worker_->Enqueue([this, fences = std::vector<VkFence>(pFences, pFences + fenceCount)]() {
+                for (const VkFence fence : fences) {
+                    WaitForFence(fence);
+                }
+            });
+            return;
+        }
         for (uint32_t i = 0; i < fenceCount; i++) {
             WaitForFence(pFences[i]);
         }
     }
 }
 
+void SyncValidator::WaitForAsyncValidation() const {
+    if (async_worker_) async_worker_->Drain();
+}
+
+void SyncValidator::PreCallRecordDestroyFence(VkDevice device, VkFence fence, const VkAllocationCallbacks *pAllocator) {
+    // Queued operations look up fence state by handle
+    WaitForAsyncValidation();
+    StateTracker::PreCallRecordDestroyFence(device, fence, pAllocator);
+}
+
+void SyncValidator::PreCallRecordDestroySemaphore(VkDevice device, VkSemaphore semaphore, const VkAllocationCallbacks *pAllocator) {
+    WaitForAsyncValidation();
+    StateTracker::PreCallRecordDestroySemaphore(device, semaphore, pAllocator);
+}
+
+void SyncValidator::PreCallRecordDestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain,
+                                                     const VkAllocationCallbacks *pAllocator) {
+    WaitForAsyncValidation();
+    StateTracker::PreCallRecordDestroySwapchainKHR(device, swapchain, pAllocator);
+}
+
 AttachmentViewGen::AttachmentViewGen(const IMAGE_VIEW_STATE *view, const VkOffset3D &offset, const VkExtent3D &extent)
     : view_(view), view_mask_(), gen_store_() {
     if (!view_ || !view_->image_state || !SimpleBinding(*view_->image_state)) return;
@@ -8154,7 +8493,16 @@ void QueueBatchContext::Trim() {
 }
 
 void QueueBatchContext::ResolveSubmittedCommandBuffer(const AccessContext &recorded_context, ResourceUsageTag offset) {
-    GetCurrentAccessContext()->ResolveFromContext(QueueTagOffsetBarrierAction(GetQueueId(), offset), recorded_context);
+    sync_utils::WorkerPool *workers = GetSyncState().GetSubmitWorkers();
+    // Only worth handing off when there is real work for more than one address type
+    const bool parallel = workers && std::all_of(kAddressTypes.cbegin(), kAddressTypes.cend(), [&](AccessAddressType address_type) {
+                              return recorded_context.GetAccessStateMap(address_type).size() >= AccessContext::kFirstUsePartitionSize;
+                          });
+    if (parallel) {
+        GetCurrentAccessContext()->ResolveFromContext(QueueTagOffsetBarrierAction(GetQueueId(), offset), recorded_context, *workers);
+    } else {
+        GetCurrentAccessContext()->ResolveFromContext(QueueTagOffsetBarrierAction(GetQueueId(), offset), recorded_context);
+    }
 }
 
 VulkanTypedHandle QueueBatchContext::Handle() const { return queue_state_->Handle(); }
@@ -8194,9 +8542,11 @@ void QueueBatchContext::ApplyAcquireWait(const AcquiredImage &acquired) {
 HazardResult QueueBatchContext::DetectFirstUseHazard(const ResourceUsageRange &tag_range) {
     // Queue batch handling requires dealing with renderpass state and picking the correct access context
     if (rp_replay_) {
-        return rp_replay_.replay_context->DetectFirstUseHazard(GetQueueId(), tag_range, *current_access_context_);
+        return rp_replay_.replay_context->DetectFirstUseHazard(GetQueueId(), tag_range, *current_access_context_,
+                                                              GetSyncState().GetSubmitWorkers());
     }
-    return current_replay_->GetCurrentAccessContext()->DetectFirstUseHazard(GetQueueId(), tag_range, access_context_);
+    return current_replay_->GetCurrentAccessContext()->DetectFirstUseHazard(GetQueueId(), tag_range, access_context_,
+                                                                             GetSyncState().GetSubmitWorkers());
 }
 
 void QueueBatchContext::BeginRenderPassReplay(const SyncOpBeginRenderPass &begin_op, const ResourceUsageTag tag) {
@@ -8702,6 +9052,26 @@ SubmitInfoConverter::BatchStore::BatchStore(const VkSubmitInfo &info, VkQueueFla
     info2.pSignalSemaphoreInfos = signals.data();
 }
 
+SubmitInfoConverter::BatchStore::BatchStore(const VkSubmitInfo2 &info)
+    : waits(info.pWaitSemaphoreInfos, info.pWaitSemaphoreInfos + info.waitSemaphoreInfoCount),
+      cbs(info.pCommandBufferInfos, info.pCommandBufferInfos + info.commandBufferInfoCount),
+      signals(info.pSignalSemaphoreInfos, info.pSignalSemaphoreInfos + info.signalSemaphoreInfoCount),
+      info2(info) {
+    info2.pNext = nullptr;
+    info2.pWaitSemaphoreInfos = waits.data();
+    info2.pCommandBufferInfos = cbs.data();
+    info2.pSignalSemaphoreInfos = signals.data();
+}
+
+SubmitInfoConverter::SubmitInfoConverter(uint32_t count, const VkSubmitInfo2 *infos) {
+    info_store.reserve(count);
+    info2s.reserve(count);
+    for (uint32_t batch = 0; batch < count; ++batch) {
+        info_store.emplace_back(infos[batch]);
+        info2s.emplace_back(info_store.back().info2);
+    }
+}
+
 SubmitInfoConverter::SubmitInfoConverter(uint32_t count, const VkSubmitInfo *infos, VkQueueFlags queue_flags) {
     info_store.reserve(count);
     info2s.reserve(count);
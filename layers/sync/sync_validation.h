@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <limits>
 #include <memory>
 #include <set>
@@ -26,6 +27,7 @@
 #include "state_tracker/state_tracker.h"
 #include "state_tracker/cmd_buffer_state.h"
 #include "state_tracker/render_pass_state.h"
+#include "sync/sync_utils.h"
 
 class AccessContext;
 class CommandBufferAccessContext;
@@ -33,6 +35,7 @@ class CommandExecutionContext;
 struct PresentedImage;
 class QueueBatchContext;
 struct QueueSubmitCmdState;
+struct QueuePresentCmdState;
 class RenderPassAccessContext;
 class ResourceAccessState;
 struct ResourceFirstAccess;
@@ -79,11 +82,11 @@ struct SyncStageAccess {
         return static_cast<SyncStageAccessFlags>(FlagBit(stage_access));
     }
 
-    static bool IsRead(const SyncStageAccessFlags &stage_access_bit) { return (stage_access_bit & syncStageAccessReadMask).any(); }
+    static bool IsRead(const SyncStageAccessFlags &stage_access_bit) { return stage_access_bit.Intersects(syncStageAccessReadMask); }
     static bool IsRead(SyncStageAccessIndex stage_access_index) { return IsRead(FlagBit(stage_access_index)); }
 
     static bool IsWrite(const SyncStageAccessFlags &stage_access_bit) {
-        return (stage_access_bit & syncStageAccessWriteMask).any();
+        return stage_access_bit.Intersects(syncStageAccessWriteMask);
     }
     static bool IsWrite(SyncStageAccessIndex stage_access_index) { return IsWrite(FlagBit(stage_access_index)); }
     static VkPipelineStageFlags2KHR PipelineStageBit(SyncStageAccessIndex stage_access_index) {
@@ -429,17 +432,18 @@ class ResourceAccessState : public SyncStageAccess {
     // and applicable one for hazard detection
     struct ReadState {
         VkPipelineStageFlags2KHR stage;        // The stage of this read
-        SyncStageAccessFlags access;           // TODO: Change to FlagBits when we have a None bit enum
-                                               // TODO: Revisit whether this needs to support multiple reads per stage
         VkPipelineStageFlags2KHR barriers;     // all applicable barriered stages
         VkPipelineStageFlags2KHR sync_stages;  // reads known to have happened after this
-        ResourceUsageTag tag;
-        QueueId queue;
         VkPipelineStageFlags2KHR pending_dep_chain;  // Should be zero except during barrier application
                                                      // Excluded from comparison
+        ResourceUsageTag tag;
+        SyncStageAccessIndex access;  // A read is always a single stage/access, store the index rather than a 128 bit mask
+                                      // TODO: Revisit whether this needs to support multiple reads per stage
+        QueueId queue;
         ReadState() = default;
-        ReadState(VkPipelineStageFlags2KHR stage_, SyncStageAccessFlags access_, VkPipelineStageFlags2KHR barriers_,
+        ReadState(VkPipelineStageFlags2KHR stage_, SyncStageAccessIndex access_, VkPipelineStageFlags2KHR barriers_,
                   ResourceUsageTag tag_);
+        SyncStageAccessFlags AccessBit() const { return FlagBit(access); }
         bool operator==(const ReadState &rhs) const {
             return (stage == rhs.stage) && (access == rhs.access) && (barriers == rhs.barriers) &&
                    (sync_stages == rhs.sync_stages) && (tag == rhs.tag) && (queue == rhs.queue) &&
@@ -461,7 +465,7 @@ class ResourceAccessState : public SyncStageAccess {
         }
 
         bool operator!=(const ReadState &rhs) const { return !(*this == rhs); }
-        void Set(VkPipelineStageFlags2KHR stage_, const SyncStageAccessFlags &access_, VkPipelineStageFlags2KHR barriers_,
+        void Set(VkPipelineStageFlags2KHR stage_, SyncStageAccessIndex access_, VkPipelineStageFlags2KHR barriers_,
                  ResourceUsageTag tag_);
         bool ReadInScopeOrChain(VkPipelineStageFlags2 exec_scope) const { return (exec_scope & (stage | barriers)) != 0; }
         bool ReadInQueueScopeOrChain(QueueId queue, VkPipelineStageFlags2 exec_scope) const;
@@ -613,7 +617,7 @@ class ResourceAccessState : public SyncStageAccess {
 
   private:
     static constexpr VkPipelineStageFlags2KHR kInvalidAttachmentStage = ~VkPipelineStageFlags2KHR(0);
-    bool IsWriteHazard(SyncStageAccessFlags usage) const { return (usage & ~write_barriers).any(); }
+    bool IsWriteHazard(SyncStageAccessFlags usage) const { return usage.Intersects(~write_barriers); }
     bool IsRAWHazard(VkPipelineStageFlags2KHR usage_stage, const SyncStageAccessFlags &usage) const;
 
     // Apply ordering scope to write hazard detection
@@ -662,16 +666,13 @@ class ResourceAccessState : public SyncStageAccess {
     // With reads, each must be "safe" relative to it's prior write, so we need only
     // save the most recent write operation (as anything *transitively* unsafe would arleady
     // be included
+    //
+    // NOTE: members are ordered by size, keeping the small ones together, as every entry of every access map is one of these.
     SyncStageAccessFlags write_barriers;              // union of applicable barrier masks since last write
     VkPipelineStageFlags2KHR write_dependency_chain;  // intiially zero, but accumulating the dstStages of barriers if they chain.
     ResourceUsageTag write_tag;
-    QueueId write_queue;
     SyncStageAccessFlags last_write;  // only the most recent write
 
-    // TODO Input Attachment cleanup for multiple reads in a given stage
-    // Tracks whether the fragment shader read is input attachment read
-    bool input_attachment_read;
-
     VkPipelineStageFlags2KHR last_read_stages;
     VkPipelineStageFlags2KHR read_execution_barriers;
     using ReadStates = small_vector<ReadState, 3, uint32_t>;
@@ -679,19 +680,29 @@ class ResourceAccessState : public SyncStageAccess {
 
     // Pending execution state to support independent parallel barriers
     VkPipelineStageFlags2KHR pending_write_dep_chain;
-    bool pending_layout_transition;
     SyncStageAccessFlags pending_write_barriers;
     OrderingBarrier pending_layout_ordering_;
     FirstAccesses first_accesses_;
     VkPipelineStageFlags2KHR first_read_stages_;
     OrderingBarrier first_write_layout_ordering_;
 
+    QueueId write_queue;
+    // TODO Input Attachment cleanup for multiple reads in a given stage
+    // Tracks whether the fragment shader read is input attachment read
+    bool input_attachment_read;
+    bool pending_layout_transition;
+
     static OrderingBarriers kOrderingRules;
 };
 using ResourceAccessStateFunction = std::function<void(ResourceAccessState *)>;
 
 using ResourceAddress = VkDeviceSize;
+#ifdef VVL_SYNCVAL_POOLED_ACCESS_MAPS
+// Access state maps are split and merged on every recorded access, draw their nodes from a per map pool
+using ResourceAccessRangeMap = sparse_container::pooled_range_map<ResourceAddress, ResourceAccessState>;
+#else
 using ResourceAccessRangeMap = sparse_container::range_map<ResourceAddress, ResourceAccessState>;
+#endif
 using ResourceAccessRange = typename ResourceAccessRangeMap::key_type;
 using ResourceRangeMergeIterator = sparse_container::parallel_iterator<ResourceAccessRangeMap, const ResourceAccessRangeMap>;
 
@@ -1059,8 +1070,10 @@ class AccessContext {
     void RecordLayoutTransitions(const RENDER_PASS_STATE &rp_state, uint32_t subpass,
                                  const AttachmentViewGenVector &attachment_views, ResourceUsageTag tag);
 
-    HazardResult DetectFirstUseHazard(QueueId queue_id, const ResourceUsageRange &tag_range,
-                                      const AccessContext &access_context) const;
+    // Recorded accesses per partition when first use detection is split across a worker pool
+    static constexpr size_t kFirstUsePartitionSize = 256;
+    HazardResult DetectFirstUseHazard(QueueId queue_id, const ResourceUsageRange &tag_range, const AccessContext &access_context,
+                                      sync_utils::WorkerPool *workers = nullptr) const;
 
     const TrackBack &GetDstExternalTrackBack() const { return dst_external_; }
     void Reset() {
@@ -1096,6 +1109,9 @@ class AccessContext {
     template <typename ResolveOp>
     void ResolveFromContext(ResolveOp &&resolve_op, const AccessContext &from_context,
                             const ResourceAccessState *infill_state = nullptr, bool recur_to_infill = false);
+    // Resolves the address types concurrently, as each has a separate map
+    template <typename ResolveOp>
+    void ResolveFromContext(ResolveOp &&resolve_op, const AccessContext &from_context, sync_utils::WorkerPool &workers);
     template <typename ResolveOp, typename RangeGenerator>
     void ResolveFromContext(ResolveOp &&resolve_op, const AccessContext &from_context, AccessAddressType address_type,
                             RangeGenerator range_gen, const ResourceAccessState *infill_state = nullptr,
@@ -1141,6 +1157,14 @@ class AccessContext {
     const ResourceAccessRangeMap &GetAccessStateMap(AccessAddressType type) const {
         return access_state_maps_[static_cast<size_t>(type)];
     }
+    // Number of ResourceAccessState entries over all address types
+    size_t AccessStateCount() const {
+        size_t count = 0;
+        for (const auto &map : access_state_maps_) {
+            count += map.size();
+        }
+        return count;
+    }
     const TrackBack *GetTrackBackFromSubpass(uint32_t subpass) const {
         if (subpass == VK_SUBPASS_EXTERNAL) {
             return src_external_;
@@ -1459,29 +1483,8 @@ class CommandBufferAccessContext : public CommandExecutionContext {
     ~CommandBufferAccessContext() override = default;
     const CommandExecutionContext &GetExecutionContext() const { return *this; }
 
-    void Destroy() {
-        // the cb self reference must be cleared or the command buffer reference count will never go to 0
-        cbs_referenced_.reset();
-        cb_state_ = nullptr;
-    }
-
-    void Reset() {
-        access_log_ = std::make_shared<AccessLog>();
-        cbs_referenced_ = std::make_shared<CommandBufferSet>();
-        if (cb_state_) {
-            cbs_referenced_->insert(cb_state_->shared_from_this());
-        }
-        sync_ops_.clear();
-        command_number_ = 0;
-        subcommand_number_ = 0;
-        reset_count_++;
-        command_handles_.clear();
-        cb_access_context_.Reset();
-        render_pass_contexts_.clear();
-        current_context_ = &cb_access_context_;
-        current_renderpass_context_ = nullptr;
-        events_context_.Clear();
-    }
+    void Destroy();
+    void Reset();
 
     std::string FormatUsage(ResourceUsageTag tag) const override;
     std::string FormatUsage(const ResourceFirstAccess &access) const;  //  Only command buffers have "first usage"
@@ -1553,7 +1556,7 @@ class CommandBufferAccessContext : public CommandExecutionContext {
     template <class T, class... Args>
     void RecordSyncOp(Args &&...args) {
         // T must be as derived from SyncOpBase or the compiler will flag the next line as an error.
-        SyncOpPointer sync_op(std::make_shared<T>(std::forward<Args>(args)...));
+        SyncOpPointer sync_op(std::allocate_shared<T>(sync_utils::ArenaAllocator<T>(&arena_), std::forward<Args>(args)...));
         RecordSyncOp(std::move(sync_op));  // Call the non-template version
     }
     std::shared_ptr<AccessLog> GetAccessLogShared() const { return access_log_; }
@@ -1575,12 +1578,16 @@ class CommandBufferAccessContext : public CommandExecutionContext {
     uint32_t reset_count_;
     small_vector<NamedHandle, 1> command_handles_;
 
+    // Backing store for the sync ops and render pass contexts, recycled on Reset.  Declared before its users so that they
+    // are destroyed first.
+    sync_utils::MonotonicArena arena_;
+
     AccessContext cb_access_context_;
     AccessContext *current_context_;
     SyncEventsContext events_context_;
 
     // Don't need the following for an active proxy cb context
-    std::vector<std::unique_ptr<RenderPassAccessContext>> render_pass_contexts_;
+    std::vector<sync_utils::ArenaUniquePtr<RenderPassAccessContext>> render_pass_contexts_;
     RenderPassAccessContext *current_renderpass_context_;
     std::vector<SyncOpEntry> sync_ops_;
 };
@@ -1598,6 +1605,9 @@ class CommandBuffer : public CMD_BUFFER_STATE {
 
     void Destroy() override;
     void Reset() override;
+
+    // Queue submissions of this command buffer still waiting for asynchronous validation, which reads the access context
+    std::atomic<uint32_t> async_submits_pending{0};
 };
 }  // namespace syncval_state
 VALSTATETRACK_DERIVED_STATE_OBJECT(VkCommandBuffer, syncval_state::CommandBuffer, CMD_BUFFER_STATE);
@@ -1893,6 +1903,7 @@ struct SubmitInfoConverter {
         static VkSemaphoreSubmitInfo WaitSemaphore(const VkSubmitInfo &info, uint32_t index);
         static VkCommandBufferSubmitInfo CommandBuffer(const VkSubmitInfo &info, uint32_t index);
         static VkSemaphoreSubmitInfo SignalSemaphore(const VkSubmitInfo &info, uint32_t index, VkQueueFlags queue_flags);
+        explicit BatchStore(const VkSubmitInfo2 &info);
 
         std::vector<VkSemaphoreSubmitInfo> waits;
         std::vector<VkCommandBufferSubmitInfo> cbs;
@@ -1901,6 +1912,9 @@ struct SubmitInfoConverter {
     };
 
     SubmitInfoConverter(uint32_t count, const VkSubmitInfo *infos, VkQueueFlags queue_flags);
+    // Deep copy, for use after the application's arrays are out of scope.  The pNext chains are not copied.
+    SubmitInfoConverter(uint32_t count, const VkSubmitInfo2 *infos);
+    SubmitInfoConverter(const SubmitInfoConverter &) = delete;  // the VkSubmitInfo2's point into info_store
 
     std::vector<BatchStore> info_store;
     std::vector<VkSubmitInfo2> info2s;
@@ -1916,6 +1930,17 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
     mutable std::atomic<ResourceUsageTag> tag_limit_{1};  // This is reserved in Validation phase, thus mutable and atomic
     ResourceUsageRange ReserveGlobalTagRange(size_t tag_count) const;  // Note that the tag_limit_ is mutable this has side effects
 
+    // Peak arena usage of command buffer recordings, gathered as command buffers are destroyed and reported at vkDestroyDevice
+    struct CommandBufferArenaStats {
+        std::atomic<uint64_t> command_buffers{0};
+        std::atomic<uint64_t> total_peak_bytes{0};
+        std::atomic<uint64_t> max_peak_bytes{0};
+    };
+    mutable CommandBufferArenaStats cb_arena_stats_;
+    void RecordCommandBufferArenaStats(const sync_utils::MonotonicArena &arena) const;
+    // Largest queue batch access context, sampled at queue submit with report_stats. Guarded by the queue level locking
+    size_t peak_batch_access_states_ = 0;
+
     vvl::unordered_map<VkQueue, std::shared_ptr<QueueSyncState>> queue_sync_states_;
     QueueId queue_id_limit_ = QueueSyncState::kQueueIdBase;
     SignaledSemaphores signaled_semaphores_;
@@ -1924,6 +1949,18 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
     using SignaledFence = SignaledFences::value_type;
     SignaledFences waitable_fences_;
 
+    // Optional worker threads for splitting queue submit validation by address range, see syncval_submit_threads
+    std::unique_ptr<sync_utils::WorkerPool> submit_workers_;
+    sync_utils::WorkerPool *GetSubmitWorkers() const { return submit_workers_.get(); }
+
+    // Optional background thread for queue submit validation, see syncval_async_backlog.  Declared after the state it
+    // works on, so it is stopped before that state is destroyed.  When present, every operation on
+    // queue_sync_states_, signaled_semaphores_ and waitable_fences_ (submit, present, acquire, fence waits) runs on it in
+    // API order, and hazards are reported from it.  The application thread waits for it at queue/device wait idle, when
+    // the backlog is full, and before destroying anything a queued operation may still look up.
+    std::unique_ptr<sync_utils::SerialWorker> async_worker_;
+    void WaitForAsyncValidation() const;
+
     void ApplyTaggedWait(QueueId queue_id, ResourceUsageTag tag);
     void ApplyAcquireWait(const AcquiredImage &acquired);
     template <typename BatchOp>
@@ -1966,6 +2003,13 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
     bool SupressedBoundDescriptorWAW(const HazardResult &hazard) const;
 
     void CreateDevice(const VkDeviceCreateInfo *pCreateInfo) override;
+    void PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator) override;
+
+    // With fine grained locking the vkCmd* hooks run without validation_object_mutex. They only touch the access context
+    // of the command buffer being recorded (externally synchronized by the application), the state tracker objects (which
+    // do their own locking) and atomics. validation_object_mutex then only serializes the queue level hooks, which share
+    // queue_sync_states_, signaled_semaphores_ and waitable_fences_.
+    bool HasLockFreeCmdHooks() override { return fine_grained_locking; }
 
     bool ValidateBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin,
                                  const VkSubpassBeginInfo *pSubpassBeginInfo, CMD_TYPE cmd_type) const;
@@ -2328,6 +2372,8 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
     void PostCallRecordDeviceWaitIdle(VkDevice device, VkResult result) override;
 
     bool PreCallValidateQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR *pPresentInfo) const override;
+    bool ValidateQueuePresent(QueuePresentCmdState &cmd_state, const VkPresentInfoKHR &present_info) const;
+    void RecordQueuePresent(QueuePresentCmdState &cmd_state);
     ResourceUsageRange SetupPresentInfo(const VkPresentInfoKHR &present_info, std::shared_ptr<QueueBatchContext> &batch,
                                         PresentedImages &presented_images) const;
     void PostCallRecordQueuePresentKHR(VkQueue queue, const VkPresentInfoKHR *pPresentInfo, VkResult result) override;
@@ -2339,6 +2385,10 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
                                      VkFence fence, uint32_t *pImageIndex, VkResult result, const char *func_name);
     bool ValidateQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2 *pSubmits, VkFence fence,
                              const char *func_name) const;
+    bool ValidateQueueSubmit(QueueSubmitCmdState &cmd_state, uint32_t submitCount, const VkSubmitInfo2 *pSubmits) const;
+    void RecordQueueSubmit(QueueSubmitCmdState &cmd_state, VkFence fence);
+    void EnqueueQueueSubmit(VkQueue queue, std::shared_ptr<const SubmitInfoConverter> &&submit_info, VkFence fence, VkResult result,
+                            const char *func_name);
     bool PreCallValidateQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits,
                                     VkFence fence) const override;
     void RecordQueueSubmit(VkQueue queue, VkFence fence, VkResult result);
@@ -2355,4 +2405,9 @@ class SyncValidator : public ValidationStateTracker, public SyncStageAccess {
     void PostCallRecordGetFenceStatus(VkDevice device, VkFence fence, VkResult result) override;
     void PostCallRecordWaitForFences(VkDevice device, uint32_t fenceCount, const VkFence *pFences, VkBool32 waitAll,
                                      uint64_t timeout, VkResult result) override;
+
+    void PreCallRecordDestroyFence(VkDevice device, VkFence fence, const VkAllocationCallbacks *pAllocator) override;
+    void PreCallRecordDestroySemaphore(VkDevice device, VkSemaphore semaphore, const VkAllocationCallbacks *pAllocator) override;
+    void PreCallRecordDestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain,
+                                          const VkAllocationCallbacks *pAllocator) override;
 };
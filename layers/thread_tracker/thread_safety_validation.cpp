@@ -39,7 +39,7 @@ void ThreadSafety::PostCallRecordAllocateCommandBuffers(VkDevice device, const V
         auto lock = WriteLockGuard(thread_safety_lock);
         auto& pool_command_buffers = pool_command_buffers_map[pAllocateInfo->commandPool];
         for (uint32_t index = 0; index < pAllocateInfo->commandBufferCount; index++) {
-            command_pool_map.insert_or_assign(pCommandBuffers[index], pAllocateInfo->commandPool);
+            command_pool_map.insert_or_assign(CastToUint64(pCommandBuffers[index]), pAllocateInfo->commandPool);
             CreateObject(pCommandBuffers[index]);
             pool_command_buffers.insert(pCommandBuffers[index]);
         }
@@ -357,7 +357,7 @@ void ThreadSafety::PreCallRecordFreeCommandBuffers(VkDevice device, VkCommandPoo
             FinishWriteObject(pCommandBuffers[index], "vkFreeCommandBuffers", lockCommandPool);
             DestroyObject(pCommandBuffers[index]);
             pool_command_buffers.erase(pCommandBuffers[index]);
-            command_pool_map.erase(pCommandBuffers[index]);
+            command_pool_map.erase(CastToUint64(pCommandBuffers[index]));
         }
     }
 }
@@ -77,6 +77,12 @@ class alignas(get_hardware_destructive_interference_size()) ObjectUseData {
     }
     WriteReadCount GetCount() { return WriteReadCount(writer_reader_count); }
 
+    // Only called when the entry is (re)assigned to a newly created object
+    void Reset() {
+        writer_reader_count.store(0, std::memory_order_relaxed);
+        thread.store(std::thread::id(), std::memory_order_relaxed);
+    }
+
     void WaitForObjectIdle(bool is_writer) {
         // Wait for thread-safe access to object instead of skipping call.
         while (GetCount().GetReadCount() > (int)(!is_writer) || GetCount().GetWriteCount() > (int)is_writer) {
@@ -91,6 +97,43 @@ class alignas(get_hardware_destructive_interference_size()) ObjectUseData {
     std::atomic<int64_t> writer_reader_count{};
 };
 
+// Stable storage for the ObjectUseData of one counter.
+//
+// Entries are handed out as raw pointers and are never freed while the pool lives, so a thread that looked an object up
+// just before another thread destroyed it (an application threading error, which is reported) still touches valid
+// memory. Released entries are recycled once they are idle.
+class ObjectUseDataPool {
+  public:
+    ObjectUseData *Acquire() {
+        std::lock_guard<std::mutex> guard(mutex_);
+        ObjectUseData *use_data = nullptr;
+        if (!free_.empty() && free_.back()->GetCount().GetReadCount() == 0 && free_.back()->GetCount().GetWriteCount() == 0) {
+            use_data = free_.back();
+            free_.pop_back();
+        } else {
+            if (chunk_used_ == kChunkSize) {
+                chunks_.emplace_back(new ObjectUseData[kChunkSize]);
+                chunk_used_ = 0;
+            }
+            use_data = &chunks_.back()[chunk_used_++];
+        }
+        use_data->Reset();
+        return use_data;
+    }
+
+    void Release(ObjectUseData *use_data) {
+        std::lock_guard<std::mutex> guard(mutex_);
+        free_.push_back(use_data);
+    }
+
+  private:
+    static constexpr size_t kChunkSize = 64;
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<ObjectUseData[]>> chunks_;
+    size_t chunk_used_ = kChunkSize;
+    std::vector<ObjectUseData *> free_;
+};
+
 template <typename T>
 class counter {
   public:
@@ -98,19 +141,33 @@ class counter {
     VulkanObjectType object_type;
     ValidationObject *object_data;
 
-    vl_concurrent_unordered_map<T, std::shared_ptr<ObjectUseData>, 6> object_table;
+    // Every Start/Finish pair looks the object up, so the table is wait-free for readers and maps straight to the use
+    // data: the counter update is then a single atomic RMW, with no map bucket lock or shared_ptr reference counting.
+    vl_concurrent_lockfree_map<uint64_t, ObjectUseData *> object_table;
+    ObjectUseDataPool use_data_pool;
 
-    void CreateObject(T object) { object_table.insert(object, std::make_shared<ObjectUseData>()); }
+    void CreateObject(T object) {
+        if (object == VK_NULL_HANDLE) {
+            return;
+        }
+        ObjectUseData *use_data = use_data_pool.Acquire();
+        if (!object_table.insert(CastToUint64(object), use_data)) {
+            use_data_pool.Release(use_data);
+        }
+    }
 
     void DestroyObject(T object) {
         if (object) {
-            object_table.erase(object);
+            auto iter = object_table.pop(CastToUint64(object));
+            if (iter != object_table.end()) {
+                use_data_pool.Release(iter->second);
+            }
         }
     }
 
-    std::shared_ptr<ObjectUseData> FindObject(T object) {
-        assert(object_table.contains(object));
-        auto iter = object_table.find(object);
+    ObjectUseData *FindObject(T object) {
+        auto iter = object_table.find(CastToUint64(object));
+        assert(iter != object_table.end());
         if (iter != object_table.end()) {
             return iter->second;
         } else {
@@ -137,7 +194,7 @@ class counter {
 
         if (prevCount.GetReadCount() == 0 && prevCount.GetWriteCount() == 0) {
             // There is no current use of the object.  Record writer thread.
-            use_data->thread = tid;
+            use_data->thread.store(tid, std::memory_order_relaxed);
         } else {
             if (prevCount.GetReadCount() == 0) {
                 assert(prevCount.GetWriteCount() != 0);
@@ -213,7 +270,7 @@ class counter {
 
         if (prevCount.GetReadCount() == 0 && prevCount.GetWriteCount() == 0) {
             // There is no current use of the object.
-            use_data->thread = tid;
+            use_data->thread.store(tid, std::memory_order_relaxed);
         } else if (prevCount.GetWriteCount() > 0 && use_data->thread != tid) {
             // There is a writer of the object.
             std::stringstream err_str;
@@ -258,7 +315,8 @@ class ThreadSafety : public ValidationObject {
     ReadLockGuard ReadLock() const override;
     WriteLockGuard WriteLock() override;
 
-    vl_concurrent_unordered_map<VkCommandBuffer, VkCommandPool, 6> command_pool_map;
+    // Looked up on every command buffer access, keyed by CastToUint64(VkCommandBuffer)
+    vl_concurrent_lockfree_map<uint64_t, VkCommandPool> command_pool_map;
     vvl::unordered_map<VkCommandPool, vvl::unordered_set<VkCommandBuffer>> pool_command_buffers_map;
     vvl::unordered_map<VkDevice, vvl::unordered_set<VkQueue>> device_queues_map;
 
@@ -359,7 +417,7 @@ class ThreadSafety : public ValidationObject {
     // VkCommandBuffer needs check for implicit use of command pool
     void StartWriteObject(VkCommandBuffer object, const char *api_name, bool lockPool = true) {
         if (lockPool) {
-            auto iter = command_pool_map.find(object);
+            auto iter = command_pool_map.find(CastToUint64(object));
             if (iter != command_pool_map.end()) {
                 VkCommandPool pool = iter->second;
                 StartWriteObject(pool, api_name);
@@ -370,7 +428,7 @@ class ThreadSafety : public ValidationObject {
     void FinishWriteObject(VkCommandBuffer object, const char *api_name, bool lockPool = true) {
         c_VkCommandBuffer.FinishWrite(object, api_name);
         if (lockPool) {
-            auto iter = command_pool_map.find(object);
+            auto iter = command_pool_map.find(CastToUint64(object));
             if (iter != command_pool_map.end()) {
                 VkCommandPool pool = iter->second;
                 FinishWriteObject(pool, api_name);
@@ -378,7 +436,7 @@ class ThreadSafety : public ValidationObject {
         }
     }
     void StartReadObject(VkCommandBuffer object, const char *api_name) {
-        auto iter = command_pool_map.find(object);
+        auto iter = command_pool_map.find(CastToUint64(object));
         if (iter != command_pool_map.end()) {
             VkCommandPool pool = iter->second;
             // We set up a read guard against the "Contents" counter to catch conflict vs. vkResetCommandPool and
@@ -390,7 +448,7 @@ class ThreadSafety : public ValidationObject {
     }
     void FinishReadObject(VkCommandBuffer object, const char *api_name) {
         c_VkCommandBuffer.FinishRead(object, api_name);
-        auto iter = command_pool_map.find(object);
+        auto iter = command_pool_map.find(CastToUint64(object));
         if (iter != command_pool_map.end()) {
             VkCommandPool pool = iter->second;
             c_VkCommandPoolContents.FinishRead(pool, api_name);
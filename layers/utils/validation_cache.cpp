@@ -0,0 +1,270 @@
+/* Copyright (c) 2015-2023 The Khronos Group Inc.
+ * Copyright (c) 2015-2023 Valve Corporation
+ * Copyright (c) 2015-2023 LunarG, Inc.
+ * Copyright (C) 2015-2023 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "validation_cache.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <utility>
+
+#include "external/xxhash.h"
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+// The temporary file is per process, other processes may be compacting the same cache
+static std::string TemporaryPath(const std::string &path) {
+#if defined(_WIN32)
+    return path + "." + std::to_string(GetCurrentProcessId()) + ".tmp";
+#else
+    return path + "." + std::to_string(getpid()) + ".tmp";
+#endif
+}
+
+// Replaces to with from in one step, anything reading to sees either the old or the new file
+static bool RenameOver(const std::string &from, const std::string &to) {
+#if defined(_WIN32)
+    return MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+    return std::rename(from.c_str(), to.c_str()) == 0;
+#endif
+}
+
+uint64_t ValidationCache::MakeShaderHash(VkShaderModuleCreateInfo const *smci, uint32_t options_key) {
+    // Only XXH32 is built (XXH_NO_LONG_LONG), two seeds give a 64 bit hash
+    const uint64_t low = XXH32(smci->pCode, smci->codeSize, options_key);
+    const uint64_t high = XXH32(smci->pCode, smci->codeSize, ~options_key);
+    return (high << 32) | low;
+}
+
+void ValidationCache::WriteHeader(uint8_t *out) const {
+    const uint32_t header[2] = {static_cast<uint32_t>(kHeaderSize), VK_VALIDATION_CACHE_HEADER_VERSION_ONE_EXT};
+    std::memcpy(out, header, sizeof(header));
+    out += sizeof(header);
+    Sha1ToVkUuid(SPIRV_TOOLS_COMMIT_ID, out);
+    out += VK_UUID_SIZE;
+    const uint32_t format[2] = {kEntryFormat, 0};
+    std::memcpy(out, format, sizeof(format));
+}
+
+bool ValidationCache::IsHeaderValid(const uint8_t *data, size_t data_size) const {
+    if (!data || data_size < kHeaderSize) return false;
+    uint8_t expected_header[kHeaderSize];
+    WriteHeader(expected_header);
+    // Different header size, version, SPIRV-Tools (UUID) or entry format
+    return std::memcmp(data, expected_header, kHeaderSize) == 0;
+}
+
+void ValidationCache::Load(const void *data, size_t data_size) {
+    const uint8_t *bytes = static_cast<const uint8_t *>(data);
+    if (!IsHeaderValid(bytes, data_size)) return;
+
+    auto guard = WriteLock();
+    // Written from the least to the most recently used. A partial entry at the end is a write that did not finish.
+    for (size_t offset = kHeaderSize; offset + sizeof(uint64_t) <= data_size; offset += sizeof(uint64_t)) {
+        uint64_t hash;
+        std::memcpy(&hash, bytes + offset, sizeof(hash));
+        const uint64_t tick = NextTick();
+        const auto it = entries_.find(hash);
+        if (it != entries_.end()) {
+            it->second.last_used.store(tick, std::memory_order_relaxed);
+        } else {
+            entries_.emplace(hash, Entry(tick));
+        }
+    }
+    if (max_entries_ != 0) {
+        EvictLocked(max_entries_);
+    }
+}
+
+void ValidationCache::Write(size_t *pDataSize, void *pData) {
+    auto guard = ReadLock();
+    if (!pData) {
+        *pDataSize = kHeaderSize + entries_.size() * sizeof(uint64_t);
+        return;
+    }
+
+    if (*pDataSize < kHeaderSize) {
+        *pDataSize = 0;
+        return;  // Too small for even the header!
+    }
+
+    uint8_t *out = static_cast<uint8_t *>(pData);
+    WriteHeader(out);
+    // Least recently used first, the order Load() expects. If it does not all fit, keep the most recently used.
+    const auto hashes = SortedLocked();
+    const size_t count = std::min(hashes.size(), (*pDataSize - kHeaderSize) / sizeof(uint64_t));
+    std::memcpy(out + kHeaderSize, hashes.data() + (hashes.size() - count), count * sizeof(uint64_t));
+
+    *pDataSize = kHeaderSize + count * sizeof(uint64_t);
+}
+
+void ValidationCache::InsertLocked(uint64_t hash) {
+    const uint64_t tick = NextTick();
+    const auto it = entries_.find(hash);
+    if (it != entries_.end()) {
+        it->second.last_used.store(tick, std::memory_order_relaxed);
+        return;
+    }
+    entries_.emplace(hash, Entry(tick));
+    if (max_entries_ != 0 && entries_.size() > max_entries_) {
+        // Finding the least recently used is a pass over every hash, so an eighth of them are evicted at once
+        EvictLocked(max_entries_ - max_entries_ / 8);
+    }
+    if (append_file_.is_open()) {
+        append_file_.write(reinterpret_cast<const char *>(&hash), sizeof(hash));
+        append_file_.flush();
+        if (!append_file_) {
+            // Disk full or similar, stop appending. Compact() still rewrites the file, and a partial entry left at the end is
+            // cut off by the next CreatePersistent().
+            append_file_.close();
+        }
+    }
+}
+
+void ValidationCache::EvictLocked(size_t keep) {
+    if (entries_.size() <= keep) return;
+
+    std::vector<std::pair<uint64_t, uint64_t>> by_use;  // <last used, hash>
+    by_use.reserve(entries_.size());
+    for (const auto &entry : entries_) {
+        by_use.emplace_back(entry.second.last_used.load(std::memory_order_relaxed), entry.first);
+    }
+    const size_t evict_count = entries_.size() - keep;
+    std::nth_element(by_use.begin(), by_use.begin() + evict_count, by_use.end());
+    for (size_t i = 0; i < evict_count; ++i) {
+        entries_.erase(by_use[i].second);
+    }
+}
+
+std::vector<uint64_t> ValidationCache::SortedLocked() const {
+    std::vector<std::pair<uint64_t, uint64_t>> by_use;  // <last used, hash>
+    by_use.reserve(entries_.size());
+    for (const auto &entry : entries_) {
+        by_use.emplace_back(entry.second.last_used.load(std::memory_order_relaxed), entry.first);
+    }
+    std::sort(by_use.begin(), by_use.end());
+
+    std::vector<uint64_t> hashes;
+    hashes.reserve(by_use.size());
+    for (const auto &use : by_use) {
+        hashes.push_back(use.second);
+    }
+    return hashes;
+}
+
+bool ValidationCache::WriteFileLocked(std::string &error) {
+    const auto hashes = SortedLocked();
+    const std::string temp_path = TemporaryPath(path_);
+    {
+        std::ofstream file(temp_path, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!file) {
+            error = "cannot open " + temp_path + " for writing";
+            return false;
+        }
+        uint8_t header[kHeaderSize];
+        WriteHeader(header);
+        file.write(reinterpret_cast<const char *>(header), sizeof(header));
+        file.write(reinterpret_cast<const char *>(hashes.data()),
+                   static_cast<std::streamsize>(hashes.size() * sizeof(uint64_t)));
+        file.close();
+        if (!file) {
+            error = "cannot write " + temp_path;
+            std::remove(temp_path.c_str());
+            return false;
+        }
+    }
+    if (!RenameOver(temp_path, path_)) {
+        error = "cannot replace " + path_ + " with " + temp_path;
+        std::remove(temp_path.c_str());
+        return false;
+    }
+    return true;
+}
+
+VkValidationCacheEXT ValidationCache::CreatePersistent(const std::string &path, size_t max_entries, std::string &error) {
+    auto cache = new ValidationCache();
+    cache->max_entries_ = max_entries;
+    cache->path_ = path;
+
+    bool valid_file = false;
+    bool partial_entry = false;
+    {
+        ReadOnlyMappedFile mapped(path.c_str());
+        valid_file = cache->IsHeaderValid(mapped.data(), mapped.size());
+        if (valid_file) {
+            cache->Load(mapped.data(), mapped.size());
+            partial_entry = (mapped.size() - kHeaderSize) % sizeof(uint64_t) != 0;
+        }
+    }
+    if (partial_entry) {
+        // A write that did not finish, appending after it would misalign every hash that follows. Cut it off first.
+        auto guard = cache->WriteLock();
+        std::string rewrite_error;
+        valid_file = cache->WriteFileLocked(rewrite_error);
+    }
+
+    if (valid_file) {
+        cache->append_file_.open(path, std::ios::out | std::ios::binary | std::ios::app);
+    } else {
+        // Missing, or written by another version, start over
+        cache->append_file_.open(path, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (cache->append_file_) {
+            uint8_t header[kHeaderSize];
+            cache->WriteHeader(header);
+            cache->append_file_.write(reinterpret_cast<const char *>(header), sizeof(header));
+            cache->append_file_.flush();
+        }
+    }
+    if (!cache->append_file_) {
+        error = "cannot open " + path + " for writing";
+        cache->append_file_.close();
+    }
+    return VkValidationCacheEXT(cache);
+}
+
+bool ValidationCache::Compact(std::string &error) {
+    if (path_.empty()) return true;
+
+    auto guard = WriteLock();
+    append_file_.close();
+    {
+        // Other devices or processes append to the same file, keep what they added since it was loaded. The hashes only in the
+        // file count as older than any used here, so they are the first to be evicted.
+        ReadOnlyMappedFile mapped(path_.c_str());
+        if (IsHeaderValid(mapped.data(), mapped.size())) {
+            for (size_t offset = kHeaderSize; offset + sizeof(uint64_t) <= mapped.size(); offset += sizeof(uint64_t)) {
+                uint64_t hash;
+                std::memcpy(&hash, mapped.data() + offset, sizeof(hash));
+                if (entries_.find(hash) == entries_.end()) {
+                    entries_.emplace(hash, Entry(0));
+                }
+            }
+        }
+    }
+    if (max_entries_ != 0) {
+        EvictLocked(max_entries_);
+    }
+    return WriteFileLocked(error);
+}
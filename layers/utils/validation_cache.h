@@ -0,0 +1,151 @@
+/* Copyright (c) 2015-2023 The Khronos Group Inc.
+ * Copyright (c) 2015-2023 Valve Corporation
+ * Copyright (c) 2015-2023 LunarG, Inc.
+ * Copyright (C) 2015-2023 Google Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * VkValidationCacheEXT, the hashes of shaders that already passed spirv-val
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "vulkan/vulkan.h"
+#include <generated/spirv_tools_commit_id.h>
+#include "containers/custom_containers.h"
+#include "utils/vk_layer_utils.h"
+
+class ValidationCache {
+  public:
+    static VkValidationCacheEXT Create(VkValidationCacheCreateInfoEXT const *pCreateInfo) {
+        auto cache = new ValidationCache();
+        cache->Load(pCreateInfo->pInitialData, pCreateInfo->initialDataSize);
+        return VkValidationCacheEXT(cache);
+    }
+
+    // The cache CoreChecks uses when the app does not give one, kept in a file between runs.
+    // Inserted hashes are appended to the file right away so a crash does not lose them, Compact() rewrites it without the
+    // evicted ones. Once max_entries are held, the least recently used hashes are evicted.
+    static VkValidationCacheEXT CreatePersistent(const std::string &path, size_t max_entries, std::string &error);
+
+    // Number of hashes the persistent cache holds before evicting, each one is 8 bytes in the file
+    static constexpr size_t kDefaultMaxEntries = 256 * 1024;
+
+    void Load(const void *data, size_t data_size);
+    void Write(size_t *pDataSize, void *pData);
+    bool Compact(std::string &error);
+
+    void Merge(ValidationCache const *other) {
+        // self-merging is invalid, but avoid deadlock below just in case.
+        if (other == this) {
+            return;
+        }
+        auto other_guard = other->ReadLock();
+        auto guard = WriteLock();
+        // oldest first, so the most recently used of other stay the most recently used here
+        for (const uint64_t hash : other->SortedLocked()) {
+            InsertLocked(hash);
+        }
+    }
+
+    // options_key identifies the spirv-val options (see ValidatorOptionsKey()), a shader is only known to be valid for the
+    // options it was validated with
+    static uint64_t MakeShaderHash(VkShaderModuleCreateInfo const *smci, uint32_t options_key);
+
+    bool Contains(uint64_t hash) const {
+        // Every shader module created looks up the cache, so only a read lock is taken. Marking the hash as the most recently
+        // used is a store to its own atomic, the eviction order is only worked out when something has to be evicted.
+        auto guard = ReadLock();
+        const auto it = entries_.find(hash);
+        if (it == entries_.end()) return false;
+        it->second.last_used.store(NextTick(), std::memory_order_relaxed);
+        return true;
+    }
+
+    void Insert(uint64_t hash) {
+        auto guard = WriteLock();
+        InsertLocked(hash);
+    }
+
+  private:
+    ValidationCache() {}
+    ReadLockGuard ReadLock() const { return ReadLockGuard(lock_); }
+    WriteLockGuard WriteLock() { return WriteLockGuard(lock_); }
+
+    // 4 bytes for header size + 4 bytes for version number + UUID + 4 bytes for the entry format + 4 bytes padding so the
+    // uint64_t hashes that follow are aligned
+    static constexpr size_t kHeaderSize = 2 * sizeof(uint32_t) + VK_UUID_SIZE + 2 * sizeof(uint32_t);
+    // Format 1 had 32 bit hashes and a smaller header
+    static constexpr uint32_t kEntryFormat = 2;
+
+    // Last use of a hash, Contains() updates it under the read lock. Only copied (rehash, erase) under the write lock.
+    struct Entry {
+        explicit Entry(uint64_t tick) : last_used(tick) {}
+        Entry(const Entry &other) noexcept : last_used(other.last_used.load(std::memory_order_relaxed)) {}
+        Entry &operator=(const Entry &other) noexcept {
+            last_used.store(other.last_used.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            return *this;
+        }
+        mutable std::atomic<uint64_t> last_used;
+    };
+
+    uint64_t NextTick() const { return clock_.fetch_add(1, std::memory_order_relaxed) + 1; }
+
+    void WriteHeader(uint8_t *out) const;
+    bool IsHeaderValid(const uint8_t *data, size_t data_size) const;
+    void InsertLocked(uint64_t hash);
+    // Evicts the least recently used hashes until at most keep are left
+    void EvictLocked(size_t keep);
+    // The hashes from the least to the most recently used
+    std::vector<uint64_t> SortedLocked() const;
+    // Replaces the file with the header and SortedLocked(), through a temporary file so it is never left half written
+    bool WriteFileLocked(std::string &error);
+
+    void Sha1ToVkUuid(const char *sha1_str, uint8_t *uuid) const {
+        // Convert sha1_str from a hex string to binary. We only need VK_UUID_SIZE bytes of
+        // output, so pad with zeroes if the input string is shorter than that, and truncate
+        // if it's longer.
+#if defined(__GNUC__) && (__GNUC__ > 8)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstringop-truncation"
+#endif
+        char padded_sha1_str[2 * VK_UUID_SIZE + 1] = {};  // 2 hex digits == 1 byte
+        std::strncpy(padded_sha1_str, sha1_str, 2 * VK_UUID_SIZE);
+#if defined(__GNUC__) && (__GNUC__ > 8)
+#pragma GCC diagnostic pop
+#endif
+        for (uint32_t i = 0; i < VK_UUID_SIZE; ++i) {
+            const char byte_str[] = {padded_sha1_str[2 * i + 0], padded_sha1_str[2 * i + 1], '\0'};
+            uuid[i] = static_cast<uint8_t>(std::strtoul(byte_str, nullptr, 16));
+        }
+    }
+
+    // hashes of shaders that have passed validation before, and can be skipped.
+    // we don't store negative results, as we would have to also store what was
+    // wrong with them; also, we expect they will get fixed, so we're less
+    // likely to see them again.
+    vvl::unordered_map<uint64_t, Entry> entries_;
+    mutable std::atomic<uint64_t> clock_{0};  // ticks for Entry::last_used, 0 is older than any use
+    size_t max_entries_ = 0;                  // 0 is unbounded
+    // Only for the persistent cache
+    std::string path_;
+    std::ofstream append_file_;
+    mutable std::shared_mutex lock_;
+};
@@ -18,11 +18,27 @@
 #include "vk_layer_utils.h"
 
 #include <string.h>
+#include <cstdlib>
+#include <iostream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "vulkan/vulkan.h"
 #include "vk_layer_config.h"
+#include "error_message/binary_log.h"
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 static const uint8_t kUtF8OneByteCode = 0xC0;
 static const uint8_t kUtF8OneByteMask = 0xE0;
@@ -93,9 +109,13 @@ void layer_debug_messenger_actions(debug_report_data *report_data, const char *l
     std::string report_flags_key = layer_identifier;
     std::string debug_action_key = layer_identifier;
     std::string log_filename_key = layer_identifier;
+    std::string log_binary_filename_key = layer_identifier;
+    std::string log_binary_size_key = layer_identifier;
     report_flags_key.append(".report_flags");
     debug_action_key.append(".debug_action");
     log_filename_key.append(".log_filename");
+    log_binary_filename_key.append(".log_binary_filename");
+    log_binary_size_key.append(".log_binary_size");
 
     const vvl::unordered_map<std::string, VkFlags> debug_actions_option_definitions = {
         {std::string("VK_DBG_LAYER_ACTION_IGNORE"), VK_DBG_LAYER_ACTION_IGNORE},
@@ -103,6 +123,7 @@ void layer_debug_messenger_actions(debug_report_data *report_data, const char *l
         {std::string("VK_DBG_LAYER_ACTION_LOG_MSG"), VK_DBG_LAYER_ACTION_LOG_MSG},
         {std::string("VK_DBG_LAYER_ACTION_BREAK"), VK_DBG_LAYER_ACTION_BREAK},
         {std::string("VK_DBG_LAYER_ACTION_DEBUG_OUTPUT"), VK_DBG_LAYER_ACTION_DEBUG_OUTPUT},
+        {std::string("VK_DBG_LAYER_ACTION_LOG_BINARY"), VK_DBG_LAYER_ACTION_LOG_BINARY},
         {std::string("VK_DBG_LAYER_ACTION_DEFAULT"), VK_DBG_LAYER_ACTION_DEFAULT}};
 
     const vvl::unordered_map<std::string, VkFlags> log_msg_type_option_definitions = {{std::string("warn"), kWarningBit},
@@ -136,6 +157,26 @@ void layer_debug_messenger_actions(debug_report_data *report_data, const char *l
         dbg_create_info.messageSeverity |= VK_DEBUG_UTILS_MESSAGE_SEVERITY_VERBOSE_BIT_EXT;
     }
 
+    if (debug_action & VK_DBG_LAYER_ACTION_LOG_BINARY) {
+        std::string log_binary_filename = getLayerOption(log_binary_filename_key.c_str());
+        if (log_binary_filename.empty()) {
+            log_binary_filename = "vvl_messages.bin";
+        }
+        // Size in megabytes
+        const std::string log_binary_size = getLayerOption(log_binary_size_key.c_str());
+        const uint64_t size_mb = log_binary_size.empty() ? 64 : std::strtoull(log_binary_size.c_str(), nullptr, 10);
+        std::string error;
+        report_data->binary_log =
+            BinaryMessageLog::Create(log_binary_filename.c_str(), size_mb * 1024 * 1024, report_flags, error);
+        if (report_data->binary_log) {
+            // The binary log replaces the text log, formatting every message is what it exists to avoid
+            debug_action &= ~VK_DBG_LAYER_ACTION_LOG_MSG;
+        } else {
+            std::cout << layer_identifier << " ERROR: Cannot use " << log_binary_filename << " as binary log, " << error
+                      << ". Logging text instead" << std::endl;
+        }
+    }
+
     if (debug_action & VK_DBG_LAYER_ACTION_LOG_MSG) {
         const char *log_filename = getLayerOption(log_filename_key.c_str());
         FILE *log_output = getLayerLogOutput(log_filename, layer_identifier);
@@ -178,3 +219,92 @@ VkLayerDeviceCreateInfo *get_chain_info(const VkDeviceCreateInfo *pCreateInfo, V
     assert(chain_info != NULL);
     return chain_info;
 }
+
+void ReadEpochDomain::Synchronize() {
+    std::lock_guard<std::mutex> guard(synchronize_mutex_);
+    // Two flips: a reader may have sampled the parity just before the first flip and only registered after it,
+    // so it is counted under the parity that was current when the flip happened.
+    for (int phase = 0; phase < 2; ++phase) {
+        const uint32_t old_parity = epoch_.load();
+        epoch_.store(old_parity ^ 1);
+        for (auto &reader : readers_[old_parity]) {
+            while (reader.count.load() != 0) {
+                std::this_thread::yield();
+            }
+        }
+    }
+}
+
+bool ReadEpochDomain::TryFlip() {
+    std::lock_guard<std::mutex> guard(synchronize_mutex_);
+    const uint32_t parity = epoch_.load();
+    for (const auto &reader : readers_[parity ^ 1]) {
+        if (reader.count.load() != 0) {
+            return false;
+        }
+    }
+    epoch_.store(parity ^ 1);
+    return true;
+}
+
+ReadOnlyMappedFile::ReadOnlyMappedFile(const char *filename) {
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return;
+    }
+    file_handle_ = file;
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0) {
+        return;
+    }
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        return;
+    }
+    mapping_handle_ = mapping;
+    void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view) {
+        return;
+    }
+    size_ = static_cast<size_t>(file_size.QuadPart);
+#else
+    const int fd = open(filename, O_RDONLY);
+    if (fd < 0) {
+        return;
+    }
+    fd_ = fd;
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+        return;
+    }
+    void *view = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    if (view == MAP_FAILED) {
+        return;
+    }
+    size_ = static_cast<size_t>(info.st_size);
+#endif
+    data_ = static_cast<const uint8_t *>(view);
+}
+
+ReadOnlyMappedFile::~ReadOnlyMappedFile() {
+#if defined(_WIN32)
+    if (data_) {
+        UnmapViewOfFile(data_);
+    }
+    if (mapping_handle_) {
+        CloseHandle(mapping_handle_);
+    }
+    if (file_handle_) {
+        CloseHandle(file_handle_);
+    }
+#else
+    if (data_) {
+        munmap(const_cast<uint8_t *>(data_), size_);
+    }
+    if (fd_ >= 0) {
+        close(fd_);
+    }
+#endif
+}
@@ -560,7 +560,11 @@ bool white_list(const char *item, const std::set<std::string> &whitelist);
 #endif
 
 #ifdef __cplusplus
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <shared_mutex>
+#include <type_traits>
 
 // Aliases to avoid excessive typing. We can't easily auto these away because
 // there are virtual methods in ValidationObject which return lock guards
@@ -753,6 +757,425 @@ class vl_concurrent_unordered_map {
     }
 };
 
+// Reader tracking for vl_concurrent_lockfree_map.
+//
+// Readers never block: they bump a counter on a cache line that is (mostly) private to their thread, so lookups from
+// many threads don't bounce a shared lock word between cores. A writer that retires a table calls Synchronize(), which
+// flips the epoch parity twice and waits for the readers counted under the old parity to leave. After it returns no
+// reader can still be looking at memory that was unpublished before the call.
+class ReadEpochDomain {
+  public:
+    static ReadEpochDomain &Get() {
+        static ReadEpochDomain domain;
+        return domain;
+    }
+
+    // Returns a ticket that must be passed to Leave()
+    uint32_t Enter() {
+        const uint32_t stripe = ThreadStripe();
+        const uint32_t parity = epoch_.load();
+        readers_[parity][stripe].count.fetch_add(1);
+        return parity * kStripes + stripe;
+    }
+    void Leave(uint32_t ticket) { readers_[ticket / kStripes][ticket % kStripes].count.fetch_sub(1, std::memory_order_release); }
+
+    void Synchronize();
+    // Non-blocking step of Synchronize(), for writers that must not wait on their readers. Flips the parity if no reader is
+    // counted under the other one. Memory unpublished before a call is unreachable once two flips have happened since.
+    bool TryFlip();
+
+  private:
+    static constexpr uint32_t kStripes = 32;
+    static uint32_t ThreadStripe() {
+        static std::atomic<uint32_t> next_stripe{0};
+        thread_local const uint32_t stripe = next_stripe.fetch_add(1, std::memory_order_relaxed) % kStripes;
+        return stripe;
+    }
+
+    struct alignas(get_hardware_destructive_interference_size()) ReaderCount {
+        std::atomic<uint32_t> count{0};
+    };
+    std::atomic<uint32_t> epoch_{0};
+    ReaderCount readers_[2][kStripes];
+    std::mutex synchronize_mutex_;
+};
+
+// Frees objects unpublished from a structure with lock-free readers, without ever waiting on the readers. For readers
+// that keep what they found for a long time, e.g. across an application callback that may itself call the writer.
+// Readers hold an Enter()/Leave() ticket while they use anything they looked up. Writers call Retire() once the object
+// can't be found anymore, serialized by their own lock. Retired objects are freed by a later Retire() after two flips of
+// the reader epoch, or when the reclaimer is destroyed.
+template <typename T>
+class vl_deferred_reclaimer {
+  public:
+    uint32_t Enter() const { return domain_.Enter(); }
+    void Leave(uint32_t ticket) const { domain_.Leave(ticket); }
+
+    void Retire(std::unique_ptr<T> &&object) {
+        pending_.emplace_back(std::move(object));
+        if (domain_.TryFlip()) {
+            draining_.swap(pending_);
+            pending_.clear();
+        }
+    }
+
+  private:
+    mutable ReadEpochDomain domain_;
+    std::vector<std::unique_ptr<T>> pending_;   // retired since the last flip
+    std::vector<std::unique_ptr<T>> draining_;  // retired before the last flip, freed by the next one
+};
+
+// Concurrent map with wait-free lookups, intended for the handle tables that are read on every API call
+// (e.g. unique_id_mapping). It supports the same operations as vl_concurrent_unordered_map.
+//
+// The table is open-addressed with linear probing and every slot is a pair of 64-bit atomics, so a lookup is a
+// handful of loads with no lock taken. insert/erase are serialized by a single mutex. Erased slots become tombstones
+// that are only reclaimed by a rehash, so a slot's key never changes from one live key to another while a reader may
+// be probing it. Tables replaced by a rehash are freed once ReadEpochDomain says no reader can still see them.
+//
+// Restrictions: Key must be a 64-bit integer, and the values 0 and ~0 are reserved: they are never found, and inserting
+// them fails. T must be trivially copyable and fit in 64 bits.
+template <typename Key, typename T, typename Hash = vvl::hash<Key>>
+class vl_concurrent_lockfree_map {
+    static_assert(std::is_integral<Key>::value && sizeof(Key) == sizeof(uint64_t), "Keys are stored as 64-bit atomics");
+    static_assert(std::is_trivially_copyable<T>::value && sizeof(T) <= sizeof(uint64_t), "Values are stored as 64-bit atomics");
+
+  public:
+    vl_concurrent_lockfree_map() : table_(new Table(kMinCapacity)) {}
+    ~vl_concurrent_lockfree_map() { delete table_.load(); }
+    vl_concurrent_lockfree_map(const vl_concurrent_lockfree_map &) = delete;
+    vl_concurrent_lockfree_map &operator=(const vl_concurrent_lockfree_map &) = delete;
+
+    template <typename... Args>
+    void insert_or_assign(const Key &key, Args &&...args) {
+        const T value{std::forward<Args>(args)...};
+        if (IsReserved(key)) {
+            return;
+        }
+        std::lock_guard<std::mutex> guard(write_mutex_);
+        Slot *slot = table_.load(std::memory_order_relaxed)->Find(ToKey(key));
+        if (slot) {
+            slot->value.store(Encode(value), std::memory_order_release);
+        } else {
+            InsertLocked(ToKey(key), value);
+        }
+    }
+
+    template <typename... Args>
+    bool insert(const Key &key, Args &&...args) {
+        const T value{std::forward<Args>(args)...};
+        if (IsReserved(key)) {
+            return false;
+        }
+        std::lock_guard<std::mutex> guard(write_mutex_);
+        if (table_.load(std::memory_order_relaxed)->Find(ToKey(key))) {
+            return false;
+        }
+        InsertLocked(ToKey(key), value);
+        return true;
+    }
+
+    // returns size_type
+    size_t erase(const Key &key) {
+        if (IsReserved(key)) {
+            return 0;
+        }
+        std::lock_guard<std::mutex> guard(write_mutex_);
+        Slot *slot = table_.load(std::memory_order_relaxed)->Find(ToKey(key));
+        if (!slot) {
+            return 0;
+        }
+        slot->key.store(kTombstoneKey, std::memory_order_release);
+        size_.fetch_sub(1, std::memory_order_relaxed);
+        return 1;
+    }
+
+    bool contains(const Key &key) const {
+        if (IsReserved(key)) {
+            return false;
+        }
+        ReadGuard guard(table_);
+        return guard.table->Find(ToKey(key)) != nullptr;
+    }
+
+    // type returned by find() and end().
+    class FindResult {
+      public:
+        FindResult(bool a, T b) : result(a, std::move(b)) {}
+
+        // == and != only support comparing against end()
+        bool operator==(const FindResult &other) const {
+            if (result.first == false && other.result.first == false) {
+                return true;
+            }
+            return false;
+        }
+        bool operator!=(const FindResult &other) const { return !(*this == other); }
+
+        // Make -> act kind of like an iterator.
+        std::pair<bool, T> *operator->() { return &result; }
+        const std::pair<bool, T> *operator->() const { return &result; }
+
+      private:
+        // (found, reference to element)
+        std::pair<bool, T> result;
+    };
+
+    // find()/end() return a FindResult containing a copy of the value. For end(),
+    // return a default value.
+    FindResult end() const { return FindResult(false, T()); }
+    FindResult cend() const { return end(); }
+
+    FindResult find(const Key &key) const {
+        if (IsReserved(key)) {
+            return end();
+        }
+        ReadGuard guard(table_);
+        const Slot *slot = guard.table->Find(ToKey(key));
+        if (slot) {
+            return FindResult(true, Decode(slot->value.load(std::memory_order_acquire)));
+        } else {
+            return end();
+        }
+    }
+
+    FindResult pop(const Key &key) {
+        if (IsReserved(key)) {
+            return end();
+        }
+        std::lock_guard<std::mutex> guard(write_mutex_);
+        Slot *slot = table_.load(std::memory_order_relaxed)->Find(ToKey(key));
+        if (!slot) {
+            return end();
+        }
+        auto ret = FindResult(true, Decode(slot->value.load(std::memory_order_relaxed)));
+        slot->key.store(kTombstoneKey, std::memory_order_release);
+        size_.fetch_sub(1, std::memory_order_relaxed);
+        return ret;
+    }
+
+    std::vector<std::pair<const Key, T>> snapshot(std::function<bool(T)> f = nullptr) const {
+        std::vector<std::pair<const Key, T>> ret;
+        std::lock_guard<std::mutex> guard(write_mutex_);
+        const Table *table = table_.load(std::memory_order_relaxed);
+        for (size_t i = 0; i <= table->mask; ++i) {
+            const uint64_t key = table->slots[i].key.load(std::memory_order_relaxed);
+            if (key != kEmptyKey && key != kTombstoneKey) {
+                const T value = Decode(table->slots[i].value.load(std::memory_order_relaxed));
+                if (!f || f(value)) {
+                    ret.emplace_back(static_cast<Key>(key), value);
+                }
+            }
+        }
+        return ret;
+    }
+
+    void clear() {
+        std::lock_guard<std::mutex> guard(write_mutex_);
+        Retire(new Table(kMinCapacity));
+        size_.store(0, std::memory_order_relaxed);
+    }
+
+    size_t size() const { return size_.load(std::memory_order_relaxed); }
+
+    bool empty() const { return size() == 0; }
+
+  private:
+    static constexpr uint64_t kEmptyKey = 0;
+    static constexpr uint64_t kTombstoneKey = ~uint64_t(0);
+    static constexpr size_t kMinCapacity = 64;
+
+    struct Slot {
+        std::atomic<uint64_t> key{kEmptyKey};
+        std::atomic<uint64_t> value{0};
+    };
+
+    struct Table {
+        explicit Table(size_t capacity) : mask(capacity - 1), shift(64 - Log2(capacity)), slots(new Slot[capacity]) {}
+
+        static uint32_t Log2(size_t capacity) {
+            uint32_t log2 = 0;
+            while ((size_t(1) << log2) < capacity) ++log2;
+            return log2;
+        }
+
+        // Fibonacci hashing spreads hashes that only vary in a few bits (e.g. HashedUint64) across the whole table
+        size_t Index(uint64_t key) const {
+            const uint64_t h = static_cast<uint64_t>(Hash()(static_cast<Key>(key)));
+            return static_cast<size_t>((h * 0x9E3779B97F4A7C15ull) >> shift);
+        }
+
+        Slot *Find(uint64_t key) const {
+            for (size_t i = Index(key);; i = (i + 1) & mask) {
+                const uint64_t slot_key = slots[i].key.load(std::memory_order_acquire);
+                if (slot_key == key) return &slots[i];
+                if (slot_key == kEmptyKey) return nullptr;
+            }
+        }
+
+        // Only called by the writer, with the key known to be absent
+        void Insert(uint64_t key, uint64_t value) {
+            size_t i = Index(key);
+            while (slots[i].key.load(std::memory_order_relaxed) != kEmptyKey) {
+                i = (i + 1) & mask;
+            }
+            slots[i].value.store(value, std::memory_order_relaxed);
+            slots[i].key.store(key, std::memory_order_release);
+            ++used;
+        }
+
+        const size_t mask;
+        const uint32_t shift;
+        std::unique_ptr<Slot[]> slots;
+        size_t used = 0;  // live and tombstoned slots, only accessed by the writer
+    };
+
+    class ReadGuard {
+      public:
+        explicit ReadGuard(const std::atomic<Table *> &current) : ticket_(ReadEpochDomain::Get().Enter()), table(current.load()) {}
+        ~ReadGuard() { ReadEpochDomain::Get().Leave(ticket_); }
+
+      private:
+        const uint32_t ticket_;
+
+      public:
+        const Table *const table;
+    };
+
+    // A null handle (e.g. vkDestroyBuffer(device, VK_NULL_HANDLE)) is a legal lookup, so reserved keys are filtered out
+    // before they can be confused with empty or erased slots
+    static bool IsReserved(const Key &key) {
+        const uint64_t k = static_cast<uint64_t>(key);
+        return k == kEmptyKey || k == kTombstoneKey;
+    }
+    static uint64_t ToKey(const Key &key) {
+        const uint64_t k = static_cast<uint64_t>(key);
+        assert(k != kEmptyKey && k != kTombstoneKey);
+        return k;
+    }
+    static uint64_t Encode(const T &value) {
+        uint64_t encoded = 0;
+        std::memcpy(&encoded, &value, sizeof(T));
+        return encoded;
+    }
+    static T Decode(uint64_t encoded) {
+        T value;
+        std::memcpy(&value, &encoded, sizeof(T));
+        return value;
+    }
+
+    void InsertLocked(uint64_t key, const T &value) {
+        Table *table = table_.load(std::memory_order_relaxed);
+        const size_t live = size_.load(std::memory_order_relaxed) + 1;
+        if ((table->used + 1) * 4 > (table->mask + 1) * 3) {
+            // Rehash, dropping the tombstones, so the new table is at most half full
+            size_t capacity = kMinCapacity;
+            while (capacity < live * 2) capacity *= 2;
+            Table *grown = new Table(capacity);
+            for (size_t i = 0; i <= table->mask; ++i) {
+                const uint64_t slot_key = table->slots[i].key.load(std::memory_order_relaxed);
+                if (slot_key != kEmptyKey && slot_key != kTombstoneKey) {
+                    grown->Insert(slot_key, table->slots[i].value.load(std::memory_order_relaxed));
+                }
+            }
+            Retire(grown);
+            table = grown;
+        }
+        table->Insert(key, Encode(value));
+        size_.store(live, std::memory_order_relaxed);
+    }
+
+    void Retire(Table *replacement) {
+        Table *old = table_.exchange(replacement);
+        ReadEpochDomain::Get().Synchronize();
+        delete old;
+    }
+
+    std::atomic<Table *> table_;
+    std::atomic<size_t> size_{0};
+    mutable std::mutex write_mutex_;
+};
+
+// vl_concurrent_unordered_map paired with a vl_concurrent_lockfree_map index of its keys. For tables whose hot path
+// is an existence check (e.g. ObjectLifetimes handle validation) but whose values can't be read without a lock
+// (e.g. std::shared_ptr). contains() is wait-free, everything else goes through the locked map.
+template <typename Key, typename T, int BUCKETSLOG2 = 2, typename Hash = vvl::hash<Key>>
+class vl_concurrent_indexed_map {
+    using Map = vl_concurrent_unordered_map<Key, T, BUCKETSLOG2, Hash>;
+
+  public:
+    using FindResult = typename Map::FindResult;
+
+    template <typename... Args>
+    void insert_or_assign(const Key &key, Args &&...args) {
+        map_.insert_or_assign(key, std::forward<Args>(args)...);
+        keys_.insert_or_assign(key, true);
+    }
+
+    template <typename... Args>
+    bool insert(const Key &key, Args &&...args) {
+        const bool inserted = map_.insert(key, std::forward<Args>(args)...);
+        if (inserted) {
+            keys_.insert_or_assign(key, true);
+        }
+        return inserted;
+    }
+
+    size_t erase(const Key &key) {
+        keys_.erase(key);
+        return map_.erase(key);
+    }
+
+    bool contains(const Key &key) const { return keys_.contains(key); }
+
+    FindResult end() const { return map_.end(); }
+    FindResult cend() const { return map_.cend(); }
+    FindResult find(const Key &key) const { return map_.find(key); }
+
+    FindResult pop(const Key &key) {
+        keys_.erase(key);
+        return map_.pop(key);
+    }
+
+    std::vector<std::pair<const Key, T>> snapshot(std::function<bool(T)> f = nullptr) const { return map_.snapshot(f); }
+
+    void clear() {
+        keys_.clear();
+        map_.clear();
+    }
+
+    size_t size() const { return map_.size(); }
+    bool empty() const { return map_.empty(); }
+
+  private:
+    Map map_;
+    vl_concurrent_lockfree_map<Key, bool, Hash> keys_;
+};
+
+// Maps a whole file read only, the mapping is released with the object.
+// data() is null if the file could not be opened or mapped, or is empty.
+class ReadOnlyMappedFile {
+  public:
+    explicit ReadOnlyMappedFile(const char *filename);
+    ~ReadOnlyMappedFile();
+
+    ReadOnlyMappedFile(const ReadOnlyMappedFile &) = delete;
+    ReadOnlyMappedFile &operator=(const ReadOnlyMappedFile &) = delete;
+
+    const uint8_t *data() const { return data_; }
+    size_t size() const { return size_; }
+
+  private:
+    const uint8_t *data_ = nullptr;
+    size_t size_ = 0;
+#if defined(_WIN32)
+    void *file_handle_ = nullptr;
+    void *mapping_handle_ = nullptr;
+#else
+    int fd_ = -1;
+#endif
+};
+
 static constexpr VkPipelineStageFlags2KHR kFramebufferStagePipelineStageFlags =
     (VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT |
      VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT);
@@ -66,7 +66,125 @@ struct HashedUint64 {
     }
 };
 
-extern vl_concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> unique_id_mapping;
+// Looked up on every call that takes a wrapped handle, so prefer the map with wait-free lookups when it is enabled
+#ifdef VVL_LOCKFREE_HANDLE_MAPS
+using unique_id_map_type = vl_concurrent_lockfree_map<uint64_t, uint64_t, HashedUint64>;
+#else
+using unique_id_map_type = vl_concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64>;
+#endif
+
+// One generation per handle type, bumped whenever a wrapped handle of that type is removed from unique_id_mapping.
+// Only the UnwrapCache entries of that type are invalidated, so destroying e.g. transient image views doesn't evict the
+// buffers and pipelines a command buffer keeps unwrapping.
+extern std::array<std::atomic<uint64_t>, kVulkanObjectTypeMax> unwrap_cache_generations;
+extern std::atomic<uint64_t> unwrap_cache_hits;
+extern std::atomic<uint64_t> unwrap_cache_misses;
+
+// The unwrap_cache_generations entry a handle type uses. Without typesafe handles every non-dispatchable handle is a
+// uint64_t, so they all share the kVulkanObjectTypeUnknown generation.
+template <typename HandleType>
+constexpr VulkanObjectType UnwrapCacheType() {
+#ifdef TYPESAFE_NONDISPATCHABLE_HANDLES
+    return VkHandleInfo<HandleType>::kVulkanObjectType;
+#else
+    return kVulkanObjectTypeUnknown;
+#endif
+}
+
+class UniqueIdMapping : public unique_id_map_type {
+  public:
+    // type is the UnwrapCacheType() of the handle
+    size_t erase(const uint64_t &key, VulkanObjectType type) {
+        const size_t erased = unique_id_map_type::erase(key);
+        if (erased) {
+            unwrap_cache_generations[type].fetch_add(1);
+        }
+        return erased;
+    }
+
+    FindResult pop(const uint64_t &key, VulkanObjectType type) {
+        auto ret = unique_id_map_type::pop(key);
+        if (ret != end()) {
+            unwrap_cache_generations[type].fetch_add(1);
+        }
+        return ret;
+    }
+
+    void clear() {
+        unique_id_map_type::clear();
+        for (auto &generation : unwrap_cache_generations) {
+            generation.fetch_add(1);
+        }
+    }
+};
+extern UniqueIdMapping unique_id_mapping;
+
+// Direct-mapped, per-thread cache in front of unique_id_mapping.
+// Recording a command buffer unwraps the same buffers, pipelines and descriptor sets over and over, so most lookups
+// are served from here without touching the shared map. Each entry remembers the handle type and the generation of
+// that type it was filled under, and is ignored once a handle of that type has been destroyed since.
+class UnwrapCache {
+  public:
+    // Returns 0 if the handle is unknown
+    static uint64_t Unwrap(uint64_t wrapped_handle, VulkanObjectType type) {
+        thread_local UnwrapCache cache;
+        return cache.Lookup(wrapped_handle, type);
+    }
+
+    ~UnwrapCache() { FlushCounters(); }
+
+  private:
+    static constexpr uint64_t kEntryCount = 256;
+    static constexpr uint32_t kCounterFlushInterval = 4096;
+
+    struct Entry {
+        uint64_t wrapped = 0;
+        uint64_t unwrapped = 0;
+        uint64_t generation = 0;
+        VulkanObjectType type = kVulkanObjectTypeUnknown;
+    };
+
+    uint64_t Lookup(uint64_t wrapped_handle, VulkanObjectType type) {
+        // Sample the generation before the map lookup, so that a handle removed concurrently is never cached as valid
+        const uint64_t generation = unwrap_cache_generations[type].load(std::memory_order_acquire);
+        // The low bits of a unique id are the global_unique_id counter, so recently created handles don't collide
+        Entry &entry = entries_[wrapped_handle & (kEntryCount - 1)];
+        if (entry.wrapped == wrapped_handle && entry.type == type && entry.generation == generation) {
+            ++hits_;
+            CountLookup();
+            return entry.unwrapped;
+        }
+        ++misses_;
+        CountLookup();
+        auto iter = unique_id_mapping.find(wrapped_handle);
+        if (iter == unique_id_mapping.end()) {
+            return 0;
+        }
+        entry.wrapped = wrapped_handle;
+        entry.unwrapped = iter->second;
+        entry.generation = generation;
+        entry.type = type;
+        return iter->second;
+    }
+
+    // The global counters are only updated every so often to keep them off the hot path
+    void CountLookup() {
+        if (++pending_ == kCounterFlushInterval) {
+            FlushCounters();
+        }
+    }
+    void FlushCounters() {
+        unwrap_cache_hits.fetch_add(hits_, std::memory_order_relaxed);
+        unwrap_cache_misses.fetch_add(misses_, std::memory_order_relaxed);
+        hits_ = misses_ = 0;
+        pending_ = 0;
+    }
+
+    std::array<Entry, kEntryCount> entries_{};
+    uint64_t hits_ = 0;
+    uint64_t misses_ = 0;
+    uint32_t pending_ = 0;
+};
 
 
 VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetPhysicalDeviceProcAddr(
@@ -4028,6 +4146,12 @@ class ValidationObject {
         CHECK_DISABLED disabled = {};
         CHECK_ENABLED enabled = {};
         bool fine_grained_locking{true};
+        // Report cache and memory statistics as info messages at vkDestroyDevice
+        bool report_stats{false};
+        // Queue operations that may wait for asynchronous synchronization validation, 0 validates them inline
+        uint32_t syncval_async_backlog{0};
+        // Worker threads splitting queue submit synchronization validation by address range, 0 validates on the submit thread
+        uint32_t syncval_submit_threads{0};
 
         VkInstance instance = VK_NULL_HANDLE;
         VkPhysicalDevice physical_device = VK_NULL_HANDLE;
@@ -4058,6 +4182,15 @@ class ValidationObject {
             return WriteLockGuard(validation_object_mutex);
         }
 
+        // Set by InitObjectDispatchVectors() from HasLockFreeCmdHooks(). vkCmd* intercepts then skip the virtual lock calls
+        // for these objects.
+        bool lock_free_cmd_hooks = false;
+        // By default an object's command buffer hooks are lock-free when its ReadLock()/WriteLock() hand back deferred guards
+        // because it does its own locking. Objects can override this to only elide the lock for vkCmd* hooks.
+        virtual bool HasLockFreeCmdHooks() { return !ReadLock().owns_lock() && !WriteLock().owns_lock(); }
+        ReadLockGuard CmdReadLock() const { return lock_free_cmd_hooks ? ReadLockGuard() : ReadLock(); }
+        WriteLockGuard CmdWriteLock() { return lock_free_cmd_hooks ? WriteLockGuard() : WriteLock(); }
+
         ValidationObject* GetValidationObject(std::vector<ValidationObject*>& object_dispatch, LayerObjectTypeId object_type) {
             for (auto validation_object : object_dispatch) {
                 if (validation_object->container_type == object_type) {
@@ -4108,6 +4241,44 @@ class ValidationObject {
             return result;
         }
 
+        // Deferred formatting variants: format_message() returns the message as a std::string and is only invoked
+        // once the message has passed the severity, filter and duplicate checks, so the FormatHandle() and
+        // stringstream work in it is skipped for messages that nobody will see.
+        template <typename Formatter>
+        bool LogErrorDeferred(const LogObjectList &objlist, std::string_view vuid_text, Formatter &&format_message) const {
+            return LogMsgDeferred(kErrorBit, objlist, vuid_text, std::forward<Formatter>(format_message));
+        }
+
+        template <typename Formatter>
+        bool LogWarningDeferred(const LogObjectList &objlist, std::string_view vuid_text, Formatter &&format_message) const {
+            return LogMsgDeferred(kWarningBit, objlist, vuid_text, std::forward<Formatter>(format_message));
+        }
+
+        template <typename Formatter>
+        bool LogPerformanceWarningDeferred(const LogObjectList &objlist, std::string_view vuid_text,
+                                           Formatter &&format_message) const {
+            return LogMsgDeferred(kPerformanceWarningBit, objlist, vuid_text, std::forward<Formatter>(format_message));
+        }
+
+        template <typename Formatter>
+        bool LogMsgDeferred(VkFlags msg_flags, const LogObjectList &objlist, std::string_view vuid_text,
+                            Formatter &&format_message) const {
+            if (!LogMsgEnabled(report_data, msg_flags, vuid_text)) {
+                return false;
+            }
+            return LogMsgText(report_data, msg_flags, objlist, vuid_text, format_message());
+        }
+
+        // printf-style helper for building the message inside a Log*Deferred() formatter
+        static std::string DECORATE_PRINTF(1, 2) FormatString(const char *format, ...) {
+            std::string message;
+            va_list argptr;
+            va_start(argptr, format);
+            FormatLogMessage(message, format, argptr);
+            va_end(argptr);
+            return message;
+        }
+
         void LogInternalError(std::string_view failure_location, const LogObjectList &obj_list,
                               std::string_view entrypoint, VkResult err) const {
             const std::string_view err_string = string_VkResult(err);
@@ -4139,10 +4310,7 @@ class ValidationObject {
         template <typename HandleType>
         HandleType Unwrap(HandleType wrappedHandle) {
             if (wrappedHandle == (HandleType)VK_NULL_HANDLE) return wrappedHandle;
-            auto iter = unique_id_mapping.find(CastToUint64(wrappedHandle));
-            if (iter == unique_id_mapping.end())
-                return (HandleType)0;
-            return (HandleType)iter->second;
+            return (HandleType)UnwrapCache::Unwrap(CastToUint64(wrappedHandle), UnwrapCacheType<HandleType>());
         }
 
         // Wrap a newly created handle with a new unique ID, and return the new ID.
@@ -1641,6 +1641,11 @@ void ValidationObject::InitObjectDispatchVectors() {
 
     intercept_vectors.resize(InterceptIdCount);
 
+    for (auto item : this->object_dispatch) {
+        // Locking policy is fixed once fine_grained_locking is known, which is before this is called
+        item->lock_free_cmd_hooks = item->HasLockFreeCmdHooks();
+    }
+
     BUILD_DISPATCH_VECTOR(PreCallValidateGetDeviceQueue);
     BUILD_DISPATCH_VECTOR(PreCallRecordGetDeviceQueue);
     BUILD_DISPATCH_VECTOR(PostCallRecordGetDeviceQueue);
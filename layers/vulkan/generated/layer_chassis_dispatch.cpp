@@ -544,7 +544,7 @@ void DispatchDestroyRenderPass(VkDevice device, VkRenderPass renderPass, const V
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyRenderPass(device, renderPass, pAllocator);
     uint64_t renderPass_id = CastToUint64(renderPass);
 
-    auto iter = unique_id_mapping.pop(renderPass_id);
+    auto iter = unique_id_mapping.pop(renderPass_id, UnwrapCacheType<VkRenderPass>());
     if (iter != unique_id_mapping.end()) {
         renderPass = (VkRenderPass)iter->second;
     } else {
@@ -644,14 +644,14 @@ void DispatchDestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain, cons
 
     auto &image_array = layer_data->swapchain_wrapped_image_handle_map[swapchain];
     for (auto &image_handle : image_array) {
-        unique_id_mapping.erase(HandleToUint64(image_handle));
+        unique_id_mapping.erase(HandleToUint64(image_handle), UnwrapCacheType<VkImage>());
     }
     layer_data->swapchain_wrapped_image_handle_map.erase(swapchain);
     lock.unlock();
 
     uint64_t swapchain_id = HandleToUint64(swapchain);
 
-    auto iter = unique_id_mapping.pop(swapchain_id);
+    auto iter = unique_id_mapping.pop(swapchain_id, UnwrapCacheType<VkSwapchainKHR>());
     if (iter != unique_id_mapping.end()) {
         swapchain = (VkSwapchainKHR)iter->second;
     } else {
@@ -701,14 +701,14 @@ void DispatchDestroyDescriptorPool(VkDevice device, VkDescriptorPool descriptorP
 
     // remove references to implicitly freed descriptor sets
     for(auto descriptor_set : layer_data->pool_descriptor_sets_map[descriptorPool]) {
-        unique_id_mapping.erase(CastToUint64(descriptor_set));
+        unique_id_mapping.erase(CastToUint64(descriptor_set), UnwrapCacheType<VkDescriptorSet>());
     }
     layer_data->pool_descriptor_sets_map.erase(descriptorPool);
     lock.unlock();
 
     uint64_t descriptorPool_id = CastToUint64(descriptorPool);
 
-    auto iter = unique_id_mapping.pop(descriptorPool_id);
+    auto iter = unique_id_mapping.pop(descriptorPool_id, UnwrapCacheType<VkDescriptorPool>());
     if (iter != unique_id_mapping.end()) {
         descriptorPool = (VkDescriptorPool)iter->second;
     } else {
@@ -730,7 +730,7 @@ VkResult DispatchResetDescriptorPool(VkDevice device, VkDescriptorPool descripto
         WriteLockGuard lock(dispatch_lock);
         // remove references to implicitly freed descriptor sets
         for(auto descriptor_set : layer_data->pool_descriptor_sets_map[descriptorPool]) {
-            unique_id_mapping.erase(CastToUint64(descriptor_set));
+            unique_id_mapping.erase(CastToUint64(descriptor_set), UnwrapCacheType<VkDescriptorSet>());
         }
         layer_data->pool_descriptor_sets_map[descriptorPool].clear();
     }
@@ -798,7 +798,7 @@ VkResult DispatchFreeDescriptorSets(VkDevice device, VkDescriptorPool descriptor
             VkDescriptorSet handle = pDescriptorSets[index0];
             pool_descriptor_sets.erase(handle);
             uint64_t unique_id = CastToUint64(handle);
-            unique_id_mapping.erase(unique_id);
+            unique_id_mapping.erase(unique_id, UnwrapCacheType<VkDescriptorSet>());
         }
     }
     return result;
@@ -886,7 +886,7 @@ void DispatchDestroyDescriptorUpdateTemplate(VkDevice device, VkDescriptorUpdate
     layer_data->desc_template_createinfo_map.erase(descriptor_update_template_id);
     lock.unlock();
 
-    auto iter = unique_id_mapping.pop(descriptor_update_template_id);
+    auto iter = unique_id_mapping.pop(descriptor_update_template_id, UnwrapCacheType<VkDescriptorUpdateTemplate>());
     if (iter != unique_id_mapping.end()) {
         descriptorUpdateTemplate = (VkDescriptorUpdateTemplate)iter->second;
     } else {
@@ -907,7 +907,7 @@ void DispatchDestroyDescriptorUpdateTemplateKHR(VkDevice device, VkDescriptorUpd
     layer_data->desc_template_createinfo_map.erase(descriptor_update_template_id);
     lock.unlock();
 
-    auto iter = unique_id_mapping.pop(descriptor_update_template_id);
+    auto iter = unique_id_mapping.pop(descriptor_update_template_id, UnwrapCacheType<VkDescriptorUpdateTemplate>());
     if (iter != unique_id_mapping.end()) {
         descriptorUpdateTemplate = (VkDescriptorUpdateTemplate)iter->second;
     } else {
@@ -1418,7 +1418,7 @@ void DispatchDestroyCommandPool(VkDevice device, VkCommandPool commandPool, cons
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyCommandPool(device, commandPool, pAllocator);
     uint64_t commandPool_id = CastToUint64(commandPool);
-    auto iter = unique_id_mapping.pop(commandPool_id);
+    auto iter = unique_id_mapping.pop(commandPool_id, UnwrapCacheType<VkCommandPool>());
     if (iter != unique_id_mapping.end()) {
         commandPool = (VkCommandPool)iter->second;
     } else {
@@ -1994,7 +1994,7 @@ void DispatchFreeMemory(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.FreeMemory(device, memory, pAllocator);
     uint64_t memory_id = CastToUint64(memory);
-    auto iter = unique_id_mapping.pop(memory_id);
+    auto iter = unique_id_mapping.pop(memory_id, UnwrapCacheType<VkDeviceMemory>());
     if (iter != unique_id_mapping.end()) {
         memory = (VkDeviceMemory)iter->second;
     } else {
@@ -2293,7 +2293,7 @@ void DispatchDestroyFence(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyFence(device, fence, pAllocator);
     uint64_t fence_id = CastToUint64(fence);
-    auto iter = unique_id_mapping.pop(fence_id);
+    auto iter = unique_id_mapping.pop(fence_id, UnwrapCacheType<VkFence>());
     if (iter != unique_id_mapping.end()) {
         fence = (VkFence)iter->second;
     } else {
@@ -2388,7 +2388,7 @@ void DispatchDestroySemaphore(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroySemaphore(device, semaphore, pAllocator);
     uint64_t semaphore_id = CastToUint64(semaphore);
-    auto iter = unique_id_mapping.pop(semaphore_id);
+    auto iter = unique_id_mapping.pop(semaphore_id, UnwrapCacheType<VkSemaphore>());
     if (iter != unique_id_mapping.end()) {
         semaphore = (VkSemaphore)iter->second;
     } else {
@@ -2421,7 +2421,7 @@ void DispatchDestroyEvent(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyEvent(device, event, pAllocator);
     uint64_t event_id = CastToUint64(event);
-    auto iter = unique_id_mapping.pop(event_id);
+    auto iter = unique_id_mapping.pop(event_id, UnwrapCacheType<VkEvent>());
     if (iter != unique_id_mapping.end()) {
         event = (VkEvent)iter->second;
     } else {
@@ -2496,7 +2496,7 @@ void DispatchDestroyQueryPool(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyQueryPool(device, queryPool, pAllocator);
     uint64_t queryPool_id = CastToUint64(queryPool);
-    auto iter = unique_id_mapping.pop(queryPool_id);
+    auto iter = unique_id_mapping.pop(queryPool_id, UnwrapCacheType<VkQueryPool>());
     if (iter != unique_id_mapping.end()) {
         queryPool = (VkQueryPool)iter->second;
     } else {
@@ -2558,7 +2558,7 @@ void DispatchDestroyBuffer(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyBuffer(device, buffer, pAllocator);
     uint64_t buffer_id = CastToUint64(buffer);
-    auto iter = unique_id_mapping.pop(buffer_id);
+    auto iter = unique_id_mapping.pop(buffer_id, UnwrapCacheType<VkBuffer>());
     if (iter != unique_id_mapping.end()) {
         buffer = (VkBuffer)iter->second;
     } else {
@@ -2602,7 +2602,7 @@ void DispatchDestroyBufferView(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyBufferView(device, bufferView, pAllocator);
     uint64_t bufferView_id = CastToUint64(bufferView);
-    auto iter = unique_id_mapping.pop(bufferView_id);
+    auto iter = unique_id_mapping.pop(bufferView_id, UnwrapCacheType<VkBufferView>());
     if (iter != unique_id_mapping.end()) {
         bufferView = (VkBufferView)iter->second;
     } else {
@@ -2644,7 +2644,7 @@ void DispatchDestroyImage(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyImage(device, image, pAllocator);
     uint64_t image_id = CastToUint64(image);
-    auto iter = unique_id_mapping.pop(image_id);
+    auto iter = unique_id_mapping.pop(image_id, UnwrapCacheType<VkImage>());
     if (iter != unique_id_mapping.end()) {
         image = (VkImage)iter->second;
     } else {
@@ -2704,7 +2704,7 @@ void DispatchDestroyImageView(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyImageView(device, imageView, pAllocator);
     uint64_t imageView_id = CastToUint64(imageView);
-    auto iter = unique_id_mapping.pop(imageView_id);
+    auto iter = unique_id_mapping.pop(imageView_id, UnwrapCacheType<VkImageView>());
     if (iter != unique_id_mapping.end()) {
         imageView = (VkImageView)iter->second;
     } else {
@@ -2746,7 +2746,7 @@ void DispatchDestroyShaderModule(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyShaderModule(device, shaderModule, pAllocator);
     uint64_t shaderModule_id = CastToUint64(shaderModule);
-    auto iter = unique_id_mapping.pop(shaderModule_id);
+    auto iter = unique_id_mapping.pop(shaderModule_id, UnwrapCacheType<VkShaderModule>());
     if (iter != unique_id_mapping.end()) {
         shaderModule = (VkShaderModule)iter->second;
     } else {
@@ -2779,7 +2779,7 @@ void DispatchDestroyPipelineCache(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyPipelineCache(device, pipelineCache, pAllocator);
     uint64_t pipelineCache_id = CastToUint64(pipelineCache);
-    auto iter = unique_id_mapping.pop(pipelineCache_id);
+    auto iter = unique_id_mapping.pop(pipelineCache_id, UnwrapCacheType<VkPipelineCache>());
     if (iter != unique_id_mapping.end()) {
         pipelineCache = (VkPipelineCache)iter->second;
     } else {
@@ -2891,7 +2891,7 @@ void DispatchDestroyPipeline(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyPipeline(device, pipeline, pAllocator);
     uint64_t pipeline_id = CastToUint64(pipeline);
-    auto iter = unique_id_mapping.pop(pipeline_id);
+    auto iter = unique_id_mapping.pop(pipeline_id, UnwrapCacheType<VkPipeline>());
     if (iter != unique_id_mapping.end()) {
         pipeline = (VkPipeline)iter->second;
     } else {
@@ -2937,7 +2937,7 @@ void DispatchDestroyPipelineLayout(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyPipelineLayout(device, pipelineLayout, pAllocator);
     uint64_t pipelineLayout_id = CastToUint64(pipelineLayout);
-    auto iter = unique_id_mapping.pop(pipelineLayout_id);
+    auto iter = unique_id_mapping.pop(pipelineLayout_id, UnwrapCacheType<VkPipelineLayout>());
     if (iter != unique_id_mapping.end()) {
         pipelineLayout = (VkPipelineLayout)iter->second;
     } else {
@@ -2979,7 +2979,7 @@ void DispatchDestroySampler(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroySampler(device, sampler, pAllocator);
     uint64_t sampler_id = CastToUint64(sampler);
-    auto iter = unique_id_mapping.pop(sampler_id);
+    auto iter = unique_id_mapping.pop(sampler_id, UnwrapCacheType<VkSampler>());
     if (iter != unique_id_mapping.end()) {
         sampler = (VkSampler)iter->second;
     } else {
@@ -3029,7 +3029,7 @@ void DispatchDestroyDescriptorSetLayout(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
     uint64_t descriptorSetLayout_id = CastToUint64(descriptorSetLayout);
-    auto iter = unique_id_mapping.pop(descriptorSetLayout_id);
+    auto iter = unique_id_mapping.pop(descriptorSetLayout_id, UnwrapCacheType<VkDescriptorSetLayout>());
     if (iter != unique_id_mapping.end()) {
         descriptorSetLayout = (VkDescriptorSetLayout)iter->second;
     } else {
@@ -3167,7 +3167,7 @@ void DispatchDestroyFramebuffer(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyFramebuffer(device, framebuffer, pAllocator);
     uint64_t framebuffer_id = CastToUint64(framebuffer);
-    auto iter = unique_id_mapping.pop(framebuffer_id);
+    auto iter = unique_id_mapping.pop(framebuffer_id, UnwrapCacheType<VkFramebuffer>());
     if (iter != unique_id_mapping.end()) {
         framebuffer = (VkFramebuffer)iter->second;
     } else {
@@ -4263,7 +4263,7 @@ void DispatchDestroySamplerYcbcrConversion(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroySamplerYcbcrConversion(device, ycbcrConversion, pAllocator);
     uint64_t ycbcrConversion_id = CastToUint64(ycbcrConversion);
-    auto iter = unique_id_mapping.pop(ycbcrConversion_id);
+    auto iter = unique_id_mapping.pop(ycbcrConversion_id, UnwrapCacheType<VkSamplerYcbcrConversion>());
     if (iter != unique_id_mapping.end()) {
         ycbcrConversion = (VkSamplerYcbcrConversion)iter->second;
     } else {
@@ -4599,7 +4599,7 @@ void DispatchDestroyPrivateDataSlot(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyPrivateDataSlot(device, privateDataSlot, pAllocator);
     uint64_t privateDataSlot_id = CastToUint64(privateDataSlot);
-    auto iter = unique_id_mapping.pop(privateDataSlot_id);
+    auto iter = unique_id_mapping.pop(privateDataSlot_id, UnwrapCacheType<VkPrivateDataSlot>());
     if (iter != unique_id_mapping.end()) {
         privateDataSlot = (VkPrivateDataSlot)iter->second;
     } else {
@@ -5189,7 +5189,7 @@ void DispatchDestroySurfaceKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     if (!wrap_handles) return layer_data->instance_dispatch_table.DestroySurfaceKHR(instance, surface, pAllocator);
     uint64_t surface_id = CastToUint64(surface);
-    auto iter = unique_id_mapping.pop(surface_id);
+    auto iter = unique_id_mapping.pop(surface_id, UnwrapCacheType<VkSurfaceKHR>());
     if (iter != unique_id_mapping.end()) {
         surface = (VkSurfaceKHR)iter->second;
     } else {
@@ -5624,7 +5624,7 @@ void DispatchDestroyVideoSessionKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyVideoSessionKHR(device, videoSession, pAllocator);
     uint64_t videoSession_id = CastToUint64(videoSession);
-    auto iter = unique_id_mapping.pop(videoSession_id);
+    auto iter = unique_id_mapping.pop(videoSession_id, UnwrapCacheType<VkVideoSessionKHR>());
     if (iter != unique_id_mapping.end()) {
         videoSession = (VkVideoSessionKHR)iter->second;
     } else {
@@ -5730,7 +5730,7 @@ void DispatchDestroyVideoSessionParametersKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyVideoSessionParametersKHR(device, videoSessionParameters, pAllocator);
     uint64_t videoSessionParameters_id = CastToUint64(videoSessionParameters);
-    auto iter = unique_id_mapping.pop(videoSessionParameters_id);
+    auto iter = unique_id_mapping.pop(videoSessionParameters_id, UnwrapCacheType<VkVideoSessionParametersKHR>());
     if (iter != unique_id_mapping.end()) {
         videoSessionParameters = (VkVideoSessionParametersKHR)iter->second;
     } else {
@@ -6639,7 +6639,7 @@ void DispatchDestroySamplerYcbcrConversionKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroySamplerYcbcrConversionKHR(device, ycbcrConversion, pAllocator);
     uint64_t ycbcrConversion_id = CastToUint64(ycbcrConversion);
-    auto iter = unique_id_mapping.pop(ycbcrConversion_id);
+    auto iter = unique_id_mapping.pop(ycbcrConversion_id, UnwrapCacheType<VkSamplerYcbcrConversion>());
     if (iter != unique_id_mapping.end()) {
         ycbcrConversion = (VkSamplerYcbcrConversion)iter->second;
     } else {
@@ -6961,7 +6961,7 @@ void DispatchDestroyDeferredOperationKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyDeferredOperationKHR(device, operation, pAllocator);
     uint64_t operation_id = CastToUint64(operation);
-    auto iter = unique_id_mapping.pop(operation_id);
+    auto iter = unique_id_mapping.pop(operation_id, UnwrapCacheType<VkDeferredOperationKHR>());
     if (iter != unique_id_mapping.end()) {
         operation = (VkDeferredOperationKHR)iter->second;
     } else {
@@ -7564,7 +7564,7 @@ void DispatchDestroyDebugReportCallbackEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     if (!wrap_handles) return layer_data->instance_dispatch_table.DestroyDebugReportCallbackEXT(instance, callback, pAllocator);
     uint64_t callback_id = CastToUint64(callback);
-    auto iter = unique_id_mapping.pop(callback_id);
+    auto iter = unique_id_mapping.pop(callback_id, UnwrapCacheType<VkDebugReportCallbackEXT>());
     if (iter != unique_id_mapping.end()) {
         callback = (VkDebugReportCallbackEXT)iter->second;
     } else {
@@ -7790,7 +7790,7 @@ void DispatchDestroyCuModuleNVX(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyCuModuleNVX(device, module, pAllocator);
     uint64_t module_id = CastToUint64(module);
-    auto iter = unique_id_mapping.pop(module_id);
+    auto iter = unique_id_mapping.pop(module_id, UnwrapCacheType<VkCuModuleNVX>());
     if (iter != unique_id_mapping.end()) {
         module = (VkCuModuleNVX)iter->second;
     } else {
@@ -7808,7 +7808,7 @@ void DispatchDestroyCuFunctionNVX(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyCuFunctionNVX(device, function, pAllocator);
     uint64_t function_id = CastToUint64(function);
-    auto iter = unique_id_mapping.pop(function_id);
+    auto iter = unique_id_mapping.pop(function_id, UnwrapCacheType<VkCuFunctionNVX>());
     if (iter != unique_id_mapping.end()) {
         function = (VkCuFunctionNVX)iter->second;
     } else {
@@ -8374,7 +8374,7 @@ void DispatchDestroyDebugUtilsMessengerEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
     if (!wrap_handles) return layer_data->instance_dispatch_table.DestroyDebugUtilsMessengerEXT(instance, messenger, pAllocator);
     uint64_t messenger_id = CastToUint64(messenger);
-    auto iter = unique_id_mapping.pop(messenger_id);
+    auto iter = unique_id_mapping.pop(messenger_id, UnwrapCacheType<VkDebugUtilsMessengerEXT>());
     if (iter != unique_id_mapping.end()) {
         messenger = (VkDebugUtilsMessengerEXT)iter->second;
     } else {
@@ -8492,7 +8492,7 @@ void DispatchDestroyValidationCacheEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyValidationCacheEXT(device, validationCache, pAllocator);
     uint64_t validationCache_id = CastToUint64(validationCache);
-    auto iter = unique_id_mapping.pop(validationCache_id);
+    auto iter = unique_id_mapping.pop(validationCache_id, UnwrapCacheType<VkValidationCacheEXT>());
     if (iter != unique_id_mapping.end()) {
         validationCache = (VkValidationCacheEXT)iter->second;
     } else {
@@ -8626,7 +8626,7 @@ void DispatchDestroyAccelerationStructureNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyAccelerationStructureNV(device, accelerationStructure, pAllocator);
     uint64_t accelerationStructure_id = CastToUint64(accelerationStructure);
-    auto iter = unique_id_mapping.pop(accelerationStructure_id);
+    auto iter = unique_id_mapping.pop(accelerationStructure_id, UnwrapCacheType<VkAccelerationStructureNV>());
     if (iter != unique_id_mapping.end()) {
         accelerationStructure = (VkAccelerationStructureNV)iter->second;
     } else {
@@ -9697,7 +9697,7 @@ void DispatchDestroyIndirectCommandsLayoutNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyIndirectCommandsLayoutNV(device, indirectCommandsLayout, pAllocator);
     uint64_t indirectCommandsLayout_id = CastToUint64(indirectCommandsLayout);
-    auto iter = unique_id_mapping.pop(indirectCommandsLayout_id);
+    auto iter = unique_id_mapping.pop(indirectCommandsLayout_id, UnwrapCacheType<VkIndirectCommandsLayoutNV>());
     if (iter != unique_id_mapping.end()) {
         indirectCommandsLayout = (VkIndirectCommandsLayoutNV)iter->second;
     } else {
@@ -9760,7 +9760,7 @@ void DispatchDestroyPrivateDataSlotEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyPrivateDataSlotEXT(device, privateDataSlot, pAllocator);
     uint64_t privateDataSlot_id = CastToUint64(privateDataSlot);
-    auto iter = unique_id_mapping.pop(privateDataSlot_id);
+    auto iter = unique_id_mapping.pop(privateDataSlot_id, UnwrapCacheType<VkPrivateDataSlot>());
     if (iter != unique_id_mapping.end()) {
         privateDataSlot = (VkPrivateDataSlot)iter->second;
     } else {
@@ -10273,7 +10273,7 @@ void DispatchDestroyBufferCollectionFUCHSIA(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyBufferCollectionFUCHSIA(device, collection, pAllocator);
     uint64_t collection_id = CastToUint64(collection);
-    auto iter = unique_id_mapping.pop(collection_id);
+    auto iter = unique_id_mapping.pop(collection_id, UnwrapCacheType<VkBufferCollectionFUCHSIA>());
     if (iter != unique_id_mapping.end()) {
         collection = (VkBufferCollectionFUCHSIA)iter->second;
     } else {
@@ -10521,7 +10521,7 @@ void DispatchDestroyMicromapEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyMicromapEXT(device, micromap, pAllocator);
     uint64_t micromap_id = CastToUint64(micromap);
-    auto iter = unique_id_mapping.pop(micromap_id);
+    auto iter = unique_id_mapping.pop(micromap_id, UnwrapCacheType<VkMicromapEXT>());
     if (iter != unique_id_mapping.end()) {
         micromap = (VkMicromapEXT)iter->second;
     } else {
@@ -11331,7 +11331,7 @@ void DispatchDestroyOpticalFlowSessionNV(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyOpticalFlowSessionNV(device, session, pAllocator);
     uint64_t session_id = CastToUint64(session);
-    auto iter = unique_id_mapping.pop(session_id);
+    auto iter = unique_id_mapping.pop(session_id, UnwrapCacheType<VkOpticalFlowSessionNV>());
     if (iter != unique_id_mapping.end()) {
         session = (VkOpticalFlowSessionNV)iter->second;
     } else {
@@ -11416,7 +11416,7 @@ void DispatchDestroyShaderEXT(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyShaderEXT(device, shader, pAllocator);
     uint64_t shader_id = CastToUint64(shader);
-    auto iter = unique_id_mapping.pop(shader_id);
+    auto iter = unique_id_mapping.pop(shader_id, UnwrapCacheType<VkShaderEXT>());
     if (iter != unique_id_mapping.end()) {
         shader = (VkShaderEXT)iter->second;
     } else {
@@ -11571,7 +11571,7 @@ void DispatchDestroyAccelerationStructureKHR(
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyAccelerationStructureKHR(device, accelerationStructure, pAllocator);
     uint64_t accelerationStructure_id = CastToUint64(accelerationStructure);
-    auto iter = unique_id_mapping.pop(accelerationStructure_id);
+    auto iter = unique_id_mapping.pop(accelerationStructure_id, UnwrapCacheType<VkAccelerationStructureKHR>());
     if (iter != unique_id_mapping.end()) {
         accelerationStructure = (VkAccelerationStructureKHR)iter->second;
     } else {
@@ -0,0 +1,236 @@
+#!/usr/bin/env python3
+# Copyright (c) 2023 The Khronos Group Inc.
+# Copyright (c) 2023 Valve Corporation
+# Copyright (c) 2023 LunarG, Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# Decodes the file written by the VK_DBG_LAYER_ACTION_LOG_BINARY debug action into the same text the
+# VK_DBG_LAYER_ACTION_LOG_MSG action prints, or into JSON. The layout is described in
+# layers/error_message/binary_log.h, keep the two in sync.
+
+import argparse
+import json
+import re
+import struct
+import sys
+
+MAGIC = b'VVLBLOG1'
+VERSION = 1
+HEADER = struct.Struct('<8sII10Q')
+RECORD_HEADER = struct.Struct('<IBBHIIQ')
+OBJECT = struct.Struct('<IQ')
+
+# Dictionary entry types
+FORMAT_STRING = 1
+VUID = 2
+
+# Argument kinds
+SIGNED = 1
+UNSIGNED = 2
+DOUBLE = 3
+STRING = 4
+POINTER = 5
+
+# LogMessageTypeBits from vk_layer_config.h
+INFORMATION_BIT = 0x1
+WARNING_BIT = 0x2
+PERFORMANCE_WARNING_BIT = 0x4
+ERROR_BIT = 0x8
+VERBOSE_BIT = 0x10
+
+CONVERSION = re.compile(r'%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d*))?(hh|h|ll|l|z|j|t|L)?([diouxXcfFeEgGaAspn%])')
+
+def Severity(msg_flags):
+    # Same names and order as DebugReportFlagsToAnnotFlags() followed by PrintMessageSeverity() and PrintMessageType()
+    severities = set()
+    types = set()
+    if msg_flags & PERFORMANCE_WARNING_BIT:
+        severities.add('WARN')
+        types.add('PERF')
+    if msg_flags & VERBOSE_BIT:
+        severities.add('VERBOSE')
+        types.update(['GEN', 'SPEC'])
+    if msg_flags & INFORMATION_BIT:
+        severities.add('INFO')
+        types.add('SPEC')
+    if msg_flags & WARNING_BIT:
+        severities.add('WARN')
+        types.add('SPEC')
+    if msg_flags & ERROR_BIT:
+        severities.add('ERROR')
+        types.add('SPEC')
+    return (','.join(s for s in ['VERBOSE', 'INFO', 'WARN', 'ERROR'] if s in severities),
+            ','.join(t for t in ['GEN', 'SPEC', 'PERF'] if t in types))
+
+def FormatMessage(format_string, args):
+    """Renders a printf format string with the arguments recorded by the layer"""
+    if format_string is None:
+        return 'Unknown format, arguments: ' + ', '.join(str(arg) for arg in args)
+    remaining = list(args)
+    def Take():
+        return remaining.pop(0) if remaining else 0
+    def Replace(match):
+        flags, width, precision, _, conversion = match.groups()
+        if conversion == '%':
+            return '%'
+        if conversion == 'n':
+            return ''
+        if width == '*':
+            width = str(Take())
+        if precision == '*':
+            precision = str(Take())
+        spec = '%' + flags + (width or '') + ('.' + precision if precision is not None else '')
+        value = Take()
+        if conversion in 'diu':
+            return (spec + 'd') % int(value)
+        if conversion in 'oxXc':
+            return (spec + conversion) % int(value)
+        if conversion in 'aA':
+            text = float(value).hex()
+            return text.upper() if conversion == 'A' else text
+        if conversion in 'fFeEgG':
+            return (spec + conversion) % float(value)
+        if conversion == 'p':
+            return (spec + 's') % hex(int(value))
+        return (spec + 's') % value
+    return CONVERSION.sub(Replace, format_string)
+
+class BinaryLog:
+    def __init__(self, data):
+        if len(data) < HEADER.size:
+            raise ValueError('file is too small to be a binary log')
+        (magic, version, _, self.dictionary_offset, self.dictionary_capacity, self.dictionary_used, self.ring_offset,
+         self.ring_capacity, self.ring_head, self.ring_tail, self.record_count, self.dropped_count,
+         self.start_time_ns) = HEADER.unpack_from(data, 0)
+        if magic != MAGIC:
+            raise ValueError('not a validation layer binary log')
+        if version != VERSION:
+            raise ValueError(f'unsupported binary log version {version}')
+        self.data = data
+        self.formats = {}
+        self.vuids = {}
+        self.ReadDictionary()
+
+    def ReadDictionary(self):
+        offset = self.dictionary_offset
+        end = self.dictionary_offset + self.dictionary_used
+        while offset + 12 <= end:
+            size, entry_type, entry_id = struct.unpack_from('<IB3xI', self.data, offset)
+            if size < 12:
+                break
+            text = bytes(self.data[offset + 12:offset + size]).rstrip(b'\0').decode('utf-8', errors='replace')
+            if entry_type == FORMAT_STRING:
+                self.formats[entry_id] = text
+            elif entry_type == VUID:
+                self.vuids[entry_id] = text
+            offset += size
+
+    def RingBytes(self, logical_offset, size):
+        position = logical_offset % self.ring_capacity
+        start = self.ring_offset + position
+        first = min(size, self.ring_capacity - position)
+        result = bytes(self.data[start:start + first])
+        if first < size:
+            result += bytes(self.data[self.ring_offset:self.ring_offset + size - first])
+        return result
+
+    def Records(self):
+        offset = self.ring_tail
+        while offset < self.ring_head:
+            size = struct.unpack('<I', self.RingBytes(offset, 4))[0]
+            if size < RECORD_HEADER.size:
+                raise ValueError(f'corrupt record at ring offset {offset}')
+            yield self.DecodeRecord(self.RingBytes(offset, size))
+            offset += size
+
+    def DecodeRecord(self, record):
+        _, msg_flags, object_count, arg_count, vuid_hash, format_id, timestamp = RECORD_HEADER.unpack_from(record, 0)
+        offset = RECORD_HEADER.size
+        objects = []
+        for _ in range(object_count):
+            object_type, handle = OBJECT.unpack_from(record, offset)
+            objects.append({'type': object_type, 'handle': handle})
+            offset += OBJECT.size
+        args = []
+        for _ in range(arg_count):
+            kind = record[offset]
+            offset += 1
+            if kind == SIGNED:
+                args.append(struct.unpack_from('<q', record, offset)[0])
+                offset += 8
+            elif kind in (UNSIGNED, POINTER):
+                args.append(struct.unpack_from('<Q', record, offset)[0])
+                offset += 8
+            elif kind == DOUBLE:
+                args.append(struct.unpack_from('<d', record, offset)[0])
+                offset += 8
+            elif kind == STRING:
+                length = struct.unpack_from('<I', record, offset)[0]
+                offset += 4
+                args.append(record[offset:offset + length].decode('utf-8', errors='replace'))
+                offset += length
+            else:
+                raise ValueError(f'unknown argument kind {kind}')
+        severity, message_type = Severity(msg_flags)
+        return {
+            'timestamp_ns': self.start_time_ns + timestamp,
+            'severity': severity,
+            'type': message_type,
+            'vuid': self.vuids.get(vuid_hash, f'0x{vuid_hash:08x}'),
+            'message_id': struct.unpack('<i', struct.pack('<I', vuid_hash))[0],
+            'objects': objects,
+            'message': FormatMessage(self.formats.get(format_id), args),
+        }
+
+def RecordToText(record):
+    # Matches MessengerLogCallback(), without the object names which are not recorded
+    text = (f"{record['vuid']}({record['severity']} / {record['type']}): msgNum: {record['message_id']} - "
+            f"{record['message']}\n")
+    text += f"    Objects: {len(record['objects'])}\n"
+    for index, obj in enumerate(record['objects']):
+        handle = hex(obj['handle']) if obj['handle'] else '0'
+        text += f"        [{index}] {handle}, type: {obj['type']}, name: NULL\n"
+    return text
+
+def main(argv):
+    parser = argparse.ArgumentParser(description='Decode a validation layer binary message log')
+    parser.add_argument('log', help='file written by VK_DBG_LAYER_ACTION_LOG_BINARY')
+    parser.add_argument('-o', '--output', help='output file, defaults to stdout')
+    parser.add_argument('--json', action='store_true', help='write JSON instead of text')
+    args = parser.parse_args(argv)
+
+    with open(args.log, 'rb') as log_file:
+        log = BinaryLog(memoryview(log_file.read()))
+
+    out = open(args.output, 'w', encoding='utf-8') if args.output else sys.stdout
+    try:
+        if args.json:
+            json.dump({
+                'record_count': log.record_count,
+                'dropped_count': log.dropped_count,
+                'overwritten_count': log.record_count - sum(1 for _ in log.Records()),
+                'messages': list(log.Records()),
+            }, out, indent=2)
+            out.write('\n')
+        else:
+            for record in log.Records():
+                out.write(RecordToText(record))
+            if log.dropped_count:
+                out.write(f'{log.dropped_count} messages were dropped\n')
+    finally:
+        if out is not sys.stdout:
+            out.close()
+
+if __name__ == '__main__':
+    main(sys.argv[1:])
@@ -297,7 +297,7 @@ void DispatchDestroyRenderPass(VkDevice device, VkRenderPass renderPass, const V
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyRenderPass(device, renderPass, pAllocator);
     uint64_t renderPass_id = CastToUint64(renderPass);
 
-    auto iter = unique_id_mapping.pop(renderPass_id);
+    auto iter = unique_id_mapping.pop(renderPass_id, UnwrapCacheType<VkRenderPass>());
     if (iter != unique_id_mapping.end()) {
         renderPass = (VkRenderPass)iter->second;
     } else {
@@ -397,14 +397,14 @@ void DispatchDestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain, cons
 
     auto &image_array = layer_data->swapchain_wrapped_image_handle_map[swapchain];
     for (auto &image_handle : image_array) {
-        unique_id_mapping.erase(HandleToUint64(image_handle));
+        unique_id_mapping.erase(HandleToUint64(image_handle), UnwrapCacheType<VkImage>());
     }
     layer_data->swapchain_wrapped_image_handle_map.erase(swapchain);
     lock.unlock();
 
     uint64_t swapchain_id = HandleToUint64(swapchain);
 
-    auto iter = unique_id_mapping.pop(swapchain_id);
+    auto iter = unique_id_mapping.pop(swapchain_id, UnwrapCacheType<VkSwapchainKHR>());
     if (iter != unique_id_mapping.end()) {
         swapchain = (VkSwapchainKHR)iter->second;
     } else {
@@ -454,14 +454,14 @@ void DispatchDestroyDescriptorPool(VkDevice device, VkDescriptorPool descriptorP
 
     // remove references to implicitly freed descriptor sets
     for(auto descriptor_set : layer_data->pool_descriptor_sets_map[descriptorPool]) {
-        unique_id_mapping.erase(CastToUint64(descriptor_set));
+        unique_id_mapping.erase(CastToUint64(descriptor_set), UnwrapCacheType<VkDescriptorSet>());
     }
     layer_data->pool_descriptor_sets_map.erase(descriptorPool);
     lock.unlock();
 
     uint64_t descriptorPool_id = CastToUint64(descriptorPool);
 
-    auto iter = unique_id_mapping.pop(descriptorPool_id);
+    auto iter = unique_id_mapping.pop(descriptorPool_id, UnwrapCacheType<VkDescriptorPool>());
     if (iter != unique_id_mapping.end()) {
         descriptorPool = (VkDescriptorPool)iter->second;
     } else {
@@ -483,7 +483,7 @@ VkResult DispatchResetDescriptorPool(VkDevice device, VkDescriptorPool descripto
         WriteLockGuard lock(dispatch_lock);
         // remove references to implicitly freed descriptor sets
         for(auto descriptor_set : layer_data->pool_descriptor_sets_map[descriptorPool]) {
-            unique_id_mapping.erase(CastToUint64(descriptor_set));
+            unique_id_mapping.erase(CastToUint64(descriptor_set), UnwrapCacheType<VkDescriptorSet>());
         }
         layer_data->pool_descriptor_sets_map[descriptorPool].clear();
     }
@@ -551,7 +551,7 @@ VkResult DispatchFreeDescriptorSets(VkDevice device, VkDescriptorPool descriptor
             VkDescriptorSet handle = pDescriptorSets[index0];
             pool_descriptor_sets.erase(handle);
             uint64_t unique_id = CastToUint64(handle);
-            unique_id_mapping.erase(unique_id);
+            unique_id_mapping.erase(unique_id, UnwrapCacheType<VkDescriptorSet>());
         }
     }
     return result;
@@ -639,7 +639,7 @@ void DispatchDestroyDescriptorUpdateTemplate(VkDevice device, VkDescriptorUpdate
     layer_data->desc_template_createinfo_map.erase(descriptor_update_template_id);
     lock.unlock();
 
-    auto iter = unique_id_mapping.pop(descriptor_update_template_id);
+    auto iter = unique_id_mapping.pop(descriptor_update_template_id, UnwrapCacheType<VkDescriptorUpdateTemplate>());
     if (iter != unique_id_mapping.end()) {
         descriptorUpdateTemplate = (VkDescriptorUpdateTemplate)iter->second;
     } else {
@@ -660,7 +660,7 @@ void DispatchDestroyDescriptorUpdateTemplateKHR(VkDevice device, VkDescriptorUpd
     layer_data->desc_template_createinfo_map.erase(descriptor_update_template_id);
     lock.unlock();
 
-    auto iter = unique_id_mapping.pop(descriptor_update_template_id);
+    auto iter = unique_id_mapping.pop(descriptor_update_template_id, UnwrapCacheType<VkDescriptorUpdateTemplate>());
     if (iter != unique_id_mapping.end()) {
         descriptorUpdateTemplate = (VkDescriptorUpdateTemplate)iter->second;
     } else {
@@ -1171,7 +1171,7 @@ void DispatchDestroyCommandPool(VkDevice device, VkCommandPool commandPool, cons
     auto layer_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     if (!wrap_handles) return layer_data->device_dispatch_table.DestroyCommandPool(device, commandPool, pAllocator);
     uint64_t commandPool_id = CastToUint64(commandPool);
-    auto iter = unique_id_mapping.pop(commandPool_id);
+    auto iter = unique_id_mapping.pop(commandPool_id, UnwrapCacheType<VkCommandPool>());
     if (iter != unique_id_mapping.end()) {
         commandPool = (VkCommandPool)iter->second;
     } else {
@@ -1970,7 +1970,7 @@ void DispatchGetDescriptorEXT(
                     indent = self.incIndent(indent)
                     destroy_ndo_code += '%s%s handle = %s[index0];\n' % (indent, cmd_info[param].type, cmd_info[param].name)
                     destroy_ndo_code += '%suint64_t unique_id = CastToUint64(handle);\n' % (indent)
-                    destroy_ndo_code += '%sunique_id_mapping.erase(unique_id);\n' % (indent)
+                    destroy_ndo_code += '%sunique_id_mapping.erase(unique_id, UnwrapCacheType<%s>());\n' % (indent, cmd_info[param].type)
                     indent = self.decIndent(indent);
                     destroy_ndo_code += '%s}\n' % indent
                     indent = self.decIndent(indent);
@@ -1978,7 +1978,8 @@ void DispatchGetDescriptorEXT(
                 else:
                     # Remove a single handle from the map
                     destroy_ndo_code += '%suint64_t %s_id = CastToUint64(%s);\n' % (indent, cmd_info[param].name, cmd_info[param].name)
-                    destroy_ndo_code += '%sauto iter = unique_id_mapping.pop(%s_id);\n' % (indent, cmd_info[param].name)
+                    destroy_ndo_code += '%sauto iter = unique_id_mapping.pop(%s_id, UnwrapCacheType<%s>());\n' % (indent, cmd_info[param].name,
+                                                                                              cmd_info[param].type)
                     destroy_ndo_code += '%sif (iter != unique_id_mapping.end()) {\n' % (indent)
                     indent = self.incIndent(indent)
                     destroy_ndo_code += '%s%s = (%s)iter->second;\n' % (indent, cmd_info[param].name, cmd_info[param].type)
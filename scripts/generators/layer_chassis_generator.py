@@ -111,10 +111,19 @@ class LayerChassisOutputGenerator(OutputGenerator):
         'vkSetDebugUtilsObjectNameEXT' : 'layer_data->report_data->DebugReportSetUtilsObjectName(pNameInfo);',
         'vkQueueBeginDebugUtilsLabelEXT' : 'BeginQueueDebugUtilsLabel(layer_data->report_data, queue, pLabelInfo);',
         'vkQueueInsertDebugUtilsLabelEXT' : 'InsertQueueDebugUtilsLabel(layer_data->report_data, queue, pLabelInfo);',
+        'vkCmdBeginDebugUtilsLabelEXT' : 'BeginCmdDebugUtilsLabel(layer_data->report_data, commandBuffer, pLabelInfo);',
+        'vkCmdInsertDebugUtilsLabelEXT' : 'InsertCmdDebugUtilsLabel(layer_data->report_data, commandBuffer, pLabelInfo);',
+        'vkBeginCommandBuffer' : 'ResetCmdDebugUtilsLabel(layer_data->report_data, commandBuffer);',
+        'vkResetCommandBuffer' : 'ResetCmdDebugUtilsLabel(layer_data->report_data, commandBuffer);',
+        'vkFreeCommandBuffers' : 'FreeCmdDebugUtilsLabels(layer_data->report_data, commandPool, commandBufferCount, pCommandBuffers);',
+        'vkResetCommandPool' : 'ResetPoolCmdDebugUtilsLabels(layer_data->report_data, commandPool);',
+        'vkDestroyCommandPool' : 'ErasePoolCmdDebugUtilsLabels(layer_data->report_data, commandPool);',
         }
 
     post_dispatch_debug_utils_functions = {
         'vkQueueEndDebugUtilsLabelEXT' : 'EndQueueDebugUtilsLabel(layer_data->report_data, queue);',
+        'vkCmdEndDebugUtilsLabelEXT' : 'EndCmdDebugUtilsLabel(layer_data->report_data, commandBuffer);',
+        'vkAllocateCommandBuffers' : 'if (result == VK_SUCCESS) AllocateCmdDebugUtilsLabels(layer_data->report_data, device, pAllocateInfo, pCommandBuffers);',
         'vkCreateDebugReportCallbackEXT' : 'LayerCreateReportCallback(layer_data->report_data, false, pCreateInfo, pCallback);',
         'vkDestroyDebugReportCallbackEXT' : 'LayerDestroyCallback(layer_data->report_data, callback);',
         'vkCreateDebugUtilsMessengerEXT' : 'LayerCreateMessengerCallback(layer_data->report_data, false, pCreateInfo, pMessenger);',
@@ -227,7 +236,125 @@ struct HashedUint64 {
     }
 };
 
-extern vl_concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> unique_id_mapping;
+// Looked up on every call that takes a wrapped handle, so prefer the map with wait-free lookups when it is enabled
+#ifdef VVL_LOCKFREE_HANDLE_MAPS
+using unique_id_map_type = vl_concurrent_lockfree_map<uint64_t, uint64_t, HashedUint64>;
+#else
+using unique_id_map_type = vl_concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64>;
+#endif
+
+// One generation per handle type, bumped whenever a wrapped handle of that type is removed from unique_id_mapping.
+// Only the UnwrapCache entries of that type are invalidated, so destroying e.g. transient image views doesn't evict the
+// buffers and pipelines a command buffer keeps unwrapping.
+extern std::array<std::atomic<uint64_t>, kVulkanObjectTypeMax> unwrap_cache_generations;
+extern std::atomic<uint64_t> unwrap_cache_hits;
+extern std::atomic<uint64_t> unwrap_cache_misses;
+
+// The unwrap_cache_generations entry a handle type uses. Without typesafe handles every non-dispatchable handle is a
+// uint64_t, so they all share the kVulkanObjectTypeUnknown generation.
+template <typename HandleType>
+constexpr VulkanObjectType UnwrapCacheType() {
+#ifdef TYPESAFE_NONDISPATCHABLE_HANDLES
+    return VkHandleInfo<HandleType>::kVulkanObjectType;
+#else
+    return kVulkanObjectTypeUnknown;
+#endif
+}
+
+class UniqueIdMapping : public unique_id_map_type {
+  public:
+    // type is the UnwrapCacheType() of the handle
+    size_t erase(const uint64_t &key, VulkanObjectType type) {
+        const size_t erased = unique_id_map_type::erase(key);
+        if (erased) {
+            unwrap_cache_generations[type].fetch_add(1);
+        }
+        return erased;
+    }
+
+    FindResult pop(const uint64_t &key, VulkanObjectType type) {
+        auto ret = unique_id_map_type::pop(key);
+        if (ret != end()) {
+            unwrap_cache_generations[type].fetch_add(1);
+        }
+        return ret;
+    }
+
+    void clear() {
+        unique_id_map_type::clear();
+        for (auto &generation : unwrap_cache_generations) {
+            generation.fetch_add(1);
+        }
+    }
+};
+extern UniqueIdMapping unique_id_mapping;
+
+// Direct-mapped, per-thread cache in front of unique_id_mapping.
+// Recording a command buffer unwraps the same buffers, pipelines and descriptor sets over and over, so most lookups
+// are served from here without touching the shared map. Each entry remembers the handle type and the generation of
+// that type it was filled under, and is ignored once a handle of that type has been destroyed since.
+class UnwrapCache {
+  public:
+    // Returns 0 if the handle is unknown
+    static uint64_t Unwrap(uint64_t wrapped_handle, VulkanObjectType type) {
+        thread_local UnwrapCache cache;
+        return cache.Lookup(wrapped_handle, type);
+    }
+
+    ~UnwrapCache() { FlushCounters(); }
+
+  private:
+    static constexpr uint64_t kEntryCount = 256;
+    static constexpr uint32_t kCounterFlushInterval = 4096;
+
+    struct Entry {
+        uint64_t wrapped = 0;
+        uint64_t unwrapped = 0;
+        uint64_t generation = 0;
+        VulkanObjectType type = kVulkanObjectTypeUnknown;
+    };
+
+    uint64_t Lookup(uint64_t wrapped_handle, VulkanObjectType type) {
+        // Sample the generation before the map lookup, so that a handle removed concurrently is never cached as valid
+        const uint64_t generation = unwrap_cache_generations[type].load(std::memory_order_acquire);
+        // The low bits of a unique id are the global_unique_id counter, so recently created handles don't collide
+        Entry &entry = entries_[wrapped_handle & (kEntryCount - 1)];
+        if (entry.wrapped == wrapped_handle && entry.type == type && entry.generation == generation) {
+            ++hits_;
+            CountLookup();
+            return entry.unwrapped;
+        }
+        ++misses_;
+        CountLookup();
+        auto iter = unique_id_mapping.find(wrapped_handle);
+        if (iter == unique_id_mapping.end()) {
+            return 0;
+        }
+        entry.wrapped = wrapped_handle;
+        entry.unwrapped = iter->second;
+        entry.generation = generation;
+        entry.type = type;
+        return iter->second;
+    }
+
+    // The global counters are only updated every so often to keep them off the hot path
+    void CountLookup() {
+        if (++pending_ == kCounterFlushInterval) {
+            FlushCounters();
+        }
+    }
+    void FlushCounters() {
+        unwrap_cache_hits.fetch_add(hits_, std::memory_order_relaxed);
+        unwrap_cache_misses.fetch_add(misses_, std::memory_order_relaxed);
+        hits_ = misses_ = 0;
+        pending_ = 0;
+    }
+
+    std::array<Entry, kEntryCount> entries_{};
+    uint64_t hits_ = 0;
+    uint64_t misses_ = 0;
+    uint32_t pending_ = 0;
+};
 
 
 VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetPhysicalDeviceProcAddr(
@@ -346,6 +473,12 @@ class ValidationObject {
         CHECK_DISABLED disabled = {};
         CHECK_ENABLED enabled = {};
         bool fine_grained_locking{true};
+        // Report cache and memory statistics as info messages at vkDestroyDevice
+        bool report_stats{false};
+        // Queue operations that may wait for asynchronous synchronization validation, 0 validates them inline
+        uint32_t syncval_async_backlog{0};
+        // Worker threads splitting queue submit synchronization validation by address range, 0 validates on the submit thread
+        uint32_t syncval_submit_threads{0};
 
         VkInstance instance = VK_NULL_HANDLE;
         VkPhysicalDevice physical_device = VK_NULL_HANDLE;
@@ -376,6 +509,15 @@ class ValidationObject {
             return WriteLockGuard(validation_object_mutex);
         }
 
+        // Set by InitObjectDispatchVectors() from HasLockFreeCmdHooks(). vkCmd* intercepts then skip the virtual lock calls
+        // for these objects.
+        bool lock_free_cmd_hooks = false;
+        // By default an object's command buffer hooks are lock-free when its ReadLock()/WriteLock() hand back deferred guards
+        // because it does its own locking. Objects can override this to only elide the lock for vkCmd* hooks.
+        virtual bool HasLockFreeCmdHooks() { return !ReadLock().owns_lock() && !WriteLock().owns_lock(); }
+        ReadLockGuard CmdReadLock() const { return lock_free_cmd_hooks ? ReadLockGuard() : ReadLock(); }
+        WriteLockGuard CmdWriteLock() { return lock_free_cmd_hooks ? WriteLockGuard() : WriteLock(); }
+
         ValidationObject* GetValidationObject(std::vector<ValidationObject*>& object_dispatch, LayerObjectTypeId object_type) {
             for (auto validation_object : object_dispatch) {
                 if (validation_object->container_type == object_type) {
@@ -426,6 +568,44 @@ class ValidationObject {
             return result;
         }
 
+        // Deferred formatting variants: format_message() returns the message as a std::string and is only invoked
+        // once the message has passed the severity, filter and duplicate checks, so the FormatHandle() and
+        // stringstream work in it is skipped for messages that nobody will see.
+        template <typename Formatter>
+        bool LogErrorDeferred(const LogObjectList &objlist, std::string_view vuid_text, Formatter &&format_message) const {
+            return LogMsgDeferred(kErrorBit, objlist, vuid_text, std::forward<Formatter>(format_message));
+        }
+
+        template <typename Formatter>
+        bool LogWarningDeferred(const LogObjectList &objlist, std::string_view vuid_text, Formatter &&format_message) const {
+            return LogMsgDeferred(kWarningBit, objlist, vuid_text, std::forward<Formatter>(format_message));
+        }
+
+        template <typename Formatter>
+        bool LogPerformanceWarningDeferred(const LogObjectList &objlist, std::string_view vuid_text,
+                                           Formatter &&format_message) const {
+            return LogMsgDeferred(kPerformanceWarningBit, objlist, vuid_text, std::forward<Formatter>(format_message));
+        }
+
+        template <typename Formatter>
+        bool LogMsgDeferred(VkFlags msg_flags, const LogObjectList &objlist, std::string_view vuid_text,
+                            Formatter &&format_message) const {
+            if (!LogMsgEnabled(report_data, msg_flags, vuid_text)) {
+                return false;
+            }
+            return LogMsgText(report_data, msg_flags, objlist, vuid_text, format_message());
+        }
+
+        // printf-style helper for building the message inside a Log*Deferred() formatter
+        static std::string DECORATE_PRINTF(1, 2) FormatString(const char *format, ...) {
+            std::string message;
+            va_list argptr;
+            va_start(argptr, format);
+            FormatLogMessage(message, format, argptr);
+            va_end(argptr);
+            return message;
+        }
+
         void LogInternalError(std::string_view failure_location, const LogObjectList &obj_list,
                               std::string_view entrypoint, VkResult err) const {
             const std::string_view err_string = string_VkResult(err);
@@ -457,10 +637,7 @@ class ValidationObject {
         template <typename HandleType>
         HandleType Unwrap(HandleType wrappedHandle) {
             if (wrappedHandle == (HandleType)VK_NULL_HANDLE) return wrappedHandle;
-            auto iter = unique_id_mapping.find(CastToUint64(wrappedHandle));
-            if (iter == unique_id_mapping.end())
-                return (HandleType)0;
-            return (HandleType)iter->second;
+            return (HandleType)UnwrapCache::Unwrap(CastToUint64(wrappedHandle), UnwrapCacheType<HandleType>());
         }
 
         // Wrap a newly created handle with a new unique ID, and return the new ID.
@@ -534,7 +711,10 @@ small_unordered_map<void*, ValidationObject*, 2> layer_data_map;
 std::atomic<uint64_t> global_unique_id(1ULL);
 // Map uniqueID to actual object handle. Accesses to the map itself are
 // internally synchronized.
-vl_concurrent_unordered_map<uint64_t, uint64_t, 4, HashedUint64> unique_id_mapping;
+UniqueIdMapping unique_id_mapping;
+std::array<std::atomic<uint64_t>, kVulkanObjectTypeMax> unwrap_cache_generations{};
+std::atomic<uint64_t> unwrap_cache_hits(0);
+std::atomic<uint64_t> unwrap_cache_misses(0);
 
 bool wrap_handles = true;
 
@@ -748,8 +928,12 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     CHECK_ENABLED local_enables {};
     CHECK_DISABLED local_disables {};
     bool lock_setting;
+    bool stats_setting;
+    uint32_t async_backlog_setting = 0;
+    uint32_t submit_threads_setting = 0;
     ConfigAndEnvSettings config_and_env_settings_data {OBJECT_LAYER_DESCRIPTION, pCreateInfo->pNext, local_enables, local_disables,
-        report_data->filter_message_ids, &report_data->duplicate_message_limit, &lock_setting};
+        report_data->filter_message_ids, &report_data->duplicate_message_limit, &lock_setting, &stats_setting,
+        &async_backlog_setting, &submit_threads_setting};
     ProcessConfigAndEnvSettings(&config_and_env_settings_data);
     layer_debug_messenger_actions(report_data, OBJECT_LAYER_DESCRIPTION);
 
@@ -804,6 +988,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
     framework->disabled = local_disables;
     framework->enabled = local_enables;
     framework->fine_grained_locking = lock_setting;
+    framework->report_stats = stats_setting;
+    framework->syncval_async_backlog = async_backlog_setting;
+    framework->syncval_submit_threads = submit_threads_setting;
 
     framework->instance = *pInstance;
     layer_init_instance_dispatch_table(*pInstance, &framework->instance_dispatch_table, fpGetInstanceProcAddr);
@@ -822,6 +1009,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreat
         intercept->enabled = framework->enabled;
         intercept->disabled = framework->disabled;
         intercept->fine_grained_locking = framework->fine_grained_locking;
+        intercept->report_stats = framework->report_stats;
+        intercept->syncval_async_backlog = framework->syncval_async_backlog;
+        intercept->syncval_submit_threads = framework->syncval_submit_threads;
         intercept->instance = *pInstance;
     }
 
@@ -927,6 +1117,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
     device_interceptor->physical_device = gpu;
     device_interceptor->instance = instance_interceptor->instance;
     device_interceptor->report_data = instance_interceptor->report_data;
+    device_interceptor->report_stats = instance_interceptor->report_stats;
+    device_interceptor->syncval_async_backlog = instance_interceptor->syncval_async_backlog;
+    device_interceptor->syncval_submit_threads = instance_interceptor->syncval_submit_threads;
 
     InitDeviceObjectDispatch(instance_interceptor, device_interceptor);
 
@@ -941,6 +1134,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
         object->disabled = instance_interceptor->disabled;
         object->enabled = instance_interceptor->enabled;
         object->fine_grained_locking = instance_interceptor->fine_grained_locking;
+        object->report_stats = instance_interceptor->report_stats;
+        object->syncval_async_backlog = instance_interceptor->syncval_async_backlog;
+        object->syncval_submit_threads = instance_interceptor->syncval_submit_threads;
         object->instance_dispatch_table = instance_interceptor->instance_dispatch_table;
         object->instance_extensions = instance_interceptor->instance_extensions;
         object->device_extensions = device_interceptor->device_extensions;
@@ -975,6 +1171,15 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
         intercept->PreCallRecordDestroyDevice(device, pAllocator);
     }
 
+    if (wrap_handles && layer_data->report_stats) {
+        // Totals are for all devices and threads, and don't include lookups not yet flushed by live threads
+        layer_data->LogInfo(device, "UNASSIGNED-DestroyDevice-unwrap-cache-stats",
+                            "Handle unwrap cache: %" PRIu64 " hits, %" PRIu64 " misses.", unwrap_cache_hits.load(),
+                            unwrap_cache_misses.load());
+    }
+
+    // The device's command pools are destroyed with it
+    EraseDeviceCmdDebugUtilsLabels(layer_data->report_data, device);
     layer_data->device_dispatch_table.DestroyDevice(device, pAllocator);
 
     """ + postcallrecord_loop + """
@@ -1775,6 +1980,10 @@ VVL_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateDeviceExtensionProperties(V
             helper_content += self.genInitObjectDispatchVector()
             helper_content += '\n\n'
             helper_content += '    intercept_vectors.resize(InterceptIdCount);\n\n'
+            helper_content += '    for (auto item : this->object_dispatch) {\n'
+            helper_content += '        // Locking policy is fixed once fine_grained_locking is known, which is before this is called\n'
+            helper_content += '        item->lock_free_cmd_hooks = item->HasLockFreeCmdHooks();\n'
+            helper_content += '    }\n\n'
             helper_content += self.dispatch_vector_fcns;
             helper_content += '};\n'
             write(helper_content, file=self.outFile)
@@ -1956,13 +2165,16 @@ VVL_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateDeviceExtensionProperties(V
 
             # Set up skip and locking
             self.appendSection('command', '    bool skip = false;')
+            # Command buffer intercepts are the hot path, skip the virtual lock calls for objects that don't need them
+            read_lock = 'CmdReadLock' if api_function_name.startswith('vkCmd') else 'ReadLock'
+            write_lock = 'CmdWriteLock' if api_function_name.startswith('vkCmd') else 'WriteLock'
 
             # Generate pre-call validation source code
             if dispatchable_type != 'VkInstance' and dispatchable_type != 'VkPhysicalDevice':
                 self.appendSection('command', '    for (const ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallValidate%s]) {' % api_function_name[2:])
             else:
                 self.appendSection('command', '    for (const ValidationObject* intercept : layer_data->object_dispatch) {')
-            self.appendSection('command', '        auto lock = intercept->ReadLock();')
+            self.appendSection('command', '        auto lock = intercept->%s();' % read_lock)
             self.appendSection('command', '        skip |= intercept->PreCallValidate%s(%s);' % (api_function_name[2:], paramstext))
             self.appendSection('command', '        if (skip) %s' % return_map[resulttype.text])
             self.appendSection('command', '    }')
@@ -1972,7 +2184,7 @@ VVL_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateDeviceExtensionProperties(V
                 self.appendSection('command', '    for (ValidationObject* intercept : layer_data->intercept_vectors[InterceptIdPreCallRecord%s]) {' % api_function_name[2:])
             else:
                 self.appendSection('command', '    for (ValidationObject* intercept : layer_data->object_dispatch) {')
-            self.appendSection('command', '        auto lock = intercept->WriteLock();')
+            self.appendSection('command', '        auto lock = intercept->%s();' % write_lock)
             self.appendSection('command', '        intercept->PreCallRecord%s(%s);' % (api_function_name[2:], paramstext))
             self.appendSection('command', '    }')
 
@@ -1995,7 +2207,7 @@ VVL_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateDeviceExtensionProperties(V
             returnparam = ''
             if (resulttype.text == 'VkResult' or resulttype.text == 'VkDeviceAddress'):
                 returnparam = ', result'
-            self.appendSection('command', '        auto lock = intercept->WriteLock();')
+            self.appendSection('command', '        auto lock = intercept->%s();' % write_lock)
             self.appendSection('command', '        intercept->PostCallRecord%s(%s%s);' % (api_function_name[2:], paramstext, returnparam))
             self.appendSection('command', '    }')
             # Return result variable, if any.
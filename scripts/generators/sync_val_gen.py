@@ -684,7 +684,7 @@ def StageAccessEnums(stage_accesses, config):
     # The stage/access combinations as bit mask
     output.append('// Unique bit for each  stage/access combination')
     if not config['is_source']:
-        output.extend([ '{}static const {} {} = ({}(1) << {});'.format('', sync_mask_name, e['stage_access_bit'], sync_mask_name, e['stage_access'])  for e in stage_accesses if e['stage_access_bit'] is not None])
+        output.extend([ '{}static constexpr {} {} = ({}(1) << {});'.format('', sync_mask_name, e['stage_access_bit'], sync_mask_name, e['stage_access'])  for e in stage_accesses if e['stage_access_bit'] is not None])
     output.append('')
 
     map_name = var_prefix + 'StageAccessIndexByStageAccessBit'
@@ -848,7 +848,7 @@ def StageAccessCrossReference(enum_in_bit_order, stage_access_combinations, conf
 def GenerateStaticMask(name, desc, bits, config):
     sep = ' |\n' + config['indent']
     if not config['is_source']:
-        variable_format = 'static const {sync_mask_name} {var_prefix}StageAccess{}Mask = ( //  {}'
+        variable_format = 'static constexpr {sync_mask_name} {var_prefix}StageAccess{}Mask = ( //  {}'
         output = [variable_format.format(name, desc, **config)]
         output.append(config['indent'] + sep.join([b for b in bits if b is not None]))
         output.extend([');', ''])
@@ -922,7 +922,6 @@ def GenSyncTypeHelper(gen, is_source) :
         'type_prefix': 'Sync',
         'enum_prefix': 'SYNC_',
         'indent': '    ',
-        'sync_mask_base_type': 'std::bitset<128>',
         'vk_stage_flags': 'VkPipelineStageFlags2',
         'vk_stage_bits': 'VkPipelineStageFlags2',
         'vk_access_flags': 'VkAccessFlags2',
@@ -937,9 +936,8 @@ def GenSyncTypeHelper(gen, is_source) :
     if config['is_source']:
         lines.extend(('#include "sync_validation_types.h"', ''))
     else:
-        lines.extend(('#pragma once', '', '#include <array>', '#include <bitset>', '#include <map>', '#include <stdint.h>', '#include <vulkan/vulkan.h>',
-                 '#include "containers/custom_containers.h"'))
-        lines.extend(('using {} = {};'.format(config['sync_mask_name'], config['sync_mask_base_type']), ''))
+        lines.extend(('#pragma once', '', '#include <array>', '#include <map>', '#include <stdint.h>', '#include <vulkan/vulkan.h>',
+                 '#include "containers/custom_containers.h"', '#include "sync/sync_access_flags.h"', ''))
     lines.extend(['// clang-format off', ''])
 
     if not config['is_source']:
@@ -3531,7 +3531,7 @@ void VkLayerTest::OOBRayTracingShadersTestBody(bool gpu_assisted) {
     }
 }
 
-void VkSyncValTest::InitSyncValFramework(bool enable_queue_submit_validation) {
+void VkSyncValTest::InitSyncValFramework(bool enable_queue_submit_validation, uint32_t async_backlog, uint32_t submit_threads) {
     // Enable synchronization validation
 
     // Optional feature definition, add if requested (but they can't be defined at the conditional scope)
@@ -3539,9 +3539,22 @@ void VkSyncValTest::InitSyncValFramework(bool enable_queue_submit_validation) {
     VkLayerSettingValueDataEXT qs_setting_string_value{};
     qs_setting_string_value.arrayString.pCharArray = kEnableQueuSubmitSyncValidation;
     qs_setting_string_value.arrayString.count = strlen(qs_setting_string_value.arrayString.pCharArray);
-    VkLayerSettingValueEXT qs_enable_setting_val = {"enables", VK_LAYER_SETTING_VALUE_TYPE_STRING_ARRAY_EXT,
-                                                    qs_setting_string_value};
-    VkLayerSettingsEXT qs_settings{VK_STRUCTURE_TYPE_INSTANCE_LAYER_SETTINGS_EXT, nullptr, 1, &qs_enable_setting_val};
+    VkLayerSettingValueDataEXT async_backlog_value{};
+    async_backlog_value.value32 = async_backlog;
+    VkLayerSettingValueDataEXT submit_threads_value{};
+    submit_threads_value.value32 = submit_threads;
+    VkLayerSettingValueEXT qs_setting_vals[3] = {
+        {"enables", VK_LAYER_SETTING_VALUE_TYPE_STRING_ARRAY_EXT, qs_setting_string_value}};
+    uint32_t qs_setting_count = 1;
+    if (async_backlog) {
+        qs_setting_vals[qs_setting_count++] = {"syncval_async_backlog", VK_LAYER_SETTING_VALUE_TYPE_UINT32_EXT,
+                                               async_backlog_value};
+    }
+    if (submit_threads) {
+        qs_setting_vals[qs_setting_count++] = {"syncval_submit_threads", VK_LAYER_SETTING_VALUE_TYPE_UINT32_EXT,
+                                               submit_threads_value};
+    }
+    VkLayerSettingsEXT qs_settings{VK_STRUCTURE_TYPE_INSTANCE_LAYER_SETTINGS_EXT, nullptr, qs_setting_count, qs_setting_vals};
 
     if (enable_queue_submit_validation) {
         features_.pNext = &qs_settings;
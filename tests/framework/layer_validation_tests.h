@@ -561,7 +561,7 @@ class NegativeDebugPrintf : public VkLayerTest {
 
 class VkSyncValTest : public VkLayerTest {
   public:
-    void InitSyncValFramework(bool enable_queue_submit_validation = false);
+    void InitSyncValFramework(bool enable_queue_submit_validation = false, uint32_t async_backlog = 0, uint32_t submit_threads = 0);
 
   protected:
     VkValidationFeatureEnableEXT enables_[1] = {VK_VALIDATION_FEATURE_ENABLE_SYNCHRONIZATION_VALIDATION_EXT};
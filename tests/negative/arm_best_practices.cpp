@@ -425,6 +425,51 @@ TEST_F(VkArmBestPracticesLayerTest, SparseIndexBufferTest) {
     test_pipelines(sparse_ibo, sparse_indices.size(), true);
 }
 
+TEST_F(VkArmBestPracticesLayerTest, SparseIndexBufferRewritten) {
+    TEST_DESCRIPTION("Index buffer scans are cached, rewriting the mapped index data must not reuse the earlier result.");
+
+    InitBestPracticesFramework(kEnableArmValidation);
+    InitState();
+    ASSERT_NO_FATAL_FAILURE(InitViewport());
+    ASSERT_NO_FATAL_FAILURE(InitRenderTarget());
+
+    if (IsPlatform(kMockICD)) {
+        GTEST_SKIP() << "Test not supported by MockICD";
+    }
+
+    std::vector<uint16_t> indices(128);
+    std::generate(indices.begin(), indices.end(), [n = 0]() mutable { return ++n; });
+    VkConstantBufferObj ibo(m_device, indices.size() * sizeof(uint16_t), indices.data(), VK_BUFFER_USAGE_INDEX_BUFFER_BIT);
+
+    CreatePipelineHelper pipe(*this);
+    pipe.InitInfo();
+    pipe.InitState();
+    pipe.CreateGraphicsPipeline();
+
+    m_commandBuffer->begin();
+    m_commandBuffer->BeginRenderPass(m_renderPassBeginInfo);
+    vk::CmdBindPipeline(m_commandBuffer->handle(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_);
+    m_commandBuffer->BindIndexBuffer(&ibo, static_cast<VkDeviceSize>(0), VK_INDEX_TYPE_UINT16);
+
+    // Dense indices, scanned and cached
+    ibo.memory().map();
+    m_commandBuffer->DrawIndexed(indices.size(), 1, 0, 0, 0);
+    m_commandBuffer->DrawIndexed(indices.size(), 1, 0, 0, 0);
+    ibo.memory().unmap();
+
+    // Same range, now sparse.  Mapping again invalidates the cached scan.
+    auto* data = static_cast<uint16_t*>(ibo.memory().map());
+    data[indices.size() - 1] = 0xFFFF;
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_PERFORMANCE_WARNING_BIT_EXT,
+                                         "UNASSIGNED-BestPractices-vkCmdDrawIndexed-sparse-index-buffer");
+    m_commandBuffer->DrawIndexed(indices.size(), 1, 0, 0, 0);
+    m_errorMonitor->VerifyFound();
+    ibo.memory().unmap();
+
+    m_commandBuffer->EndRenderPass();
+    m_commandBuffer->end();
+}
+
 TEST_F(VkArmBestPracticesLayerTest, PostTransformVertexCacheThrashingIndicesTest) {
     TEST_DESCRIPTION(
         "Test for appropriate warnings to be thrown when recording an indexed draw call where the indices thrash the "
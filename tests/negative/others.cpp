@@ -3041,6 +3041,33 @@ TEST_F(VkLayerTest, DuplicateValidPNextStructures) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(VkLayerTest, CyclicPNextChain) {
+    TEST_DESCRIPTION("Create a pNext chain that loops back on itself, which must be reported instead of walked forever");
+
+    SetTargetApiVersion(VK_API_VERSION_1_2);
+    ASSERT_NO_FATAL_FAILURE(InitFramework(m_errorMonitor));
+    if (DeviceValidationVersion() < VK_API_VERSION_1_2) {
+        GTEST_SKIP() << "At least Vulkan version 1.2 is required";
+    }
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    // A -> B -> A, both structures are valid in the chain so only the cycle is reported
+    auto external_memory_info = LvlInitStruct<VkExternalMemoryBufferCreateInfo>();
+    auto capture_address_info = LvlInitStruct<VkBufferOpaqueCaptureAddressCreateInfo>(&external_memory_info);
+    external_memory_info.pNext = &capture_address_info;
+
+    auto buffer_ci = LvlInitStruct<VkBufferCreateInfo>(&external_memory_info);
+    buffer_ci.size = 256;
+    buffer_ci.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+    buffer_ci.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+    // The call is skipped, so the driver never walks the chain
+    VkBuffer buffer = VK_NULL_HANDLE;
+    m_errorMonitor->SetDesiredFailureMsg(kErrorBit, "VUID-VkBufferCreateInfo-pNext-pNext");
+    vk::CreateBuffer(device(), &buffer_ci, nullptr, &buffer);
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(VkLayerTest, DeviceCommonParent) {
     TEST_DESCRIPTION("Test VUID-*-commonparent checks not sharing the same Device");
 
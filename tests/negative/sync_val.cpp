@@ -4691,6 +4691,97 @@ TEST_F(NegativeSyncVal, QSBufferCopyHazards) {
     test.DeviceWait();
 }
 
+TEST_F(NegativeSyncVal, QSBufferCopyHazardsAsync) {
+    TEST_DESCRIPTION("QueueSubmit hazards found on the syncval_async_backlog thread are reported once validation is drained.");
+    ASSERT_NO_FATAL_FAILURE(InitSyncValFramework(true, 4));  // Enable asynchronous QueueSubmit validation
+    ASSERT_NO_FATAL_FAILURE(InitState(nullptr, nullptr, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT));
+
+    QSTestContext test(m_device, m_device->m_queue_obj);
+    if (!test.Valid()) {
+        GTEST_SKIP() << "Test requires a valid queue object.";
+    }
+
+    test.RecordCopy(test.cba, test.buffer_a, test.buffer_b);
+    test.RecordCopy(test.cbb, test.buffer_c, test.buffer_a);
+
+    // The hazard is reported from the worker thread, vkDeviceWaitIdle waits for it to finish validating
+    auto submit1 = LvlInitStruct<VkSubmitInfo>();
+    submit1.commandBufferCount = 2;
+    VkCommandBuffer two_cbs[2] = {test.h_cba, test.h_cbb};
+    submit1.pCommandBuffers = two_cbs;
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "SYNC-HAZARD-WRITE-AFTER-READ");
+    vk::QueueSubmit(test.q0, 1, &submit1, VK_NULL_HANDLE);
+    test.DeviceWait();
+    m_errorMonitor->VerifyFound();
+
+    // Asynchronous validation can't skip, so the state is recorded and the wait idle cleared it.  Across submits the earlier
+    // one must be recorded before the later one is validated.
+    test.Submit0(test.cba);
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "SYNC-HAZARD-WRITE-AFTER-READ");
+    test.Submit0(test.cbb);
+    test.DeviceWait();
+    m_errorMonitor->VerifyFound();
+
+    // With a barrier there is nothing to report
+    test.BeginB();
+    test.TransferBarrierWAR(test.buffer_a);
+    test.Copy(test.buffer_c, test.buffer_a);
+    test.End();
+    test.Submit0(test.cba);
+    test.Submit0(test.cbb);
+    test.DeviceWait();
+}
+
+TEST_F(NegativeSyncVal, QSBufferFillHazardsPartitioned) {
+    TEST_DESCRIPTION("QueueSubmit validation split across syncval_submit_threads reports the hazard the serial walk finds first.");
+    ASSERT_NO_FATAL_FAILURE(InitSyncValFramework(true, 0, 4));  // Enable QueueSubmit validation on 4 worker threads
+    ASSERT_NO_FATAL_FAILURE(InitState(nullptr, nullptr, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT));
+
+    QSTestContext test(m_device, m_device->m_queue_obj);
+    if (!test.Valid()) {
+        GTEST_SKIP() << "Test requires a valid queue object.";
+    }
+
+    // Each fill is its own range, more than two partitions of AccessContext::kFirstUsePartitionSize (256) ranges
+    constexpr VkDeviceSize kRangeCount = 600;
+    constexpr VkDeviceSize kStride = 16;
+    constexpr VkDeviceSize kReadRange = 300;   // in the second partition
+    constexpr VkDeviceSize kWriteRange = 550;  // in the third partition
+    VkBufferObj buffer;
+    VkBufferObj read_dst;
+    buffer.init_as_src_and_dst(*m_device, kRangeCount * kStride, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    read_dst.init_as_src_and_dst(*m_device, kStride, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+    test.BeginB();
+    for (VkDeviceSize range = 0; range < kRangeCount; ++range) {
+        vk::CmdFillBuffer(test.current_cb->handle(), buffer.handle(), range * kStride, sizeof(uint32_t), 0);
+    }
+    test.End();
+
+    // The earlier submit reads one range and writes a later one. The serial walk stops at the read. A worker may find the write
+    // before another finds the read, but only the hazard of the lowest partition is reported.
+    const VkBufferCopy read_region = {kReadRange * kStride, 0, sizeof(uint32_t)};
+    test.BeginA();
+    test.Copy(buffer, read_dst, read_region);
+    vk::CmdFillBuffer(test.current_cb->handle(), buffer.handle(), kWriteRange * kStride, sizeof(uint32_t), 1);
+    test.End();
+    test.Submit0(test.cba);
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "SYNC-HAZARD-WRITE-AFTER-READ");
+    test.Submit0(test.cbb);
+    m_errorMonitor->VerifyFound();
+    test.DeviceWait();
+
+    // Without the read the write in the third partition is the first hazard
+    test.BeginA();
+    vk::CmdFillBuffer(test.current_cb->handle(), buffer.handle(), kWriteRange * kStride, sizeof(uint32_t), 1);
+    test.End();
+    test.Submit0(test.cba);
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "SYNC-HAZARD-WRITE-AFTER-WRITE");
+    test.Submit0(test.cbb);
+    m_errorMonitor->VerifyFound();
+    test.DeviceWait();
+}
+
 TEST_F(NegativeSyncVal, QSSubmit2) {
     SetTargetApiVersion(VK_API_VERSION_1_3);
     ASSERT_NO_FATAL_FAILURE(InitSyncValFramework(true));  // Enable QueueSubmit validation
@@ -13,6 +13,22 @@
 #include "../framework/layer_validation_tests.h"
 #include "generated/vk_extension_helper.h"
 #include "utils/vk_layer_utils.h"
+#include "utils/validation_cache.h"
+#include "utils/cast_utils.h"
+#include "generated/sync_validation_types.h"
+#include "containers/range_vector.h"
+#include "sync/sync_utils.h"
+#include "best_practices/bp_index_scan.h"
+#include "error_message/binary_log.h"
+#include "error_message/logging.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <thread>
 
 class PositiveLayerUtils : public VkPositiveLayerTest {};
 
@@ -198,3 +214,1105 @@ TEST_F(PositiveLayerUtils, IsImageLayoutStencilOnly) {
         ASSERT_FALSE(IsImageLayoutStencilOnly(layout));
     }
 }
+
+TEST_F(PositiveLayerUtils, LockFreeMap) {
+    TEST_DESCRIPTION("Test the vl_concurrent_lockfree_map operations, including growing and tombstone reuse");
+
+    vl_concurrent_lockfree_map<uint64_t, uint64_t> map;
+    ASSERT_TRUE(map.empty());
+
+    for (uint64_t i = 1; i <= 1000; ++i) {
+        ASSERT_TRUE(map.insert(i, i * 2));
+    }
+    ASSERT_FALSE(map.insert(1, 7));
+    ASSERT_TRUE(map.size() == 1000);
+
+    map.insert_or_assign(1, 7);
+    ASSERT_TRUE(map.find(1)->second == 7);
+    ASSERT_TRUE(map.find(1001) == map.end());
+
+    for (uint64_t i = 2; i <= 1000; i += 2) {
+        ASSERT_TRUE(map.erase(i) == 1);
+    }
+    ASSERT_TRUE(map.erase(2) == 0);
+    ASSERT_TRUE(map.size() == 500);
+    ASSERT_FALSE(map.contains(500));
+    ASSERT_TRUE(map.contains(501));
+
+    auto popped = map.pop(3);
+    ASSERT_TRUE(popped != map.end());
+    ASSERT_TRUE(popped->second == 6);
+    ASSERT_FALSE(map.contains(3));
+
+    // Churn through enough inserts and erases that the tombstones force rehashes
+    for (uint64_t i = 2000; i < 20000; ++i) {
+        map.insert(i, i);
+        map.erase(i);
+    }
+    ASSERT_TRUE(map.size() == 499);
+    ASSERT_TRUE(map.snapshot().size() == 499);
+    ASSERT_TRUE(map.snapshot([](uint64_t value) { return value == 7; }).size() == 1);
+
+    map.clear();
+    ASSERT_TRUE(map.empty());
+    ASSERT_FALSE(map.contains(1));
+}
+
+TEST_F(PositiveLayerUtils, LockFreeMapConcurrentLookup) {
+    TEST_DESCRIPTION("Look up stable keys from several threads while another thread inserts and erases (forcing rehashes)");
+
+    vl_concurrent_lockfree_map<uint64_t, uint64_t> map;
+    constexpr uint64_t kStableKeys = 256;
+    for (uint64_t i = 1; i <= kStableKeys; ++i) {
+        map.insert(i, i + 1);
+    }
+
+    std::atomic<bool> done{false};
+    std::atomic<uint32_t> mismatches{0};
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([&]() {
+            while (!done.load()) {
+                for (uint64_t i = 1; i <= kStableKeys; ++i) {
+                    auto found = map.find(i);
+                    if (found == map.end() || found->second != i + 1) {
+                        mismatches++;
+                    }
+                }
+            }
+        });
+    }
+
+    for (uint64_t i = kStableKeys + 1; i < kStableKeys + 4096; ++i) {
+        map.insert(i, i);
+    }
+    for (uint64_t i = kStableKeys + 1; i < kStableKeys + 4096; ++i) {
+        map.erase(i);
+    }
+    done = true;
+    for (auto &reader : readers) {
+        reader.join();
+    }
+
+    ASSERT_TRUE(mismatches.load() == 0);
+    ASSERT_TRUE(map.size() == kStableKeys);
+}
+
+TEST_F(PositiveLayerUtils, LockFreeMapReservedKeys) {
+    TEST_DESCRIPTION("Null handles are valid lookups in the lock-free handle maps, and must not match empty or erased slots");
+
+    vl_concurrent_lockfree_map<uint64_t, uint64_t> map;
+    constexpr uint64_t kTombstone = ~uint64_t(0);
+    ASSERT_TRUE(map.find(0) == map.end());
+    ASSERT_FALSE(map.contains(0));
+    ASSERT_TRUE(map.pop(0) == map.end());
+    ASSERT_TRUE(map.erase(0) == 0);
+    ASSERT_FALSE(map.insert(0, 1));
+    ASSERT_FALSE(map.insert(kTombstone, 1));
+    map.insert_or_assign(0, 1);
+    ASSERT_TRUE(map.empty());
+
+    // Leave a tombstone behind, then look the reserved keys up again
+    ASSERT_TRUE(map.insert(1, 2));
+    ASSERT_TRUE(map.erase(1) == 1);
+    ASSERT_FALSE(map.contains(kTombstone));
+    ASSERT_TRUE(map.pop(kTombstone) == map.end());
+    ASSERT_TRUE(map.erase(kTombstone) == 0);
+    ASSERT_TRUE(map.size() == 0);
+
+    // The same lookups through the layer: unique_id_mapping and the object tracker tables
+    ASSERT_NO_FATAL_FAILURE(Init());
+    vk::DestroyBuffer(m_device->device(), VK_NULL_HANDLE, nullptr);
+    vk::DestroyImage(m_device->device(), VK_NULL_HANDLE, nullptr);
+    vk::DestroySampler(m_device->device(), VK_NULL_HANDLE, nullptr);
+    vk::DestroyCommandPool(m_device->device(), VK_NULL_HANDLE, nullptr);
+    vk::DestroyFence(m_device->device(), VK_NULL_HANDLE, nullptr);
+
+    vk_testing::Buffer buffer(*m_device, 64);
+    vk::DestroyBuffer(m_device->device(), VK_NULL_HANDLE, nullptr);
+}
+
+TEST_F(PositiveLayerUtils, SyncStageAccessFlags) {
+    TEST_DESCRIPTION("Check the 128 bit stage/access mask against bits on both sides of the word boundary");
+
+    static_assert(SyncStageAccessFlags::size() == 128, "SyncStageAccessFlags must hold 128 bits");
+    static_assert(SyncStageAccessFlags::Bit(SYNC_ACCESS_INDEX_NONE) == (SyncStageAccessFlags(1) << SYNC_ACCESS_INDEX_NONE),
+                  "Bit() and shift must agree");
+
+    SyncStageAccessFlags flags;
+    ASSERT_TRUE(flags.none());
+    ASSERT_TRUE(flags == 0);
+
+    for (size_t index : {size_t(0), size_t(63), size_t(64), size_t(127)}) {
+        const SyncStageAccessFlags bit = SyncStageAccessFlags(1) << index;
+        ASSERT_TRUE(bit == SyncStageAccessFlags::Bit(index));
+        ASSERT_TRUE(bit.test(index));
+        ASSERT_TRUE(bit.count() == 1);
+        ASSERT_TRUE((bit >> index) == 1);
+        ASSERT_FALSE(bit.Intersects(~bit));
+        flags.set(index);
+    }
+    ASSERT_TRUE(flags.count() == 4);
+    ASSERT_TRUE(flags.any());
+    ASSERT_TRUE((flags & SyncStageAccessFlags::Bit(64)).test(64));
+    ASSERT_FALSE((flags & SyncStageAccessFlags::Bit(65)).any());
+    ASSERT_TRUE((~flags).count() == 124);
+
+    flags.reset(127);
+    ASSERT_FALSE(flags.test(127));
+    flags.reset();
+    ASSERT_TRUE(flags.none());
+
+    // Every generated stage/access bit must be exactly one of read or write
+    ASSERT_FALSE(syncStageAccessReadMask.Intersects(syncStageAccessWriteMask));
+    for (const auto &info : syncStageAccessInfoByStageAccessIndex()) {
+        if (info.stage_access_index == SYNC_ACCESS_INDEX_NONE) continue;
+        ASSERT_TRUE(info.stage_access_bit.count() == 1);
+        ASSERT_TRUE(info.stage_access_bit.test(info.stage_access_index));
+        ASSERT_TRUE(info.stage_access_bit.Intersects(syncStageAccessReadMask | syncStageAccessWriteMask));
+        ASSERT_TRUE(syncStageAccessIndexByStageAccessBit().at(info.stage_access_bit) == info.stage_access_index);
+    }
+}
+
+TEST_F(PositiveLayerUtils, PooledRangeMap) {
+    TEST_DESCRIPTION("Check that a range_map with pooled nodes behaves the same as the default std::map backed range_map");
+
+    using PlainMap = sparse_container::range_map<uint64_t, int>;
+    using PooledMap = sparse_container::pooled_range_map<uint64_t, int>;
+    using Range = PlainMap::key_type;
+
+    auto same_contents = [](const PlainMap &plain, const PooledMap &pooled) {
+        if (plain.size() != pooled.size()) return false;
+        return std::equal(plain.begin(), plain.end(), pooled.begin(), [](const auto &a, const auto &b) {
+            return (a.first == b.first) && (a.second == b.second);
+        });
+    };
+    auto merge = [](int &current, const int &value) { current += value; };
+
+    std::mt19937 rng(1234);
+    PlainMap plain;
+    PooledMap pooled;
+    for (int i = 0; i < 20000; ++i) {
+        const uint64_t begin = rng() % 1024;
+        const Range range(begin, begin + 1 + rng() % 64);
+        const int value = static_cast<int>(rng() % 16);
+        switch (rng() % 5) {
+            case 0:
+                plain.insert({range, value});
+                pooled.insert({range, value});
+                break;
+            case 1:
+                plain.erase_range(range);
+                pooled.erase_range(range);
+                break;
+            case 2:
+                plain.overwrite_range(std::make_pair(range, value));
+                pooled.overwrite_range(std::make_pair(range, value));
+                break;
+            case 3:
+                plain.split_and_merge_insert({range, value}, merge);
+                pooled.split_and_merge_insert({range, value}, merge);
+                break;
+            default: {
+                // Copies get their own pool, moves and swaps take the pool with them
+                PooledMap copy(pooled);
+                PooledMap assigned;
+                assigned = copy;
+                PooledMap moved(std::move(assigned));
+                std::swap(pooled, moved);
+                break;
+            }
+        }
+        ASSERT_TRUE(same_contents(plain, pooled));
+    }
+
+    // Walk both maps in parallel, as the access context merges do
+    using ParallelIt = sparse_container::parallel_iterator<PooledMap, const PooledMap>;
+    const PooledMap source(pooled);
+    ParallelIt walker(pooled, source, 0);
+    size_t steps = 0;
+    while (walker->range.non_empty()) {
+        ASSERT_TRUE(walker->pos_A->valid == walker->pos_B->valid);
+        ++walker;
+        ++steps;
+    }
+    ASSERT_TRUE(steps >= pooled.size());
+
+    sparse_container::consolidate(plain);
+    sparse_container::consolidate(pooled);
+    ASSERT_TRUE(same_contents(plain, pooled));
+}
+
+TEST_F(PositiveLayerUtils, PooledRangeMapNodePool) {
+    TEST_DESCRIPTION("Check that the node pool is shared by all allocator copies and releases blocks once their nodes are freed");
+
+    // Nodes allocated through one rebound copy can be freed through another after the original is gone
+    std::vector<uint64_t *> nodes;
+    std::unique_ptr<sparse_container::node_pool_allocator<double>> rebound;
+    {
+        sparse_container::node_pool_allocator<int> original;
+        rebound = std::make_unique<sparse_container::node_pool_allocator<double>>(original);
+        sparse_container::node_pool_allocator<uint64_t> node_allocator(original);
+        for (uint64_t i = 0; i < 1000; ++i) {
+            nodes.push_back(node_allocator.allocate(1));
+            *nodes.back() = i;
+        }
+        ASSERT_TRUE(original == *rebound);
+    }
+    sparse_container::node_pool_allocator<uint64_t> other(*rebound);
+    for (uint64_t i = 0; i < nodes.size(); ++i) {
+        ASSERT_TRUE(*nodes[i] == i);
+        other.deallocate(nodes[i], 1);
+    }
+    ASSERT_TRUE(other.pool().reserved_nodes() <= sparse_container::node_pool::kMaxBlockNodes);
+
+    using PooledMap = sparse_container::pooled_range_map<uint64_t, int>;
+    PooledMap pooled;
+    for (uint64_t i = 0; i < 20000; ++i) {
+        pooled.insert({PooledMap::key_type(i * 2, i * 2 + 1), 1});
+    }
+    const auto &pool = pooled.get_implementation_map().get_allocator().pool();
+    ASSERT_TRUE(pool.reserved_nodes() >= 20000);
+
+    // Freeing most nodes releases the blocks that empty out, and clearing the map releases all but one
+    pooled.erase_range(PooledMap::key_type(0, 39000));
+    ASSERT_TRUE(pool.reserved_nodes() < 2000);
+    pooled.clear();
+    ASSERT_TRUE(pool.reserved_nodes() <= sparse_container::node_pool::kMaxBlockNodes);
+
+    // A moved-from map gives up its pool, and gets a new one when used again
+    for (uint64_t i = 0; i < 100; ++i) {
+        pooled.insert({PooledMap::key_type(i * 2, i * 2 + 1), 1});
+    }
+    PooledMap moved(std::move(pooled));
+    pooled.clear();
+    for (uint64_t i = 0; i < 100; ++i) {
+        pooled.insert({PooledMap::key_type(i * 2, i * 2 + 1), 2});
+    }
+    ASSERT_TRUE(pooled.get_implementation_map().get_allocator() != moved.get_implementation_map().get_allocator());
+    ASSERT_TRUE(moved.size() == 100);
+    ASSERT_TRUE(moved.begin()->second == 1);
+}
+
+TEST_F(PositiveLayerUtils, SyncMonotonicArena) {
+    TEST_DESCRIPTION("Check the sync validation command buffer arena alignment and storage reuse across resets");
+
+    sync_utils::MonotonicArena arena;
+    struct alignas(16) Aligned {
+        uint64_t value[3];
+    };
+
+    size_t reserved_after_first = 0;
+    for (int recording = 0; recording < 4; ++recording) {
+        std::vector<std::shared_ptr<Aligned>> objects;
+        for (uint64_t i = 0; i < 1000; ++i) {
+            // Mixed sizes, large enough to need several blocks on the first pass
+            arena.Allocate(1 + (i % 7), 1);
+            objects.emplace_back(std::allocate_shared<Aligned>(sync_utils::ArenaAllocator<Aligned>(&arena)));
+            objects.back()->value[0] = i;
+            ASSERT_TRUE((reinterpret_cast<uintptr_t>(objects.back().get()) % alignof(Aligned)) == 0);
+        }
+        for (uint64_t i = 0; i < objects.size(); ++i) {
+            ASSERT_TRUE(objects[i]->value[0] == i);
+        }
+        ASSERT_TRUE(arena.BytesUsed() <= arena.BytesReserved());
+        objects.clear();
+        arena.Reset();
+        ASSERT_TRUE(arena.BytesUsed() == 0);
+
+        if (recording == 0) {
+            reserved_after_first = arena.BytesReserved();
+        } else {
+            // Once warmed up, recording the same amount again doesn't grow the arena
+            ASSERT_TRUE(arena.BytesReserved() == reserved_after_first);
+        }
+    }
+    ASSERT_TRUE(arena.PeakBytesUsed() > 0);
+
+    auto object = sync_utils::MakeArenaUnique<std::vector<int>>(arena, 3, 7);
+    ASSERT_TRUE(object->size() == 3);
+    object.reset();
+}
+
+TEST_F(PositiveLayerUtils, SyncWorkerPool) {
+    sync_utils::WorkerPool pool(3);
+    ASSERT_TRUE(pool.ThreadCount() == 3);
+
+    // Several callers at once, each index must be visited exactly once and be complete when ParallelFor returns
+    constexpr size_t kCount = 1000;
+    constexpr size_t kCallers = 4;
+    std::vector<std::vector<std::atomic<uint32_t>>> visits(kCallers);
+    for (auto &caller_visits : visits) {
+        caller_visits = std::vector<std::atomic<uint32_t>>(kCount);
+    }
+    std::array<bool, kCallers> complete = {};
+    std::vector<std::thread> callers;
+    for (size_t caller = 0; caller < kCallers; ++caller) {
+        callers.emplace_back([&, caller]() {
+            for (uint32_t repeat = 0; repeat < 10; ++repeat) {
+                pool.ParallelFor(kCount, [&](size_t index) { visits[caller][index]++; });
+            }
+            bool all_visited = true;
+            for (const auto &count : visits[caller]) {
+                all_visited &= (count.load() == 10);
+            }
+            complete[caller] = all_visited;
+        });
+    }
+    for (auto &caller : callers) {
+        caller.join();
+    }
+    for (size_t caller = 0; caller < kCallers; ++caller) {
+        ASSERT_TRUE(complete[caller]);
+    }
+
+    // Without workers everything runs on the calling thread
+    sync_utils::WorkerPool serial(0);
+    const auto caller_id = std::this_thread::get_id();
+    bool same_thread = true;
+    serial.ParallelFor(16, [&](size_t) { same_thread &= (std::this_thread::get_id() == caller_id); });
+    ASSERT_TRUE(same_thread);
+}
+
+TEST_F(PositiveLayerUtils, SyncSerialWorker) {
+    constexpr size_t kBacklog = 4;
+    sync_utils::SerialWorker worker(kBacklog);
+    ASSERT_TRUE(worker.MaxBacklog() == kBacklog);
+
+    // Jobs run in order, and Drain returns only once all have run
+    std::vector<uint32_t> order;
+    for (uint32_t i = 0; i < 100; ++i) {
+        worker.Enqueue([&order, i]() { order.push_back(i); });
+    }
+    worker.Drain();
+    ASSERT_TRUE(order.size() == 100);
+    for (uint32_t i = 0; i < 100; ++i) {
+        ASSERT_TRUE(order[i] == i);
+    }
+
+    // While the worker is held up, Enqueue blocks once the backlog is full
+    std::mutex gate;
+    std::unique_lock<std::mutex> hold(gate);
+    std::atomic<uint32_t> queued{0};
+    worker.Enqueue([&gate]() { std::lock_guard<std::mutex> wait_for_gate(gate); });
+    std::thread producer([&]() {
+        for (uint32_t i = 0; i < kBacklog + 2; ++i) {
+            worker.Enqueue([]() {});
+            queued++;
+        }
+    });
+    while (queued.load() < kBacklog) {
+        std::this_thread::yield();
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    ASSERT_TRUE(queued.load() == kBacklog);
+    hold.unlock();
+    producer.join();
+    worker.Drain();
+    ASSERT_TRUE(worker.JobCount() == 100 + 1 + kBacklog + 2);
+    ASSERT_TRUE(worker.StallCount() > 0);
+}
+
+template <typename IndexType>
+static void CheckIndexScanKernels(std::mt19937 &rng, uint32_t value_range) {
+    std::uniform_int_distribution<uint32_t> dist(0, value_range);
+    // Lengths straddle every vector width, so both the vector and scalar tail paths are covered
+    for (size_t count : {0, 1, 3, 7, 8, 15, 16, 17, 31, 32, 33, 63, 64, 65, 257, 1000}) {
+        std::vector<IndexType> indices(count);
+        const uint32_t base = dist(rng) & std::numeric_limits<IndexType>::max();
+        for (auto &index : indices) {
+            const uint64_t value = uint64_t(base) + dist(rng) % 300;
+            index = static_cast<IndexType>(std::min<uint64_t>(value, std::numeric_limits<IndexType>::max()));
+        }
+        if (count > 2) {
+            // Extremes in the last lane, where a bad reduction or tail would lose them
+            indices[count - 1] = std::numeric_limits<IndexType>::max();
+            indices[count - 2] = 0;
+        }
+
+        const auto expected = bp_index_scan::ScalarMinMax(indices.data(), count);
+        const auto min_max = bp_index_scan::IndexMinMax(indices.data(), count);
+        ASSERT_TRUE(min_max.min == expected.min);
+        ASSERT_TRUE(min_max.max == expected.max);
+
+        // The layer only counts distinct indices when the range is smaller than the index count
+        if (min_max.max - min_max.min > (1u << 20)) continue;
+        std::vector<IndexType> sorted = indices;
+        std::sort(sorted.begin(), sorted.end());
+        const auto distinct = static_cast<uint32_t>(std::unique(sorted.begin(), sorted.end()) - sorted.begin());
+        ASSERT_TRUE(bp_index_scan::CountDistinctIndices(indices.data(), count, min_max) == distinct);
+    }
+}
+
+TEST_F(PositiveLayerUtils, IndexBufferScanKernels) {
+    TEST_DESCRIPTION("Check the vectorized best practices index buffer kernels against scalar results");
+
+    std::mt19937 rng(0x1d3c5);
+    CheckIndexScanKernels<uint8_t>(rng, 0xFF);
+    CheckIndexScanKernels<uint16_t>(rng, 0xFFFF);
+    // Both a narrow range (stack bitmap) and values above 2^31 (sign handling of the 32 bit kernels)
+    CheckIndexScanKernels<uint32_t>(rng, 1000);
+    CheckIndexScanKernels<uint32_t>(rng, 0xFFFFFFFFu);
+}
+
+TEST_F(PositiveLayerUtils, LogMessageFilters) {
+    TEST_DESCRIPTION("Check the message id filter and the lock-free duplicate message counts");
+
+    MessageIdFilter filter;
+    ASSERT_TRUE(filter.empty());
+    filter.Insert(vvl_vuid_hash("VUID-vkCmdDraw-None-02700"));
+    filter.Insert(0x1234);
+    filter.Insert(0x1234 + 1024);  // same bitmap bit as 0x1234
+    filter.Insert(0x1234);
+    ASSERT_TRUE(filter.size() == 3);
+    ASSERT_TRUE(filter.Contains(vvl_vuid_hash("VUID-vkCmdDraw-None-02700")));
+    ASSERT_TRUE(filter.Contains(0x1234 + 1024));
+    ASSERT_TRUE(!filter.Contains(0x1234 + 2048));
+    ASSERT_TRUE(!filter.Contains(vvl_vuid_hash("VUID-vkCmdDraw-None-02699")));
+
+    constexpr int32_t kLimit = 10;
+    constexpr uint32_t kIds = 6000;  // more ids than table slots, so some use the locked fallback
+    DuplicateMessageCounter counts;
+    std::array<std::atomic<int32_t>, kIds> logged{};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&]() {
+            for (int32_t repeat = 0; repeat < kLimit * 2; ++repeat) {
+                for (uint32_t id = 0; id < kIds; ++id) {
+                    if (!counts.OverLimit(id * 7919u, kLimit)) {
+                        logged[id]++;
+                    }
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    for (uint32_t id = 0; id < kIds; ++id) {
+        ASSERT_TRUE(logged[id] == kLimit);
+    }
+}
+
+static void FormatTestMessage(std::string &buffer, const char *format, ...) {
+    va_list argptr;
+    va_start(argptr, format);
+    FormatLogMessage(buffer, format, argptr);
+    va_end(argptr);
+}
+
+TEST_F(PositiveLayerUtils, LogMessageDeferredFormatting) {
+    TEST_DESCRIPTION("Check the reusable format buffer and the filter check used by deferred formatting");
+
+    std::string buffer;
+    FormatTestMessage(buffer, "%s %" PRIu32, "count", 42u);
+    ASSERT_TRUE(buffer == "count 42");
+    const std::string long_arg(4000, 'x');
+    FormatTestMessage(buffer, "[%s]", long_arg.c_str());
+    ASSERT_TRUE(buffer.size() == long_arg.size() + 2);
+    ASSERT_TRUE(buffer.front() == '[' && buffer.back() == ']');
+    FormatTestMessage(buffer, "%s", "");
+    ASSERT_TRUE(buffer.empty());
+
+    const char *vuid = "VUID-vkCmdDraw-None-02700";
+    debug_report_data debug_data;
+    // No callback is interested in errors, nothing should be formatted
+    ASSERT_TRUE(!LogMsgEnabled(&debug_data, kErrorBit, vuid));
+    debug_data.active_severities = VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+    debug_data.active_types = VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT;
+    ASSERT_TRUE(LogMsgEnabled(&debug_data, kErrorBit, vuid));
+    ASSERT_TRUE(!LogMsgEnabled(&debug_data, kWarningBit, vuid));
+
+    debug_data.duplicate_message_limit = 2;
+    ASSERT_TRUE(LogMsgEnabled(&debug_data, kErrorBit, vuid));
+    ASSERT_TRUE(LogMsgEnabled(&debug_data, kErrorBit, vuid));
+    ASSERT_TRUE(!LogMsgEnabled(&debug_data, kErrorBit, vuid));
+
+    debug_data.filter_message_ids.Insert(vvl_vuid_hash("VUID-vkCmdDraw-None-02699"));
+    ASSERT_TRUE(!LogMsgEnabled(&debug_data, kErrorBit, "VUID-vkCmdDraw-None-02699"));
+}
+
+static void WriteBinaryTestMessage(BinaryMessageLog &log, const LogObjectList &objects, const char *format, ...) {
+    va_list argptr;
+    va_start(argptr, format);
+    log.Write(kErrorBit, objects, "VUID-vkCmdDraw-None-02700", format, argptr);
+    va_end(argptr);
+}
+
+TEST_F(PositiveLayerUtils, BinaryMessageLog) {
+    TEST_DESCRIPTION("Write raw message arguments to the binary log and read the records back");
+
+    const char *filename = "vvl_binary_log_test.bin";
+    constexpr uint64_t kFileSize = 1024 * 1024;
+    constexpr uint32_t kMessages = 20000;  // enough to wrap the ring several times
+    {
+        std::string error;
+        auto log = BinaryMessageLog::Create(filename, kFileSize, kErrorBit, error);
+        ASSERT_TRUE(log != nullptr);
+        ASSERT_TRUE(log->Accepts(VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT, VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT));
+        ASSERT_TRUE(!log->Accepts(VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT, VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT));
+        LogObjectList objects;
+        objects.add(CastFromUint64<VkBuffer>(0x1234));
+        for (uint32_t i = 0; i < kMessages; ++i) {
+            WriteBinaryTestMessage(*log, objects, "%s: message %" PRIu32 " of %d, %5.2f", "vkCmdDraw", i, -1, 0.5);
+        }
+    }
+
+    std::vector<uint8_t> data(kFileSize);
+    FILE *file = fopen(filename, "rb");
+    ASSERT_TRUE(file != nullptr);
+    ASSERT_TRUE(fread(data.data(), 1, data.size(), file) == data.size());
+    fclose(file);
+    std::remove(filename);
+
+    binary_log::FileHeader header;
+    std::memcpy(&header, data.data(), sizeof(header));
+    ASSERT_TRUE(std::memcmp(header.magic, binary_log::kMagic, sizeof(header.magic)) == 0);
+    ASSERT_TRUE(header.record_count == kMessages);
+    ASSERT_TRUE(header.dropped_count == 0);
+    ASSERT_TRUE(header.ring_tail > 0);  // wrapped
+    ASSERT_TRUE(header.ring_head - header.ring_tail <= header.ring_capacity);
+
+    // Walk the surviving records, the last one holds the last message number
+    auto ring_read = [&](uint64_t logical_offset, void *dst, size_t size) {
+        for (size_t i = 0; i < size; ++i) {
+            static_cast<uint8_t *>(dst)[i] = data[header.ring_offset + (logical_offset + i) % header.ring_capacity];
+        }
+    };
+    uint64_t offset = header.ring_tail;
+    uint64_t last_offset = offset;
+    uint32_t records = 0;
+    while (offset < header.ring_head) {
+        uint32_t size;
+        ring_read(offset, &size, sizeof(size));
+        ASSERT_TRUE(size > binary_log::kRecordHeaderSize);
+        last_offset = offset;
+        offset += size;
+        ++records;
+    }
+    ASSERT_TRUE(offset == header.ring_head);
+    ASSERT_TRUE(records > 0 && records < kMessages);
+
+    std::vector<uint8_t> record(header.ring_head - last_offset);
+    ring_read(last_offset, record.data(), record.size());
+    ASSERT_TRUE(record[4] == kErrorBit);
+    ASSERT_TRUE(record[5] == 1);  // objects
+    uint16_t arg_count;
+    std::memcpy(&arg_count, &record[6], sizeof(arg_count));
+    ASSERT_TRUE(arg_count == 4);
+    uint32_t vuid_hash;
+    std::memcpy(&vuid_hash, &record[8], sizeof(vuid_hash));
+    ASSERT_TRUE(vuid_hash == vvl_vuid_hash("VUID-vkCmdDraw-None-02700"));
+    size_t pos = binary_log::kRecordHeaderSize + binary_log::kObjectSize;
+    ASSERT_TRUE(record[pos] == binary_log::kString);
+    uint32_t length;
+    std::memcpy(&length, &record[pos + 1], sizeof(length));
+    ASSERT_TRUE(std::string(reinterpret_cast<const char *>(&record[pos + 5]), length) == "vkCmdDraw");
+    pos += 5 + length;
+    ASSERT_TRUE(record[pos] == binary_log::kUnsigned);
+    uint64_t message_index;
+    std::memcpy(&message_index, &record[pos + 1], sizeof(message_index));
+    ASSERT_TRUE(message_index == kMessages - 1);
+}
+
+TEST_F(PositiveLayerUtils, BinaryMessageLogStringPrecision) {
+    TEST_DESCRIPTION("Strings with a printf precision are copied up to the precision and need no terminator");
+
+    const char *filename = "vvl_binary_log_precision_test.bin";
+    constexpr uint64_t kFileSize = 1024 * 1024;
+    const char unterminated[4] = {'a', 'b', 'c', 'd'};
+    const char prefix[3] = {'x', 'y', 'z'};
+    {
+        std::string error;
+        auto log = BinaryMessageLog::Create(filename, kFileSize, kErrorBit, error);
+        ASSERT_TRUE(log != nullptr);
+        LogObjectList objects;
+        WriteBinaryTestMessage(*log, objects, "%.*s %.2s %s", 4, unterminated, prefix, "terminated");
+    }
+
+    std::vector<uint8_t> data(kFileSize);
+    FILE *file = fopen(filename, "rb");
+    ASSERT_TRUE(file != nullptr);
+    ASSERT_TRUE(fread(data.data(), 1, data.size(), file) == data.size());
+    fclose(file);
+    std::remove(filename);
+
+    binary_log::FileHeader header;
+    std::memcpy(&header, data.data(), sizeof(header));
+    ASSERT_TRUE(header.record_count == 1);
+    const uint8_t *record = &data[header.ring_offset];
+    uint16_t arg_count;
+    std::memcpy(&arg_count, &record[6], sizeof(arg_count));
+    ASSERT_TRUE(arg_count == 4);  // the '*' precision is an argument of its own
+
+    size_t pos = binary_log::kRecordHeaderSize;
+    ASSERT_TRUE(record[pos] == binary_log::kSigned);
+    int64_t precision;
+    std::memcpy(&precision, &record[pos + 1], sizeof(precision));
+    ASSERT_TRUE(precision == 4);
+    pos += 1 + sizeof(precision);
+    auto read_string = [&]() {
+        EXPECT_TRUE(record[pos] == binary_log::kString);
+        uint32_t length;
+        std::memcpy(&length, &record[pos + 1], sizeof(length));
+        std::string value(reinterpret_cast<const char *>(&record[pos + 5]), length);
+        pos += 5 + length;
+        return value;
+    };
+    ASSERT_TRUE(read_string() == "abcd");
+    ASSERT_TRUE(read_string() == "xy");
+    ASSERT_TRUE(read_string() == "terminated");
+}
+
+TEST_F(PositiveLayerUtils, BinaryMessageLogRuntimeFormats) {
+    TEST_DESCRIPTION("Formats built at runtime are looked up by their text, a reused buffer does not decode with the old format");
+
+    const char *filename = "vvl_binary_log_runtime_format_test.bin";
+    constexpr uint64_t kFileSize = 1024 * 1024;
+    const char *formats[2] = {"first format %d", "other format %d"};
+    {
+        std::string error;
+        auto log = BinaryMessageLog::Create(filename, kFileSize, kErrorBit, error);
+        ASSERT_TRUE(log != nullptr);
+        LogObjectList objects;
+        std::string format;
+        format.reserve(64);
+        for (int i = 0; i < 4; ++i) {
+            format = formats[i % 2];  // same buffer every time
+            WriteBinaryTestMessage(*log, objects, format.c_str(), i);
+        }
+    }
+
+    std::vector<uint8_t> data(kFileSize);
+    FILE *file = fopen(filename, "rb");
+    ASSERT_TRUE(file != nullptr);
+    ASSERT_TRUE(fread(data.data(), 1, data.size(), file) == data.size());
+    fclose(file);
+    std::remove(filename);
+
+    binary_log::FileHeader header;
+    std::memcpy(&header, data.data(), sizeof(header));
+    ASSERT_TRUE(header.record_count == 4);
+    ASSERT_TRUE(header.dropped_count == 0);
+
+    // One dictionary entry per distinct format
+    vvl::unordered_map<uint32_t, std::string> format_texts;
+    for (uint64_t offset = 0; offset < header.dictionary_used;) {
+        const uint8_t *entry = &data[header.dictionary_offset + offset];
+        uint32_t size;
+        uint32_t id;
+        std::memcpy(&size, entry, sizeof(size));
+        std::memcpy(&id, entry + 8, sizeof(id));
+        ASSERT_TRUE(size > 12);
+        if (entry[4] == binary_log::kFormatString) {
+            std::string text(reinterpret_cast<const char *>(entry + 12), size - 12);
+            text.erase(std::find(text.begin(), text.end(), '\0'), text.end());  // zero padded to 8 bytes
+            ASSERT_TRUE(format_texts.emplace(id, text).second);
+        }
+        offset += size;
+    }
+    ASSERT_TRUE(format_texts.size() == 2);
+
+    uint64_t offset = 0;
+    for (int i = 0; i < 4; ++i) {
+        const uint8_t *record = &data[header.ring_offset + offset];
+        uint32_t size;
+        uint32_t format_id;
+        std::memcpy(&size, record, sizeof(size));
+        std::memcpy(&format_id, &record[12], sizeof(format_id));
+        ASSERT_TRUE(format_texts[format_id] == formats[i % 2]);
+        const size_t pos = binary_log::kRecordHeaderSize;
+        ASSERT_TRUE(record[pos] == binary_log::kSigned);
+        int64_t value;
+        std::memcpy(&value, &record[pos + 1], sizeof(value));
+        ASSERT_TRUE(value == i);
+        offset += size;
+    }
+    ASSERT_TRUE(offset == header.ring_head);
+}
+
+TEST_F(PositiveLayerUtils, ReadOnlyMappedFile) {
+    TEST_DESCRIPTION("Map a file and read it back, missing and empty files map to nothing");
+
+    const char *filename = "vvl_mapped_file_test.bin";
+    std::vector<uint8_t> contents(10000);
+    for (size_t i = 0; i < contents.size(); ++i) {
+        contents[i] = static_cast<uint8_t>(i * 7);
+    }
+    FILE *file = fopen(filename, "wb");
+    ASSERT_TRUE(file != nullptr);
+    ASSERT_TRUE(fwrite(contents.data(), 1, contents.size(), file) == contents.size());
+    fclose(file);
+    {
+        ReadOnlyMappedFile mapped(filename);
+        ASSERT_TRUE(mapped.data() != nullptr);
+        ASSERT_TRUE(mapped.size() == contents.size());
+        ASSERT_TRUE(std::memcmp(mapped.data(), contents.data(), contents.size()) == 0);
+    }
+
+    file = fopen(filename, "wb");
+    ASSERT_TRUE(file != nullptr);
+    fclose(file);
+    {
+        ReadOnlyMappedFile mapped(filename);
+        ASSERT_TRUE(mapped.data() == nullptr);
+        ASSERT_TRUE(mapped.size() == 0);
+    }
+    std::remove(filename);
+
+    ReadOnlyMappedFile missing(filename);
+    ASSERT_TRUE(missing.data() == nullptr);
+}
+
+TEST_F(PositiveLayerUtils, ValidationCacheFile) {
+    TEST_DESCRIPTION("Hashes inserted into a persistent validation cache are in its file without compacting it");
+
+    const char *filename = "vvl_validation_cache_test.bin";
+    std::remove(filename);
+    std::string error;
+    auto cache = CastFromHandle<ValidationCache *>(ValidationCache::CreatePersistent(filename, 16, error));
+    ASSERT_TRUE(error.empty());
+    ASSERT_FALSE(cache->Contains(1));
+    cache->Insert(1);
+    cache->Insert(2);
+    cache->Insert(3);
+    // Not compacted, as if the application crashed
+    delete cache;
+
+    cache = CastFromHandle<ValidationCache *>(ValidationCache::CreatePersistent(filename, 16, error));
+    ASSERT_TRUE(error.empty());
+    ASSERT_TRUE(cache->Contains(1));
+    ASSERT_TRUE(cache->Contains(2));
+    ASSERT_TRUE(cache->Contains(3));
+    ASSERT_FALSE(cache->Contains(4));
+    delete cache;
+
+    // A hash that was only partly written is dropped, the ones appended after it are still read back
+    FILE *file = fopen(filename, "ab");
+    ASSERT_TRUE(file != nullptr);
+    const uint8_t partial_hash[3] = {0x11, 0x22, 0x33};
+    ASSERT_TRUE(fwrite(partial_hash, 1, sizeof(partial_hash), file) == sizeof(partial_hash));
+    fclose(file);
+    cache = CastFromHandle<ValidationCache *>(ValidationCache::CreatePersistent(filename, 16, error));
+    ASSERT_TRUE(error.empty());
+    ASSERT_TRUE(cache->Contains(3));
+    cache->Insert(4);
+    delete cache;
+
+    cache = CastFromHandle<ValidationCache *>(ValidationCache::CreatePersistent(filename, 16, error));
+    ASSERT_TRUE(cache->Contains(3));
+    ASSERT_TRUE(cache->Contains(4));
+    size_t data_size = 0;
+    cache->Write(&data_size, nullptr);
+    delete cache;
+    {
+        ReadOnlyMappedFile mapped(filename);
+        ASSERT_TRUE(mapped.size() == data_size);
+    }
+
+    // A file from another version of the cache is started over
+    file = fopen(filename, "wb");
+    ASSERT_TRUE(file != nullptr);
+    const uint32_t old_header[2] = {16 + 2 * sizeof(uint32_t), 1};
+    ASSERT_TRUE(fwrite(old_header, 1, sizeof(old_header), file) == sizeof(old_header));
+    fclose(file);
+    cache = CastFromHandle<ValidationCache *>(ValidationCache::CreatePersistent(filename, 16, error));
+    ASSERT_TRUE(error.empty());
+    ASSERT_FALSE(cache->Contains(3));
+    delete cache;
+    std::remove(filename);
+}
+
+TEST_F(PositiveLayerUtils, ValidationCacheEviction) {
+    TEST_DESCRIPTION("Evict the least recently used hashes of a persistent validation cache and compact its file");
+
+    const char *filename = "vvl_validation_cache_eviction_test.bin";
+    std::remove(filename);
+    std::string error;
+    auto cache = CastFromHandle<ValidationCache *>(ValidationCache::CreatePersistent(filename, 4, error));
+    ASSERT_TRUE(error.empty());
+    for (uint64_t hash = 1; hash <= 4; ++hash) {
+        cache->Insert(hash);
+    }
+    // 1 is now used more recently than 2, which is the one evicted for 5
+    ASSERT_TRUE(cache->Contains(1));
+    cache->Insert(5);
+    ASSERT_FALSE(cache->Contains(2));
+    ASSERT_TRUE(cache->Contains(3));
+    // 4 is now the least recently used
+    ASSERT_TRUE(cache->Contains(1));
+    ASSERT_TRUE(cache->Contains(5));
+    cache->Insert(6);
+    ASSERT_FALSE(cache->Contains(4));
+
+    // Another device (or process) using the same file adds a hash before this one is compacted
+    auto other_cache = CastFromHandle<ValidationCache *>(ValidationCache::CreatePersistent(filename, 4, error));
+    ASSERT_TRUE(error.empty());
+    other_cache->Insert(7);
+    delete other_cache;
+
+    // The file had every hash appended, compacting rewrites it with the 4 most recently used. 7 only comes from the file, so it
+    // counts as older than any used here and is not one of them.
+    ASSERT_TRUE(cache->Compact(error));
+    delete cache;
+    cache = CastFromHandle<ValidationCache *>(ValidationCache::CreatePersistent(filename, 4, error));
+    size_t data_size = 0;
+    cache->Write(&data_size, nullptr);
+    {
+        ReadOnlyMappedFile mapped(filename);
+        ASSERT_TRUE(mapped.size() == data_size);
+    }
+    ASSERT_TRUE(cache->Contains(1));
+    ASSERT_TRUE(cache->Contains(3));
+    ASSERT_TRUE(cache->Contains(5));
+    ASSERT_TRUE(cache->Contains(6));
+    ASSERT_FALSE(cache->Contains(7));
+    // With room for it, a hash added by another instance is kept
+    ASSERT_TRUE(cache->Compact(error));
+    delete cache;
+    cache = CastFromHandle<ValidationCache *>(ValidationCache::CreatePersistent(filename, 8, error));
+    other_cache = CastFromHandle<ValidationCache *>(ValidationCache::CreatePersistent(filename, 8, error));
+    other_cache->Insert(7);
+    delete other_cache;
+    ASSERT_TRUE(cache->Compact(error));
+    delete cache;
+    cache = CastFromHandle<ValidationCache *>(ValidationCache::CreatePersistent(filename, 8, error));
+    ASSERT_TRUE(cache->Contains(7));
+    ASSERT_TRUE(cache->Contains(6));
+    delete cache;
+    std::remove(filename);
+}
+
+TEST_F(PositiveLayerUtils, ValidationCacheOptionsKey) {
+    TEST_DESCRIPTION("A shader validated with some spirv-val options is not known to be valid with other options");
+
+    const char *filename = "vvl_validation_cache_options_test.bin";
+    std::remove(filename);
+    const uint32_t code[] = {0x07230203, 0x00010000, 0, 4, 0};
+    auto module_ci = LvlInitStruct<VkShaderModuleCreateInfo>();
+    module_ci.codeSize = sizeof(code);
+    module_ci.pCode = code;
+    const uint64_t hash = ValidationCache::MakeShaderHash(&module_ci, 1);
+    ASSERT_TRUE(hash == ValidationCache::MakeShaderHash(&module_ci, 1));
+    const uint64_t other_options_hash = ValidationCache::MakeShaderHash(&module_ci, 2);
+    ASSERT_TRUE(hash != other_options_hash);
+
+    std::string error;
+    auto cache = CastFromHandle<ValidationCache *>(ValidationCache::CreatePersistent(filename, 16, error));
+    ASSERT_TRUE(error.empty());
+    cache->Insert(hash);
+    ASSERT_TRUE(cache->Contains(hash));
+    ASSERT_FALSE(cache->Contains(other_options_hash));
+    delete cache;
+
+    cache = CastFromHandle<ValidationCache *>(ValidationCache::CreatePersistent(filename, 16, error));
+    ASSERT_TRUE(cache->Contains(hash));
+    ASSERT_FALSE(cache->Contains(other_options_hash));
+    delete cache;
+    std::remove(filename);
+}
+
+TEST_F(PositiveLayerUtils, DebugObjectNames) {
+    TEST_DESCRIPTION("Set, replace and look up refcounted debug object names while other threads read them");
+
+    DebugObjectNames names;
+    {
+        DebugObjectNames::ReadGuard guard(names);
+        ASSERT_TRUE(names.Get(0x10).empty());
+        names.Set(0x10, "vertex buffer");
+        names.Set(0x20, "vertex buffer");
+        ASSERT_TRUE(names.Get(0x10) == "vertex buffer");
+        // Interned, both handles share the storage
+        ASSERT_TRUE(names.Get(0x10).data() == names.Get(0x20).data());
+        names.Set(0x10, "index buffer");
+        ASSERT_TRUE(names.Get(0x10) == "index buffer");
+        ASSERT_TRUE(names.Get(0x20) == "vertex buffer");
+        ASSERT_TRUE(names.Get(0x10).data()[names.Get(0x10).size()] == '\0');
+        names.Set(0x20, nullptr);
+        ASSERT_TRUE(names.Get(0x20).empty());
+        names.Set(0, "null handle");
+        ASSERT_TRUE(names.Get(0).empty());
+    }
+
+    // Every round replaces each name with a unique one, so the previous names lose their last reference and are freed
+    // while readers may still hold views of them under a guard.
+    DebugObjectNames concurrent_names;
+    constexpr uint64_t kHandles = 500;
+    constexpr uint32_t kRounds = 20;
+    std::atomic<bool> done{false};
+    std::atomic<uint32_t> bad_names{0};
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 3; ++t) {
+        readers.emplace_back([&]() {
+            std::vector<std::string_view> held(kHandles);
+            while (!done.load()) {
+                DebugObjectNames::ReadGuard guard(concurrent_names);
+                for (uint64_t handle = 1; handle <= kHandles; ++handle) {
+                    held[handle - 1] = concurrent_names.Get(handle);
+                }
+                std::this_thread::yield();
+                for (uint64_t handle = 1; handle <= kHandles; ++handle) {
+                    const std::string_view name = held[handle - 1];
+                    const std::string prefix = "object " + std::to_string(handle) + ".";
+                    if (!name.empty() && (name.substr(0, prefix.size()) != prefix || name.data()[name.size()] != '\0')) {
+                        bad_names++;
+                    }
+                }
+            }
+        });
+    }
+    for (uint32_t round = 0; round < kRounds; ++round) {
+        for (uint64_t handle = 1; handle <= kHandles; ++handle) {
+            concurrent_names.Set(handle, ("object " + std::to_string(handle) + "." + std::to_string(round)).c_str());
+        }
+    }
+    done = true;
+    for (auto &reader : readers) {
+        reader.join();
+    }
+    ASSERT_TRUE(bad_names == 0);
+    DebugObjectNames::ReadGuard guard(concurrent_names);
+    ASSERT_TRUE(concurrent_names.Get(3) == "object 3." + std::to_string(kRounds - 1));
+}
+
+TEST_F(PositiveLayerUtils, CommandBufferLabels) {
+    TEST_DESCRIPTION("Record label stacks for several command buffers from several threads and export them");
+
+    auto make_label = [](const char *name) {
+        auto label = LvlInitStruct<VkDebugUtilsLabelEXT>();
+        label.pLabelName = name;
+        label.color[0] = 1.0f;
+        return label;
+    };
+    const auto outer = make_label("outer");
+    const auto inner = make_label("inner");
+    const auto marker = make_label("marker");
+
+    CommandBufferLabels labels;
+    const auto cb = CastFromUint64<VkCommandBuffer>(0x100);
+    ASSERT_TRUE(labels.Export(cb).empty());
+    labels.End(cb);
+    labels.Begin(cb, &outer);
+    labels.Begin(cb, &inner);
+    labels.Insert(cb, &marker);
+    auto exported = labels.Export(cb);
+    ASSERT_TRUE(exported.size() == 3);
+    ASSERT_TRUE(std::string(exported[0].pLabelName) == "inner");
+    ASSERT_TRUE(std::string(exported[1].pLabelName) == "outer");
+    ASSERT_TRUE(std::string(exported[2].pLabelName) == "marker");
+    ASSERT_TRUE(exported[1].color[0] == 1.0f);
+
+    labels.End(cb);
+    exported = labels.Export(cb);
+    ASSERT_TRUE(exported.size() == 1);
+    ASSERT_TRUE(std::string(exported[0].pLabelName) == "outer");
+
+    // The popped label's storage is reused by the next label
+    labels.Begin(cb, &marker);
+    exported = labels.Export(cb);
+    ASSERT_TRUE(exported.size() == 2);
+    ASSERT_TRUE(std::string(exported[0].pLabelName) == "marker");
+
+    labels.Reset(cb);
+    ASSERT_TRUE(labels.Export(cb).empty());
+    labels.Begin(cb, &outer);
+    labels.Erase(cb);
+    ASSERT_TRUE(labels.Export(cb).empty());
+    labels.Begin(VK_NULL_HANDLE, &outer);
+    ASSERT_TRUE(labels.Export(VK_NULL_HANDLE).empty());
+
+    // The pool and device wide calls reach every command buffer allocated from the pool
+    const auto device = CastFromUint64<VkDevice>(0x1);
+    const auto pool = CastFromUint64<VkCommandPool>(0x2);
+    const auto other_pool = CastFromUint64<VkCommandPool>(0x3);
+    const VkCommandBuffer pool_cbs[2] = {CastFromUint64<VkCommandBuffer>(0x200), CastFromUint64<VkCommandBuffer>(0x201)};
+    const auto other_cb = CastFromUint64<VkCommandBuffer>(0x300);
+    labels.Allocate(device, pool, 2, pool_cbs);
+    labels.Allocate(device, other_pool, 1, &other_cb);
+    labels.Begin(pool_cbs[0], &outer);
+    labels.Begin(pool_cbs[1], &outer);
+    labels.Begin(other_cb, &outer);
+    labels.ResetPool(pool);
+    ASSERT_TRUE(labels.Export(pool_cbs[0]).empty());
+    ASSERT_TRUE(labels.Export(pool_cbs[1]).empty());
+    ASSERT_TRUE(labels.Export(other_cb).size() == 1);
+    labels.Begin(pool_cbs[0], &outer);
+    labels.Begin(pool_cbs[1], &outer);
+    labels.Free(pool, 1, &pool_cbs[0]);
+    ASSERT_TRUE(labels.Export(pool_cbs[0]).empty());
+    ASSERT_TRUE(labels.Export(pool_cbs[1]).size() == 1);
+    labels.ErasePool(pool);
+    ASSERT_TRUE(labels.Export(pool_cbs[1]).empty());
+    ASSERT_TRUE(labels.Export(other_cb).size() == 1);
+    labels.EraseDevice(device);
+    ASSERT_TRUE(labels.Export(other_cb).empty());
+
+    // Each thread records its own command buffers, as command buffers are externally synchronized
+    CommandBufferLabels concurrent_labels;
+    std::atomic<uint32_t> bad_stacks{0};
+    std::vector<std::thread> recorders;
+    for (uint64_t t = 0; t < 4; ++t) {
+        recorders.emplace_back([&, t]() {
+            for (int frame = 0; frame < 200; ++frame) {
+                for (uint64_t i = 1; i <= 8; ++i) {
+                    const auto command_buffer = CastFromUint64<VkCommandBuffer>((t << 8) | i);
+                    concurrent_labels.Reset(command_buffer);
+                    concurrent_labels.Begin(command_buffer, &outer);
+                    concurrent_labels.Begin(command_buffer, &inner);
+                    if (concurrent_labels.Export(command_buffer).size() != 2) {
+                        bad_stacks++;
+                    }
+                    concurrent_labels.End(command_buffer);
+                    concurrent_labels.End(command_buffer);
+                    if (frame % 50 == 49) {
+                        concurrent_labels.Erase(command_buffer);
+                    }
+                }
+            }
+        });
+    }
+    for (auto &recorder : recorders) {
+        recorder.join();
+    }
+
+    // A message naming a command buffer may export its labels while the owning thread frees it. Every round labels new
+    // command buffers, publishes the round to the exporter, then frees them.
+    constexpr uint64_t kCommandBuffers = 64;
+    std::atomic<uint64_t> published_round{0};
+    std::atomic<bool> done{false};
+    std::thread exporter([&]() {
+        while (!done.load()) {
+            const uint64_t round = published_round.load();
+            for (uint64_t i = 1; i <= kCommandBuffers; ++i) {
+                const CommandBufferLabels::ReadGuard guard(concurrent_labels);
+                for (const auto &label : concurrent_labels.Export(CastFromUint64<VkCommandBuffer>((round << 16) | i))) {
+                    const std::string name(label.pLabelName);
+                    if (name != "outer" && name != "inner") {
+                        bad_stacks++;
+                    }
+                }
+            }
+        }
+    });
+    const auto freeing_pool = CastFromUint64<VkCommandPool>(0x4);
+    for (uint64_t round = 1; round <= 200; ++round) {
+        std::vector<VkCommandBuffer> command_buffers;
+        for (uint64_t i = 1; i <= kCommandBuffers; ++i) {
+            command_buffers.emplace_back(CastFromUint64<VkCommandBuffer>((round << 16) | i));
+        }
+        concurrent_labels.Allocate(device, freeing_pool, kCommandBuffers, command_buffers.data());
+        for (const auto command_buffer : command_buffers) {
+            concurrent_labels.Begin(command_buffer, &outer);
+            concurrent_labels.Begin(command_buffer, &inner);
+        }
+        published_round = round;
+        if (round % 2) {
+            concurrent_labels.Free(freeing_pool, kCommandBuffers, command_buffers.data());
+        } else {
+            concurrent_labels.ErasePool(freeing_pool);
+        }
+    }
+    done = true;
+    exporter.join();
+    ASSERT_TRUE(bad_stacks == 0);
+}
@@ -1190,4 +1190,57 @@ TEST_F(VkPositiveLayerTest, FreeDescriptorSetsNull) {
     // Only set first set, second is still null
     vk::AllocateDescriptorSets(m_device->device(), &alloc_info, &descriptor_sets[0]);
     vk::FreeDescriptorSets(m_device->device(), ds_pool.handle(), 2, descriptor_sets);
-}
\ No newline at end of file
+}
+
+TEST_F(VkPositiveLayerTest, ValidationCacheRoundTrip) {
+    TEST_DESCRIPTION("Validate a shader into a validation cache, then load the cache data into a new cache");
+
+    AddRequiredExtensions(VK_EXT_VALIDATION_CACHE_EXTENSION_NAME);
+    ASSERT_NO_FATAL_FAILURE(InitFramework());
+    if (!AreRequiredExtensionsEnabled()) {
+        GTEST_SKIP() << RequiredExtensionsNotSupported() << " not supported";
+    }
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    auto cache_ci = LvlInitStruct<VkValidationCacheCreateInfoEXT>();
+    VkValidationCacheEXT cache = VK_NULL_HANDLE;
+    ASSERT_VK_SUCCESS(vk::CreateValidationCacheEXT(m_device->device(), &cache_ci, nullptr, &cache));
+
+    size_t empty_size = 0;
+    ASSERT_VK_SUCCESS(vk::GetValidationCacheDataEXT(m_device->device(), cache, &empty_size, nullptr));
+
+    const std::vector<uint32_t> spv = GLSLToSPV(VK_SHADER_STAGE_COMPUTE_BIT, R"glsl(
+        #version 450
+        layout(local_size_x=1) in;
+        void main(){}
+    )glsl");
+    auto shader_cache_ci = LvlInitStruct<VkShaderModuleValidationCacheCreateInfoEXT>();
+    shader_cache_ci.validationCache = cache;
+    auto module_ci = LvlInitStruct<VkShaderModuleCreateInfo>(&shader_cache_ci);
+    module_ci.codeSize = spv.size() * sizeof(uint32_t);
+    module_ci.pCode = spv.data();
+    vk_testing::ShaderModule module;
+    module.init(*m_device, module_ci);
+
+    size_t data_size = 0;
+    ASSERT_VK_SUCCESS(vk::GetValidationCacheDataEXT(m_device->device(), cache, &data_size, nullptr));
+    ASSERT_GT(data_size, empty_size);
+    std::vector<uint8_t> data(data_size);
+    ASSERT_VK_SUCCESS(vk::GetValidationCacheDataEXT(m_device->device(), cache, &data_size, data.data()));
+
+    // The shader is still known by a cache loaded from the data
+    cache_ci.initialDataSize = data.size();
+    cache_ci.pInitialData = data.data();
+    VkValidationCacheEXT loaded_cache = VK_NULL_HANDLE;
+    ASSERT_VK_SUCCESS(vk::CreateValidationCacheEXT(m_device->device(), &cache_ci, nullptr, &loaded_cache));
+    size_t loaded_size = 0;
+    ASSERT_VK_SUCCESS(vk::GetValidationCacheDataEXT(m_device->device(), loaded_cache, &loaded_size, nullptr));
+    ASSERT_EQ(loaded_size, data_size);
+
+    shader_cache_ci.validationCache = loaded_cache;
+    vk_testing::ShaderModule loaded_module;
+    loaded_module.init(*m_device, module_ci);
+
+    vk::DestroyValidationCacheEXT(m_device->device(), loaded_cache, nullptr);
+    vk::DestroyValidationCacheEXT(m_device->device(), cache, nullptr);
+}
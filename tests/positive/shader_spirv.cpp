@@ -174,6 +174,16 @@ TEST_F(PositiveShaderSpirv, GroupDecorations) {
     pipe.cs_.reset(new VkShaderObj(this, spv_source.c_str(), VK_SHADER_STAGE_COMPUTE_BIT, SPV_ENV_VULKAN_1_0, SPV_SOURCE_ASM));
     pipe.InitState();
     pipe.CreateComputePipeline();
+
+    // The same SPIR-V again, the group decorations have to be flattened again as what was parsed before flattening is not
+    // shared between shader modules. Without BufferBlock (only set through a group) the blocks don't match the storage buffers
+    CreateComputePipelineHelper duplicate_pipe(*this);
+    duplicate_pipe.InitInfo();
+    duplicate_pipe.dsl_bindings_ = pipe.dsl_bindings_;
+    duplicate_pipe.cs_.reset(
+        new VkShaderObj(this, spv_source.c_str(), VK_SHADER_STAGE_COMPUTE_BIT, SPV_ENV_VULKAN_1_0, SPV_SOURCE_ASM));
+    duplicate_pipe.InitState();
+    duplicate_pipe.CreateComputePipeline();
 }
 
 TEST_F(PositiveShaderSpirv, CapabilityExtension1of2) {
@@ -1875,3 +1885,36 @@ void main() {
     pipe.shader_stages_ = {vs.GetStageCreateInfo(), fs.GetStageCreateInfo()};
     pipe.CreateGraphicsPipeline();
 }
+
+TEST_F(PositiveShaderSpirv, DuplicateShaderModules) {
+    TEST_DESCRIPTION("Create shader modules with the same SPIR-V, the layer parses it once and shares it between them");
+
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    char const *cs_source = R"glsl(
+        #version 450
+        layout(local_size_x=1) in;
+        layout(set=0, binding=0) buffer block { vec4 x; };
+        void main(){
+           x = vec4(1.0);
+        }
+    )glsl";
+
+    CreateComputePipelineHelper first_pipe(*this);
+    first_pipe.InitInfo();
+    first_pipe.dsl_bindings_ = {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}};
+    // Created first, this is the module the SPIR-V is parsed for
+    first_pipe.cs_.reset(new VkShaderObj(this, cs_source, VK_SHADER_STAGE_COMPUTE_BIT));
+    auto duplicate_module = std::make_unique<VkShaderObj>(this, cs_source, VK_SHADER_STAGE_COMPUTE_BIT);
+    first_pipe.InitState();
+    first_pipe.CreateComputePipeline();
+
+    // The module sharing the parsed SPIR-V is still used after the one it was parsed for is gone
+    first_pipe.cs_.reset();
+    CreateComputePipelineHelper second_pipe(*this);
+    second_pipe.InitInfo();
+    second_pipe.dsl_bindings_ = {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr}};
+    second_pipe.cs_ = std::move(duplicate_module);
+    second_pipe.InitState();
+    second_pipe.CreateComputePipeline();
+}
@@ -120,3 +120,67 @@ TEST_F(PositiveSyncVal, CmdClearAttachmentLayer) {
     m_commandBuffer->QueueCommandBuffer();
     vk::QueueWaitIdle(m_device->m_queue);
 }
+
+TEST_F(PositiveSyncVal, ThreadedCommandBufferRecording) {
+    TEST_DESCRIPTION("Record command buffers on several threads at once, then submit them together.");
+
+    ASSERT_NO_FATAL_FAILURE(InitSyncValFramework());
+    ASSERT_NO_FATAL_FAILURE(InitState());
+
+    constexpr int worker_count = 8;
+    constexpr int copies_per_command_buffer = 256;
+    VkMemoryPropertyFlags mem_prop = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+
+    // All workers read the same source buffer and write their own destination buffer
+    VkBufferObj src_buffer;
+    src_buffer.init_as_src(*m_device, 256, mem_prop);
+    std::array<VkBufferObj, worker_count> dst_buffers;
+    for (auto &dst_buffer : dst_buffers) {
+        dst_buffer.init_as_dst(*m_device, 256, mem_prop);
+    }
+
+    std::vector<std::unique_ptr<VkCommandPoolObj>> pools;
+    std::vector<std::unique_ptr<VkCommandBufferObj>> command_buffers;
+    for (int i = 0; i < worker_count; ++i) {
+        pools.emplace_back(new VkCommandPoolObj(m_device, m_device->graphics_queue_node_index_));
+        command_buffers.emplace_back(new VkCommandBufferObj(m_device, pools.back().get()));
+    }
+
+    ThreadTimeoutHelper timeout_helper(worker_count);
+    auto worker_thread = [&](int worker_index) {
+        auto timeout_guard = timeout_helper.ThreadGuard();
+        auto &cb = *command_buffers[worker_index];
+        const VkBufferCopy region = {0, 0, 256};
+        cb.begin();
+        for (int i = 0; i < copies_per_command_buffer; ++i) {
+            vk::CmdCopyBuffer(cb.handle(), src_buffer.handle(), dst_buffers[worker_index].handle(), 1, &region);
+            auto barrier = LvlInitStruct<VkBufferMemoryBarrier>();
+            barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.buffer = dst_buffers[worker_index].handle();
+            barrier.size = VK_WHOLE_SIZE;
+            vk::CmdPipelineBarrier(cb.handle(), VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 1,
+                                   &barrier, 0, nullptr);
+        }
+        cb.end();
+    };
+
+    std::vector<std::thread> workers;
+    for (int i = 0; i < worker_count; i++) workers.emplace_back(worker_thread, i);
+    constexpr int wait_time = 60;
+    if (!timeout_helper.WaitForThreads(wait_time))
+        ADD_FAILURE() << "The waiting time for the worker threads exceeded the maximum limit: " << wait_time << " seconds.";
+    for (auto &worker : workers) worker.join();
+
+    std::vector<VkCommandBuffer> handles;
+    for (const auto &cb : command_buffers) {
+        handles.push_back(cb->handle());
+    }
+    auto submit_info = LvlInitStruct<VkSubmitInfo>();
+    submit_info.commandBufferCount = static_cast<uint32_t>(handles.size());
+    submit_info.pCommandBuffers = handles.data();
+    vk::QueueSubmit(m_device->m_queue, 1, &submit_info, VK_NULL_HANDLE);
+    vk::QueueWaitIdle(m_device->m_queue);
+}
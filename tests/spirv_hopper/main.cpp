@@ -31,21 +31,25 @@ static bool IsValidSPIRV(size_t file_size, const char* spirv_data) {
 }
 
 int main(int argc, char** argv) {
-    if (argc != 2) {
-        std::cout << "Error:\n\tUsage: ./spirv-hopper [file | directory]\n";
+    // --time prints how long vkCreateShaderModule took for the SPIR-V files, used to measure shader module parsing.
+    // The layer's shader validation is disabled for it, spirv-val would otherwise dominate the time.
+    const bool print_time = (argc == 3 && std::string(argv[1]) == "--time");
+    const char* input_path = argv[argc - 1];
+    if (argc != 2 && !print_time) {
+        std::cout << "Error:\n\tUsage: ./spirv-hopper [--time] [file | directory]\n";
         return EXIT_FAILURE;
-    } else if (!std::filesystem::exists(argv[1])) {
-        std::cout << "Error: " << argv[1] << " Does not exists\n";
+    } else if (!std::filesystem::exists(input_path)) {
+        std::cout << "Error: " << input_path << " Does not exists\n";
         return EXIT_FAILURE;
     }
 
     std::vector<std::filesystem::path> file_list;
     std::vector<std::filesystem::path> failed_files;
 
-    if (!std::filesystem::is_directory(argv[1])) {
-        file_list.push_back(argv[1]);
+    if (!std::filesystem::is_directory(input_path)) {
+        file_list.push_back(input_path);
     } else {
-        for (auto const& dir_entry : std::filesystem::recursive_directory_iterator(argv[1])) {
+        for (auto const& dir_entry : std::filesystem::recursive_directory_iterator(input_path)) {
             if (std::filesystem::is_regular_file(dir_entry)) {
                 file_list.push_back(dir_entry.path());
             }
@@ -59,7 +63,7 @@ int main(int argc, char** argv) {
     // Main execution loop
     {
         // Single VkInstance scope for every shader
-        VulkanInstance vk;
+        VulkanInstance vk(!print_time);
         glslang::InitializeProcess();
 
         for (const auto& file : file_list) {
@@ -92,6 +96,13 @@ int main(int argc, char** argv) {
             }
         }
         glslang::FinalizeProcess();
+
+        if (print_time && vk.shader_module_count > 0) {
+            const auto total_us = std::chrono::duration_cast<std::chrono::microseconds>(vk.shader_module_time).count();
+            std::cout << "\nvkCreateShaderModule (shader validation disabled): " << vk.shader_module_count << " modules, "
+                      << vk.shader_module_bytes << " bytes of SPIR-V, " << total_us << " us total, "
+                      << (total_us / vk.shader_module_count) << " us per module\n";
+        }
     }
 
     if (!failed_files.empty()) {
@@ -429,7 +429,11 @@ bool Hopper::Run() {
     if (!Reflect()) return false;
     if (!CreatePipelineLayout()) return false;
     // Create shader module for shader we are testing
+    const auto start_time = std::chrono::steady_clock::now();
     if (!CreateShaderStage(file_size, spirv_data, shader_stage, entry_point.name)) return false;
+    vk.shader_module_time += std::chrono::steady_clock::now() - start_time;
+    vk.shader_module_count++;
+    vk.shader_module_bytes += file_size;
 
     bool success = true;
     switch (shader_stage) {
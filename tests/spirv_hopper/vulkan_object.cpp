@@ -64,7 +64,7 @@ VKAPI_ATTR VkBool32 VKAPI_CALL DebugUtilMessengerCallback(VkDebugUtilsMessageSev
     return VK_FALSE;
 }
 
-VulkanInstance::VulkanInstance() {
+VulkanInstance::VulkanInstance(bool shader_validation) {
     // Instance Creation
     vk::InitCore("vulkan");
     {
@@ -94,9 +94,14 @@ VulkanInstance::VulkanInstance() {
         app_info.pEngineName = "SPIRV-Hopper";
         app_info.engineVersion = 1;
 
+        const VkValidationFeatureDisableEXT disabled_features[] = {VK_VALIDATION_FEATURE_DISABLE_SHADERS_EXT};
+        auto validation_features = LvlInitStruct<VkValidationFeaturesEXT>(&debug_utils_create_info);
+        validation_features.disabledValidationFeatureCount = 1;
+        validation_features.pDisabledValidationFeatures = disabled_features;
+
         VkInstanceCreateInfo instance_info;
         instance_info.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
-        instance_info.pNext = &debug_utils_create_info;
+        instance_info.pNext = shader_validation ? static_cast<void *>(&debug_utils_create_info) : &validation_features;
         instance_info.flags = 0;
         instance_info.pApplicationInfo = &app_info;
         instance_info.enabledLayerCount = 0;
@@ -11,11 +11,13 @@
 
 #pragma once
 #include <vulkan/vulkan_core.h>
+#include <chrono>
 
 // Holds all Vulkan objects for the entire run
 struct VulkanInstance {
   public:
-    VulkanInstance();
+    // shader_validation false disables the validation layer's SPIR-V and shader interface checks, used by --time
+    explicit VulkanInstance(bool shader_validation = true);
     ~VulkanInstance();
 
     VkInstance instance = VK_NULL_HANDLE;
@@ -27,6 +29,12 @@ struct VulkanInstance {
     // Any Validation Errors caught
     bool is_valid = true;
 
+    // vkCreateShaderModule of the SPIR-V being tested, reported with --time. Shader validation is disabled then, so it is the
+    // layer parsing the module and the driver's own work, not running spirv-val.
+    std::chrono::nanoseconds shader_module_time{0};
+    size_t shader_module_count = 0;
+    size_t shader_module_bytes = 0;
+
     VkPhysicalDeviceProperties properties;
     VkPhysicalDeviceMemoryProperties memory_properties;
 